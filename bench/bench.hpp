@@ -0,0 +1,110 @@
+/**
+ * @file bench.hpp
+ * @brief Scenario registry and helpers for the finevox_bench executable
+ *
+ * Each bench_*.cpp file registers one or more named scenarios with
+ * FINEVOX_BENCH_SCENARIO. Scenarios print their own results to stdout.
+ *
+ * Usage: finevox_bench <scenario> [--size N] [--threads N] [--seed S] ...
+ *        finevox_bench --list
+ */
+
+#pragma once
+
+#include "finevox/worldgen/biome_map.hpp"
+#include "finevox/worldgen/world_generator.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace finevox::bench {
+
+// ============================================================================
+// Arguments
+// ============================================================================
+
+/// Parsed "--key value" options (a bare "--flag" stores "1")
+class BenchArgs {
+public:
+    BenchArgs() = default;
+    BenchArgs(int argc, char** argv, int first);
+
+    [[nodiscard]] int64_t getInt(const std::string& key, int64_t defaultVal) const;
+    [[nodiscard]] double getDouble(const std::string& key, double defaultVal) const;
+    [[nodiscard]] std::string getString(const std::string& key, const std::string& defaultVal) const;
+    [[nodiscard]] bool has(const std::string& key) const { return values_.contains(key); }
+
+private:
+    std::map<std::string, std::string> values_;
+};
+
+// ============================================================================
+// Scenario registry
+// ============================================================================
+
+/// Scenario entry point; returns process exit code
+using ScenarioFn = std::function<int(const BenchArgs&)>;
+
+struct Scenario {
+    std::string name;
+    std::string description;
+    ScenarioFn run;
+};
+
+/// All registered scenarios, sorted by name
+[[nodiscard]] std::map<std::string, Scenario>& scenarios();
+
+struct ScenarioRegistrar {
+    ScenarioRegistrar(std::string name, std::string description, ScenarioFn fn);
+};
+
+#define FINEVOX_BENCH_CONCAT_INNER(a, b) a##b
+#define FINEVOX_BENCH_CONCAT(a, b) FINEVOX_BENCH_CONCAT_INNER(a, b)
+#define FINEVOX_BENCH_SCENARIO(name, description, fn) \
+    static ::finevox::bench::ScenarioRegistrar FINEVOX_BENCH_CONCAT(benchRegistrar_, __LINE__)(name, description, fn)
+
+// ============================================================================
+// Timing
+// ============================================================================
+
+class Stopwatch {
+public:
+    Stopwatch() : start_(std::chrono::steady_clock::now()) {}
+
+    void reset() { start_ = std::chrono::steady_clock::now(); }
+
+    [[nodiscard]] double elapsedMs() const {
+        return std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start_).count();
+    }
+
+    [[nodiscard]] double elapsedSec() const { return elapsedMs() / 1000.0; }
+
+private:
+    std::chrono::steady_clock::time_point start_;
+};
+
+// ============================================================================
+// World generation setup
+// ============================================================================
+
+/// Default pipeline + biome map built from the shipped resources/ directory
+/// (same setup as render_demo --worldgen)
+struct DefaultWorldgen {
+    worldgen::GenerationPipeline pipeline;
+    std::unique_ptr<worldgen::BiomeMap> biomeMap;
+};
+
+/// Load biomes/features from resources and build the standard six passes.
+/// Resets the global biome and feature registries.
+[[nodiscard]] std::unique_ptr<DefaultWorldgen> makeDefaultWorldgen(uint64_t seed);
+
+/// Column positions of a size x size square starting at (0, 0), row-major
+[[nodiscard]] std::vector<ColumnPos> squareArea(int32_t size);
+
+}  // namespace finevox::bench
@@ -0,0 +1,593 @@
+/**
+ * @file bench_events.cpp
+ * @brief Event system scenarios
+ */
+
+#include "bench.hpp"
+
+#include "finevox/core/block_handler.hpp"  // For TickType
+#include "finevox/core/block_type.hpp"
+#include "finevox/core/data_container.hpp"
+#include "finevox/core/event_queue.hpp"
+#include "finevox/core/tick_wheel.hpp"
+#include "finevox/core/world.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+
+namespace finevox::bench {
+namespace {
+
+// The scheduler's previous storage: a min-heap, cancelled by rebuilding it
+class HeapTicks {
+public:
+    void schedule(BlockPos pos, uint64_t targetTick, TickType type) {
+        heap_.push(ScheduledTick{pos, targetTick, type});
+    }
+
+    void cancel(BlockPos pos) {
+        std::vector<ScheduledTick> remaining;
+        remaining.reserve(heap_.size());
+        while (!heap_.empty()) {
+            if (heap_.top().pos != pos) {
+                remaining.push_back(heap_.top());
+            }
+            heap_.pop();
+        }
+        for (const auto& tick : remaining) {
+            heap_.push(tick);
+        }
+    }
+
+    void advanceTo(uint64_t tick, std::vector<ScheduledTick>& due) {
+        while (!heap_.empty() && heap_.top().targetTick <= tick) {
+            due.push_back(heap_.top());
+            heap_.pop();
+        }
+    }
+
+    [[nodiscard]] size_t size() const { return heap_.size(); }
+
+private:
+    std::priority_queue<ScheduledTick, std::vector<ScheduledTick>,
+                        std::greater<ScheduledTick>> heap_;
+};
+
+struct TickRun {
+    double ms = 0.0;
+    uint64_t fired = 0;
+    std::vector<uint64_t> firedPerTick;  // Order-independent digest of each tick's batch
+};
+
+// Schedule `count` ticks with delays in [1, maxDelay], then run `rounds` game
+// ticks. Every fired tick reschedules itself (a repeating block); each round
+// also cancels `cancels` random positions and schedules them again.
+template<typename Ticks>
+TickRun runTicks(Ticks& ticks, int64_t count, int64_t maxDelay, int64_t rounds,
+                 int64_t cancels, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<int64_t> pick(0, count - 1);
+
+    // Delays come from (position, tick) rather than the RNG stream, so the
+    // order ticks fire within one game tick cannot change later schedules
+    auto targetFor = [&](BlockPos pos, uint64_t now) {
+        uint64_t h = (std::hash<BlockPos>{}(pos) ^ (now * 0x9E3779B97F4A7C15ull) ^ seed) *
+                     0xBF58476D1CE4E5B9ull;
+        return now + 1 + (h >> 17) % static_cast<uint64_t>(maxDelay);
+    };
+
+    auto posOf = [](int64_t i) {
+        return BlockPos(static_cast<int32_t>(i % 256), static_cast<int32_t>(i / 65536),
+                        static_cast<int32_t>((i / 256) % 256));
+    };
+
+    TickRun run;
+    std::vector<ScheduledTick> due;
+    Stopwatch timer;
+    for (int64_t i = 0; i < count; ++i) {
+        ticks.schedule(posOf(i), targetFor(posOf(i), 0), TickType::Scheduled);
+    }
+    for (int64_t tick = 1; tick <= rounds; ++tick) {
+        auto now = static_cast<uint64_t>(tick);
+        for (int64_t c = 0; c < cancels; ++c) {
+            BlockPos pos = posOf(pick(rng));
+            ticks.cancel(pos);
+            ticks.schedule(pos, targetFor(pos, now), TickType::Scheduled);
+        }
+
+        due.clear();
+        ticks.advanceTo(now, due);
+        uint64_t digest = 0;
+        for (const auto& fired : due) {
+            digest += std::hash<BlockPos>{}(fired.pos) * 0x9E3779B97F4A7C15ull;
+            ticks.schedule(fired.pos, targetFor(fired.pos, now), TickType::Scheduled);
+        }
+        run.fired += due.size();
+        run.firedPerTick.push_back(digest ^ due.size());
+    }
+    run.ms = timer.elapsedMs();
+    return run;
+}
+
+// Heap vs TickWheel on the same workload; the per-tick batches must match
+int scheduledTicks(const BenchArgs& args) {
+    int64_t count = args.getInt("ticks", 100000);
+    int64_t maxDelay = args.getInt("max-delay", 2000);
+    int64_t rounds = args.getInt("rounds", 1000);
+    int64_t cancels = args.getInt("cancels", 1);
+    auto seed = static_cast<uint64_t>(args.getInt("seed", 1));
+
+    HeapTicks heap;
+    TickRun heapRun = runTicks(heap, count, maxDelay, rounds, cancels, seed);
+    TickWheel wheel;
+    TickRun wheelRun = runTicks(wheel, count, maxDelay, rounds, cancels, seed);
+
+    uint64_t mismatched = 0;
+    for (size_t i = 0; i < heapRun.firedPerTick.size(); ++i) {
+        mismatched += heapRun.firedPerTick[i] != wheelRun.firedPerTick[i] ? 1 : 0;
+    }
+
+    std::cout << std::fixed << std::setprecision(1)
+              << count << " pending ticks, " << rounds << " game ticks, "
+              << cancels << " cancels/tick, " << heapRun.fired << " fired\n"
+              << "  heap:  " << heapRun.ms << " ms\n"
+              << "  wheel: " << wheelRun.ms << " ms ("
+              << std::setprecision(2) << heapRun.ms / wheelRun.ms << "x)\n"
+              << "  mismatched game ticks: " << mismatched << "\n";
+    return mismatched == 0 && heap.size() == wheel.size() ? 0 : 1;
+}
+
+// Terrain-like world: `columns` columns, each 8 subchunks of stone with a
+// grass surface layer (the only random-tickable type) in the top one
+void buildRandomTickWorld(World& world, int64_t columns) {
+    BlockType grassType;
+    grassType.setWantsRandomTicks(true);
+    BlockRegistry::global().registerType("bench:grass", grassType);
+    BlockTypeId grass = BlockTypeId::fromName("bench:grass");
+    BlockTypeId stone = BlockTypeId::fromName("bench:stone");
+
+    auto side = static_cast<int32_t>(std::ceil(std::sqrt(static_cast<double>(columns))));
+    for (int64_t i = 0; i < columns; ++i) {
+        ChunkColumn& column = world.getOrCreateColumn(
+            ColumnPos{static_cast<int32_t>(i % side), static_cast<int32_t>(i / side)});
+        for (int32_t y = 0; y < 8; ++y) {
+            column.getOrCreateSubChunk(y).fill(stone);
+        }
+        SubChunk& top = column.getOrCreateSubChunk(7);
+        for (int32_t local = 15 * 256; local < SubChunk::VOLUME; ++local) {
+            top.setBlock(static_cast<uint16_t>(local), grass);
+        }
+    }
+}
+
+// Previous generator: every loaded subchunk, a locked lookup each, mt19937
+// positions and an event for any non-air block
+size_t legacyRandomTicks(World& world, std::mt19937& rng, uint32_t perSubchunk, EventOutbox& outbox) {
+    std::uniform_int_distribution<int32_t> dist(0, SubChunk::VOLUME - 1);
+    for (const ChunkPos& chunkPos : world.getAllSubChunkPositions()) {
+        SubChunk* subchunk = world.getSubChunk(chunkPos);
+        if (!subchunk) continue;
+        for (uint32_t i = 0; i < perSubchunk; ++i) {
+            int32_t localIndex = dist(rng);
+            if (!subchunk->getBlock(static_cast<uint16_t>(localIndex)).isAir()) {
+                outbox.push(BlockEvent::tick(chunkPos.toWorld(localIndex), TickType::Random));
+            }
+        }
+    }
+    return outbox.size();
+}
+
+// Per-tick random tick generation on a loaded world, old path vs UpdateScheduler
+int randomTicks(const BenchArgs& args) {
+    int64_t columns = args.getInt("columns", 1000);
+    int64_t rounds = args.getInt("rounds", 200);
+    auto perSubchunk = static_cast<uint32_t>(args.getInt("per-subchunk", 3));
+
+    World world;
+    buildRandomTickWorld(world, columns);
+
+    std::mt19937 rng(1);
+    EventOutbox outbox;
+    std::vector<BlockEvent> drained;
+    size_t legacyEvents = 0;
+    double legacyMs = 0.0;
+    for (int64_t round = 0; round < rounds; ++round) {
+        Stopwatch timer;
+        legacyEvents += legacyRandomTicks(world, rng, perSubchunk, outbox);
+        legacyMs += timer.elapsedMs();
+        drained.clear();
+        outbox.swapTo(drained);
+    }
+
+    UpdateScheduler scheduler(world);
+    TickConfig config;
+    config.randomSeed = 1;
+    config.randomTicksPerSubchunk = perSubchunk;
+    config.gameTicksEnabled = false;
+    scheduler.setTickConfig(config);
+    size_t events = 0;
+    double ms = 0.0;
+    for (int64_t round = 0; round < rounds; ++round) {
+        Stopwatch timer;
+        scheduler.advanceGameTick();
+        ms += timer.elapsedMs();
+        events += scheduler.pendingEventCount();
+        scheduler.processEvents();
+    }
+
+    double perRound = static_cast<double>(rounds);
+    std::cout << std::fixed << std::setprecision(3)
+              << columns << " columns, " << world.getAllSubChunkPositions().size() << " subchunks ("
+              << world.randomTickSet().size() << " with random-tickable types), "
+              << perSubchunk << " attempts/subchunk\n"
+              << "  all non-air:      " << legacyMs / perRound << " ms/tick, "
+              << legacyEvents / static_cast<size_t>(rounds) << " events/tick\n"
+              << "  random-tick set:  " << ms / perRound << " ms/tick, "
+              << events / static_cast<size_t>(rounds) << " events/tick ("
+              << std::setprecision(2) << legacyMs / ms << "x)\n";
+    return 0;
+}
+
+// Region-safe handler with some per-event work: samples its neighbors and
+// keeps a running count in its own data
+class BenchCircuit : public BlockHandler {
+public:
+    [[nodiscard]] std::string_view name() const override { return "bench:circuit"; }
+    [[nodiscard]] bool isRegionSafe() const override { return true; }
+
+    void onBlockUpdate(BlockContext& ctx) override {
+        int64_t powered = 0;
+        for (int face = 0; face < 6; ++face) {
+            powered += ctx.getNeighbor(static_cast<Face>(face)) == ctx.blockType() ? 1 : 0;
+        }
+        DataContainer& data = ctx.getOrCreateData();
+        auto updates = data.get<int64_t>("updates") + 1;
+        data.set("updates", updates);
+        data.set("powered", powered);
+        ctx.setRotationIndex(static_cast<uint8_t>((ctx.rotationIndex() + powered) % 24));
+        if (updates < 3) {
+            ctx.pushEvent(BlockEvent::blockUpdate(ctx.pos().neighbor(Face::PosX)));
+        }
+    }
+};
+
+// Circuit blocks on every other cell of a flat layer, `columns` columns wide
+std::vector<BlockPos> buildCircuitWorld(World& world, int64_t columns) {
+    BlockTypeId circuit = BlockTypeId::fromName("bench:circuit");
+    auto side = static_cast<int32_t>(std::ceil(std::sqrt(static_cast<double>(columns)))) * 16;
+    std::vector<BlockPos> blocks;
+    for (int32_t x = 0; x < side; ++x) {
+        for (int32_t z = 0; z < side; z += 2) {
+            BlockPos pos(x, 8, z);
+            world.setBlock(pos, circuit);
+            blocks.push_back(pos);
+        }
+    }
+    return blocks;
+}
+
+// One update per circuit block, then the chains they start, per config
+double runCircuit(int64_t columns, const ParallelEventConfig& parallel, size_t& events, uint64_t& parallelEvents) {
+    World world;
+    std::vector<BlockPos> blocks = buildCircuitWorld(world, columns);
+    UpdateScheduler scheduler(world);
+    scheduler.setParallelConfig(parallel);
+    for (const BlockPos& pos : blocks) {
+        scheduler.pushExternalEvent(BlockEvent::blockUpdate(pos));
+    }
+
+    Stopwatch timer;
+    events = scheduler.processEvents();
+    double ms = timer.elapsedMs();
+    parallelEvents = scheduler.parallelEventCount();
+    return ms;
+}
+
+// Serial processing vs region-partitioned processing of the same updates
+int parallelEvents(const BenchArgs& args) {
+    int64_t columns = args.getInt("columns", 64);
+    auto threads = static_cast<size_t>(args.getInt("threads", 0));
+    BlockRegistry::global().registerHandler("bench:circuit", std::make_unique<BenchCircuit>());
+
+    size_t serialEvents = 0;
+    uint64_t unused = 0;
+    double serialMs = runCircuit(columns, ParallelEventConfig{}, serialEvents, unused);
+
+    ParallelEventConfig parallel;
+    parallel.enabled = true;
+    parallel.threads = threads;
+    size_t events = 0;
+    uint64_t onWorkers = 0;
+    double parallelMs = runCircuit(columns, parallel, events, onWorkers);
+
+    std::cout << std::fixed << std::setprecision(1)
+              << columns << " columns, " << events << " events\n"
+              << "  serial:  " << serialMs << " ms\n"
+              << "  regions: " << parallelMs << " ms ("
+              << std::setprecision(2) << serialMs / parallelMs << "x, "
+              << onWorkers << " events on workers, threads="
+              << (threads != 0 ? threads : std::thread::hardware_concurrency()) << ")\n";
+    return events == serialEvents ? 0 : 1;
+}
+
+// Data-driven growth rules, as a script or config layer would hold them:
+// a string-keyed table behind a shared_mutex
+class GrowthRules {
+public:
+    void set(std::string_view crop, int step) {
+        std::unique_lock lock(mutex_);
+        steps_[std::string(crop)] = step;
+    }
+    int step(std::string_view crop) const {
+        std::shared_lock lock(mutex_);
+        auto it = steps_.find(std::string(crop));
+        return it != steps_.end() ? it->second : 1;
+    }
+
+private:
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, int> steps_;
+};
+
+// Same per-block work (advance the rotation) through onTick or onTickBatch.
+// With rules, the growth step is looked up per tick or once per batch.
+class EachTickCrop : public BlockHandler {
+public:
+    EachTickCrop(std::string name, const GrowthRules* rules) : name_(std::move(name)), rules_(rules) {}
+    [[nodiscard]] std::string_view name() const override { return name_; }
+    void onTick(BlockContext& ctx, TickType type) override {
+        (void)type;
+        grow(ctx, rules_ ? rules_->step(name_) : 1);
+    }
+
+protected:
+    static void grow(BlockContext& ctx, int step) {
+        ctx.setRotationIndex(static_cast<uint8_t>((ctx.rotationIndex() + step) % 24));
+    }
+
+    std::string name_;
+    const GrowthRules* rules_;
+};
+
+class BatchTickCrop : public EachTickCrop {
+public:
+    using EachTickCrop::EachTickCrop;
+    [[nodiscard]] bool wantsTickBatches() const override { return true; }
+    void onTickBatch(std::span<BlockContext> blocks, TickType type) override {
+        (void)type;
+        int step = rules_ ? rules_->step(name_) : 1;
+        for (BlockContext& ctx : blocks) {
+            grow(ctx, step);
+        }
+    }
+};
+
+// Random ticks on a full layer of crops per subchunk, per-event vs batched
+int tickBatches(const BenchArgs& args) {
+    int64_t columns = args.getInt("columns", 256);
+    int64_t rounds = args.getInt("rounds", 20);
+
+    GrowthRules rules;
+    auto& registry = BlockRegistry::global();
+    registry.registerHandler("bench:crop_each", std::make_unique<EachTickCrop>("bench:crop_each", nullptr));
+    registry.registerHandler("bench:crop_batch", std::make_unique<BatchTickCrop>("bench:crop_batch", nullptr));
+    registry.registerHandler("bench:crop_each_rules",
+                             std::make_unique<EachTickCrop>("bench:crop_each_rules", &rules));
+    registry.registerHandler("bench:crop_batch_rules",
+                             std::make_unique<BatchTickCrop>("bench:crop_batch_rules", &rules));
+    rules.set("bench:crop_each_rules", 1);
+    rules.set("bench:crop_batch_rules", 1);
+
+    auto run = [&](std::string_view typeName) {
+        BlockTypeId crop = BlockTypeId::fromName(typeName);
+        World world;
+        std::vector<BlockEvent> ticks;
+        auto side = static_cast<int32_t>(std::ceil(std::sqrt(static_cast<double>(columns))));
+        for (int64_t i = 0; i < columns; ++i) {
+            for (int32_t y = 0; y < 4; ++y) {
+                for (int32_t z = 0; z < 16; ++z) {
+                    for (int32_t x = 0; x < 16; ++x) {
+                        BlockPos pos(static_cast<int32_t>(i % side) * 16 + x, y * 16 + 1,
+                                     static_cast<int32_t>(i / side) * 16 + z);
+                        world.setBlock(pos, crop);
+                        ticks.push_back(BlockEvent::tick(pos, TickType::Random));
+                    }
+                }
+            }
+        }
+
+        UpdateScheduler scheduler(world);
+        double ms = 0.0;
+        for (int64_t round = 0; round < rounds; ++round) {
+            scheduler.pushExternalEvents(ticks);
+            Stopwatch timer;
+            scheduler.processEvents();
+            ms += timer.elapsedMs();
+        }
+        return std::tuple{ms, ticks.size() * static_cast<size_t>(rounds), scheduler.batchedTickCount()};
+    };
+
+    std::cout << std::fixed << std::setprecision(1)
+              << columns << " columns x 4 subchunks x 256 crops, " << rounds << " rounds\n";
+    bool ok = true;
+    auto compare = [&](const char* label, std::string_view eachType, std::string_view batchType) {
+        auto [eachMs, eachEvents, eachBatched] = run(eachType);
+        auto [batchMs, batchEvents, batchBatched] = run(batchType);
+        ok = ok && eachBatched == 0 && batchBatched == batchEvents;
+        std::cout << std::fixed << std::setprecision(1)
+                  << "  " << label << "\n"
+                  << "    per-event onTick: " << eachMs << " ms ("
+                  << static_cast<double>(eachEvents) / eachMs / 1000.0 << " M events/s)\n"
+                  << "    onTickBatch:      " << batchMs << " ms ("
+                  << static_cast<double>(batchEvents) / batchMs / 1000.0 << " M events/s, "
+                  << std::setprecision(2) << eachMs / batchMs << "x)\n";
+    };
+    compare("block-local work only:", "bench:crop_each", "bench:crop_batch");
+    compare("plus a growth-rule lookup:", "bench:crop_each_rules", "bench:crop_batch_rules");
+    return ok ? 0 : 1;
+}
+
+// The outbox's previous storage: an unordered_map keyed by (pos, type),
+// copied out in hash order
+class MapOutbox {
+public:
+    void push(const BlockEvent& event) {
+        auto [it, inserted] = pending_.try_emplace(Key{event.pos, event.type}, event);
+        if (!inserted) {
+            it->second.neighborFaceMask |= event.neighborFaceMask;
+            it->second.changedFace = event.changedFace;
+        }
+    }
+    void swapTo(std::vector<BlockEvent>& inbox) {
+        inbox.reserve(inbox.size() + pending_.size());
+        for (auto& [key, event] : pending_) {
+            inbox.push_back(event);
+        }
+        pending_.clear();
+    }
+
+private:
+    struct Key {
+        BlockPos pos;
+        EventType type;
+        bool operator==(const Key&) const = default;
+    };
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            size_t h = std::hash<int32_t>{}(key.pos.x);
+            h ^= std::hash<int32_t>{}(key.pos.y) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            h ^= std::hash<int32_t>{}(key.pos.z) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            h ^= std::hash<uint8_t>{}(static_cast<uint8_t>(key.type)) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            return h;
+        }
+    };
+    std::unordered_map<Key, BlockEvent, KeyHash> pending_;
+};
+
+// Neighbor notifications inside a cube: every pending block notifies its six
+// neighbors each round, so most pushes merge into an existing event
+template<typename Outbox>
+std::pair<double, uint64_t> runOutboxCascade(Outbox& outbox, int32_t size, int64_t rounds) {
+    std::vector<BlockEvent> inbox{BlockEvent::neighborChanged(BlockPos(size / 2, size / 2, size / 2), Face::PosX)};
+    uint64_t pushes = 0;
+    Stopwatch timer;
+    for (int64_t round = 0; round < rounds; ++round) {
+        for (const BlockEvent& event : inbox) {
+            for (int face = 0; face < 6; ++face) {
+                BlockPos next = event.pos.neighbor(static_cast<Face>(face));
+                if (next.x >= 0 && next.y >= 0 && next.z >= 0 && next.x < size && next.y < size && next.z < size) {
+                    Face from = oppositeFace(static_cast<Face>(face));
+                    BlockEvent notify = BlockEvent::neighborChanged(next, from);
+                    notify.addNeighborFace(from);
+                    outbox.push(notify);
+                    ++pushes;
+                }
+            }
+        }
+        inbox.clear();
+        outbox.swapTo(inbox);
+    }
+    return {timer.elapsedMs(), pushes};
+}
+
+// Queues a NeighborChanged event for each neighbor the first `depth` times
+// it is notified (notifyNeighbors would call the handlers directly)
+class CascadeRelay : public BlockHandler {
+public:
+    explicit CascadeRelay(uint8_t depth) : depth_(depth) {}
+    [[nodiscard]] std::string_view name() const override { return "bench:cascade_relay"; }
+    void onNeighborChanged(BlockContext& ctx, Face changedFace) override {
+        (void)changedFace;
+        if (ctx.rotationIndex() >= depth_) {
+            return;
+        }
+        ctx.setRotationIndex(static_cast<uint8_t>(ctx.rotationIndex() + 1));
+        for (int face = 0; face < 6; ++face) {
+            Face from = oppositeFace(static_cast<Face>(face));
+            BlockEvent notify = BlockEvent::neighborChanged(ctx.pos().neighbor(static_cast<Face>(face)), from);
+            notify.addNeighborFace(from);
+            ctx.pushEvent(notify);
+        }
+    }
+
+private:
+    uint8_t depth_;
+};
+
+int outboxCascade(const BenchArgs& args) {
+    auto size = static_cast<int32_t>(args.getInt("size", 48));
+    int64_t rounds = args.getInt("rounds", 60);
+    auto depth = static_cast<uint8_t>(std::clamp<int64_t>(args.getInt("depth", 8), 1, 23));
+
+    MapOutbox mapOutbox;
+    EventOutbox flatOutbox;
+    auto [mapMs, mapPushes] = runOutboxCascade(mapOutbox, size, rounds);
+    auto [flatMs, flatPushes] = runOutboxCascade(flatOutbox, size, rounds);
+
+    // End to end: a cube of relays, started from one corner
+    BlockRegistry::global().registerHandler("bench:cascade_relay", std::make_unique<CascadeRelay>(depth));
+    BlockTypeId relay = BlockTypeId::fromName("bench:cascade_relay");
+    World world;
+    for (int32_t y = 0; y < size; ++y) {
+        for (int32_t z = 0; z < size; ++z) {
+            for (int32_t x = 0; x < size; ++x) {
+                world.setBlock(BlockPos(x, y, z), relay);
+            }
+        }
+    }
+    UpdateScheduler scheduler(world);
+    BlockEvent start = BlockEvent::neighborChanged(BlockPos(0, 0, 0), Face::NegX);
+    start.addNeighborFace(Face::NegX);
+    scheduler.pushExternalEvent(start);
+    Stopwatch cascadeTimer;
+    size_t events = scheduler.processEvents();
+    double cascadeMs = cascadeTimer.elapsedMs();
+
+    std::cout << std::fixed << std::setprecision(1)
+              << size << "^3 cube, " << rounds << " outbox rounds, relay depth " << static_cast<int>(depth) << "\n"
+              << "  unordered_map outbox: " << mapMs << " ms ("
+              << static_cast<double>(mapPushes) / mapMs / 1000.0 << " M pushes/s)\n"
+              << "  flat outbox:          " << flatMs << " ms ("
+              << static_cast<double>(flatPushes) / flatMs / 1000.0 << " M pushes/s, "
+              << std::setprecision(2) << mapMs / flatMs << "x)\n"
+              << std::setprecision(1)
+              << "  processEvents cascade: " << events << " events in " << cascadeMs << " ms ("
+              << static_cast<double>(events) / cascadeMs / 1000.0 << " M events/s)\n";
+    return mapPushes == flatPushes ? 0 : 1;
+}
+
+}  // namespace
+
+FINEVOX_BENCH_SCENARIO("outbox-cascade",
+    "Neighbor-notification cascade: unordered_map vs flat outbox, plus processEvents end to end "
+    "(--size N, --rounds N, --depth N)",
+    outboxCascade);
+
+FINEVOX_BENCH_SCENARIO("parallel-events",
+    "Serial vs region-partitioned event processing (--columns N, --threads N)",
+    parallelEvents);
+
+FINEVOX_BENCH_SCENARIO("tick-batches",
+    "Random ticks on crop layers: per-event onTick vs onTickBatch (--columns N, --rounds N)",
+    tickBatches);
+
+FINEVOX_BENCH_SCENARIO("random-ticks",
+    "Random tick generation per game tick, all subchunks vs random-tick set (--columns N, --rounds N)",
+    randomTicks);
+
+FINEVOX_BENCH_SCENARIO("scheduled-ticks",
+    "Scheduled tick heap vs TickWheel with cancellation (--ticks N, --max-delay N, --rounds N, --cancels N)",
+    scheduledTicks);
+
+}  // namespace finevox::bench
@@ -0,0 +1,164 @@
+/**
+ * @file bench_io.cpp
+ * @brief IOManager region handle cache and read-ahead scenarios
+ */
+
+#include "bench.hpp"
+
+#include "finevox/core/io_manager.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+namespace finevox::bench {
+namespace {
+
+// Write a strip of regions along +x, straddling z = 0. Each column is saved
+// several times so the .toc carries journal history like a played world.
+void writeFlightWorld(const std::filesystem::path& dir, int32_t regions, int saves) {
+    BlockTypeId stone = BlockTypeId::fromName("bench:stone");
+    BlockTypeId dirt = BlockTypeId::fromName("bench:dirt");
+
+    for (int32_t rx = 0; rx < regions; ++rx) {
+        for (int32_t rz : {-1, 0}) {
+            RegionFile region(dir, RegionPos{rx, rz});
+            for (int save = 0; save < saves; ++save) {
+                for (int32_t lz = 0; lz < REGION_SIZE; ++lz) {
+                    for (int32_t lx = 0; lx < REGION_SIZE; ++lx) {
+                        ColumnPos pos{rx * REGION_SIZE + lx, rz * REGION_SIZE + lz};
+                        ChunkColumn col(pos);
+                        for (int y = 0; y < 48; ++y) {
+                            col.setBlock(lx % 16, y, lz % 16, (y + save) % 4 ? stone : dirt);
+                        }
+                        region.saveColumn(col, pos);
+                    }
+                }
+            }
+        }
+    }
+}
+
+struct FlightResult {
+    double ms = 0.0;
+    uint64_t loads = 0;
+    uint64_t regionOpens = 0;
+    uint64_t indexCacheHits = 0;
+    uint64_t readAheadHits = 0;
+};
+
+// Fly along +x and back, loading the leading row of a view band that spans
+// z in [-radius, radius). Loads are issued row by row and waited on, like a
+// streaming client.
+FlightResult fly(const std::filesystem::path& dir, int32_t regions, int32_t radius,
+                 size_t openRegions, bool indexCache, bool readAhead, int passes) {
+    IOManager io(dir);
+    io.setMaxOpenRegions(openRegions);
+    io.setMaxCachedIndexes(indexCache ? 256 : 0);
+    io.setReadAheadEnabled(readAhead);
+    io.start();
+
+    FlightResult result;
+    int32_t span = regions * REGION_SIZE;
+    std::atomic<uint64_t> completed{0};
+
+    Stopwatch timer;
+    for (int pass = 0; pass < passes; ++pass) {
+        for (int32_t step = 0; step < span; ++step) {
+            int32_t x = (pass % 2 == 0) ? step : span - 1 - step;
+            uint64_t target = result.loads;
+            for (int32_t z = -radius; z < radius; ++z) {
+                io.requestLoad(ColumnPos{x, z}, [&](ColumnPos, std::unique_ptr<ChunkColumn>) {
+                    completed.fetch_add(1, std::memory_order_relaxed);
+                });
+                ++target;
+            }
+            result.loads = target;
+            while (completed.load(std::memory_order_relaxed) < target) {
+                std::this_thread::yield();
+            }
+        }
+    }
+    result.ms = timer.elapsedMs();
+
+    io.stop();
+    result.regionOpens = io.stats().regionOpens;
+    result.indexCacheHits = io.stats().indexCacheHits;
+    result.readAheadHits = io.stats().readAheadHits;
+    return result;
+}
+
+int regionFlight(const BenchArgs& args) {
+    int32_t regions = static_cast<int32_t>(args.getInt("regions", 6));
+    int32_t radius = static_cast<int32_t>(args.getInt("radius", 8));
+    size_t openRegions = static_cast<size_t>(args.getInt("open", 1));
+    int saves = static_cast<int>(args.getInt("saves", 3));
+    int passes = static_cast<int>(args.getInt("passes", 4));
+
+    auto dir = std::filesystem::temp_directory_path() / "finevox_bench_flight";
+    std::filesystem::remove_all(dir);
+    writeFlightWorld(dir, regions, saves);
+
+    std::cout << regions * 2 << " regions, " << saves << " saves per column, "
+              << openRegions << " open region(s), " << passes << " passes\n";
+
+    // Cost of a single region open with and without a captured index
+    {
+        constexpr int OPENS = 50;
+        RegionIndex index = RegionFile(dir, RegionPos{0, 0}).captureIndex();
+        Stopwatch parseTimer;
+        for (int i = 0; i < OPENS; ++i) {
+            RegionFile region(dir, RegionPos{0, 0});
+        }
+        double parseUs = parseTimer.elapsedMs() * 1000.0 / OPENS;
+        Stopwatch cachedTimer;
+        for (int i = 0; i < OPENS; ++i) {
+            RegionFile region(dir, RegionPos{0, 0}, index);
+        }
+        double cachedUs = cachedTimer.elapsedMs() * 1000.0 / OPENS;
+        std::cout << std::fixed << std::setprecision(0)
+                  << "region open: " << parseUs << " us parsing .toc, "
+                  << cachedUs << " us from cached index\n\n";
+    }
+
+    std::cout << std::left << std::setw(20) << "mode"
+              << std::right << std::setw(10) << "ms"
+              << std::setw(13) << "loads/sec"
+              << std::setw(8) << "opens"
+              << std::setw(12) << "toc parses"
+              << std::setw(17) << "read-ahead hits" << "\n";
+
+    struct Mode {
+        const char* name;
+        bool indexCache;
+        bool readAhead;
+    };
+    for (const Mode& mode : {Mode{"no cache", false, false},
+                             Mode{"index cache", true, false},
+                             Mode{"cache+read-ahead", true, true}}) {
+        FlightResult r = fly(dir, regions, radius, openRegions, mode.indexCache,
+                             mode.readAhead, passes);
+        std::cout << std::left << std::setw(20) << mode.name
+                  << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << r.ms
+                  << std::setw(13) << std::setprecision(0)
+                  << static_cast<double>(r.loads) / (r.ms / 1000.0)
+                  << std::setw(8) << r.regionOpens
+                  << std::setw(12) << r.regionOpens - r.indexCacheHits
+                  << std::setw(17) << r.readAheadHits << "\n";
+    }
+
+    std::filesystem::remove_all(dir);
+    return 0;
+}
+
+}  // namespace
+
+FINEVOX_BENCH_SCENARIO("region-flight",
+    "Stream columns along a multi-region flight; index cache and read-ahead on/off "
+    "(--regions N, --radius N, --open N, --saves N, --passes N)",
+    regionFlight);
+
+}  // namespace finevox::bench
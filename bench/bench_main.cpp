@@ -0,0 +1,147 @@
+/**
+ * @file bench_main.cpp
+ * @brief finevox_bench entry point and shared helpers
+ */
+
+#include "bench.hpp"
+
+#include "finevox/worldgen/biome.hpp"
+#include "finevox/worldgen/biome_loader.hpp"
+#include "finevox/worldgen/feature_loader.hpp"
+#include "finevox/worldgen/feature_registry.hpp"
+#include "finevox/worldgen/generation_passes.hpp"
+
+#include <iostream>
+
+namespace finevox::bench {
+
+// ============================================================================
+// BenchArgs
+// ============================================================================
+
+BenchArgs::BenchArgs(int argc, char** argv, int first) {
+    for (int i = first; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.rfind("--", 0) != 0) continue;
+        std::string key = arg.substr(2);
+        if (i + 1 < argc && std::string(argv[i + 1]).rfind("--", 0) != 0) {
+            values_[key] = argv[++i];
+        } else {
+            values_.insert_or_assign(key, std::string("1"));
+        }
+    }
+}
+
+int64_t BenchArgs::getInt(const std::string& key, int64_t defaultVal) const {
+    auto it = values_.find(key);
+    return it != values_.end() ? std::stoll(it->second) : defaultVal;
+}
+
+double BenchArgs::getDouble(const std::string& key, double defaultVal) const {
+    auto it = values_.find(key);
+    return it != values_.end() ? std::stod(it->second) : defaultVal;
+}
+
+std::string BenchArgs::getString(const std::string& key, const std::string& defaultVal) const {
+    auto it = values_.find(key);
+    return it != values_.end() ? it->second : defaultVal;
+}
+
+// ============================================================================
+// Scenario registry
+// ============================================================================
+
+std::map<std::string, Scenario>& scenarios() {
+    static std::map<std::string, Scenario> registry;
+    return registry;
+}
+
+ScenarioRegistrar::ScenarioRegistrar(std::string name, std::string description, ScenarioFn fn) {
+    std::string key = name;
+    scenarios()[key] = Scenario{std::move(name), std::move(description), std::move(fn)};
+}
+
+// ============================================================================
+// World generation setup
+// ============================================================================
+
+std::unique_ptr<DefaultWorldgen> makeDefaultWorldgen(uint64_t seed) {
+    using namespace worldgen;
+
+    BiomeRegistry::global().clear();
+    FeatureRegistry::global().clear();
+
+    std::string resourceDir = FINEVOX_RESOURCE_DIR;
+    BiomeLoader::loadDirectory(resourceDir + "/biomes", "demo");
+    FeatureLoader::loadDirectory(resourceDir + "/features", "demo");
+
+    // Same placement rules as render_demo --worldgen
+    if (FeatureRegistry::global().getFeature("demo:oak_tree")) {
+        FeaturePlacement placement;
+        placement.featureName = "demo:oak_tree";
+        placement.density = 0.02f;
+        placement.requiresSurface = true;
+        FeatureRegistry::global().addPlacement(placement);
+    }
+    if (FeatureRegistry::global().getFeature("demo:iron_ore")) {
+        FeaturePlacement placement;
+        placement.featureName = "demo:iron_ore";
+        placement.density = 0.03f;
+        placement.minHeight = 0;
+        placement.maxHeight = 48;
+        FeatureRegistry::global().addPlacement(placement);
+    }
+    if (FeatureRegistry::global().getFeature("demo:coal_ore")) {
+        FeaturePlacement placement;
+        placement.featureName = "demo:coal_ore";
+        placement.density = 0.04f;
+        placement.minHeight = 0;
+        placement.maxHeight = 64;
+        FeatureRegistry::global().addPlacement(placement);
+    }
+
+    auto gen = std::make_unique<DefaultWorldgen>();
+    gen->pipeline.setWorldSeed(seed);
+    gen->pipeline.addPass(std::make_unique<TerrainPass>(seed));
+    gen->pipeline.addPass(std::make_unique<SurfacePass>());
+    gen->pipeline.addPass(std::make_unique<CavePass>(seed));
+    gen->pipeline.addPass(std::make_unique<OrePass>());
+    gen->pipeline.addPass(std::make_unique<StructurePass>());
+    gen->pipeline.addPass(std::make_unique<DecorationPass>());
+    gen->biomeMap = std::make_unique<BiomeMap>(seed, BiomeRegistry::global());
+    return gen;
+}
+
+std::vector<ColumnPos> squareArea(int32_t size) {
+    std::vector<ColumnPos> positions;
+    positions.reserve(static_cast<size_t>(size) * static_cast<size_t>(size));
+    for (int32_t x = 0; x < size; ++x) {
+        for (int32_t z = 0; z < size; ++z) {
+            positions.push_back(ColumnPos(x, z));
+        }
+    }
+    return positions;
+}
+
+}  // namespace finevox::bench
+
+int main(int argc, char** argv) {
+    using namespace finevox::bench;
+
+    if (argc < 2 || std::string(argv[1]) == "--list" || std::string(argv[1]) == "--help") {
+        std::cout << "Usage: finevox_bench <scenario> [--option value ...]\n\nScenarios:\n";
+        for (const auto& [name, scenario] : scenarios()) {
+            std::cout << "  " << name << "\n      " << scenario.description << "\n";
+        }
+        return argc < 2 ? 1 : 0;
+    }
+
+    auto it = scenarios().find(argv[1]);
+    if (it == scenarios().end()) {
+        std::cerr << "Unknown scenario: " << argv[1] << " (try --list)\n";
+        return 1;
+    }
+
+    std::cout << "== " << it->first << " ==\n";
+    return it->second.run(BenchArgs(argc, argv, 2));
+}
@@ -0,0 +1,299 @@
+/**
+ * @file bench_region.cpp
+ * @brief Region file compression scenarios
+ */
+
+#include "bench.hpp"
+
+#include "finevox/core/config.hpp"
+#include "finevox/core/region_file.hpp"
+#include "finevox/core/serialization.hpp"
+#include "finevox/core/world.hpp"
+
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <lz4.h>
+
+namespace finevox::bench {
+namespace {
+
+struct CompressionResult {
+    uint64_t storedBytes = 0;
+    uint64_t dictionaryBytes = 0;
+    double saveMs = 0.0;
+    double loadMs = 0.0;
+    double decompressMs = 0.0;
+};
+
+// Raw LZ4 decode time over the same payloads, isolating decompression from
+// file reads and CBOR decoding (which dominate loadColumn)
+double timeDecompression(const std::vector<std::pair<ColumnPos, std::vector<uint8_t>>>& columns,
+                         const std::vector<uint8_t>* dictionary, int rounds) {
+    std::vector<std::vector<char>> compressed;
+    for (const auto& [pos, cbor] : columns) {
+        std::vector<char> out(static_cast<size_t>(LZ4_compressBound(static_cast<int>(cbor.size()))));
+        int n = 0;
+        if (dictionary) {
+            LZ4_stream_t stream;
+            LZ4_initStream(&stream, sizeof(stream));
+            LZ4_loadDict(&stream, reinterpret_cast<const char*>(dictionary->data()),
+                         static_cast<int>(dictionary->size()));
+            n = LZ4_compress_fast_continue(&stream, reinterpret_cast<const char*>(cbor.data()),
+                                           out.data(), static_cast<int>(cbor.size()),
+                                           static_cast<int>(out.size()), 1);
+        } else {
+            n = LZ4_compress_default(reinterpret_cast<const char*>(cbor.data()), out.data(),
+                                     static_cast<int>(cbor.size()), static_cast<int>(out.size()));
+        }
+        out.resize(static_cast<size_t>(n));
+        compressed.push_back(std::move(out));
+    }
+
+    std::vector<char> scratch;
+    Stopwatch timer;
+    for (int round = 0; round < rounds; ++round) {
+        for (size_t i = 0; i < columns.size(); ++i) {
+            scratch.resize(columns[i].second.size());
+            if (dictionary) {
+                LZ4_decompress_safe_usingDict(compressed[i].data(), scratch.data(),
+                    static_cast<int>(compressed[i].size()), static_cast<int>(scratch.size()),
+                    reinterpret_cast<const char*>(dictionary->data()),
+                    static_cast<int>(dictionary->size()));
+            } else {
+                LZ4_decompress_safe(compressed[i].data(), scratch.data(),
+                    static_cast<int>(compressed[i].size()), static_cast<int>(scratch.size()));
+            }
+        }
+    }
+    return timer.elapsedMs() / rounds;
+}
+
+CompressionResult runCompressionMode(const std::filesystem::path& dir,
+                                     const std::vector<std::pair<ColumnPos, std::vector<uint8_t>>>& columns,
+                                     bool useDictionary, int loadRounds) {
+    ConfigManager::instance().setCompressionDictionaryEnabled(useDictionary);
+
+    std::map<std::pair<int32_t, int32_t>, std::unique_ptr<RegionFile>> regions;
+    auto regionFor = [&](ColumnPos pos) -> RegionFile& {
+        RegionPos rp = RegionPos::fromColumn(pos);
+        auto& region = regions[{rp.rx, rp.rz}];
+        if (!region) {
+            region = std::make_unique<RegionFile>(dir, rp);
+        }
+        return *region;
+    };
+
+    CompressionResult result;
+    std::vector<uint8_t> firstDictionary;
+
+    if (useDictionary) {
+        // Train up front from the first samples of each region so every
+        // column is measured against a dictionary
+        std::map<std::pair<int32_t, int32_t>, std::vector<std::vector<uint8_t>>> samples;
+        for (const auto& [pos, cbor] : columns) {
+            RegionPos rp = RegionPos::fromColumn(pos);
+            auto& list = samples[{rp.rx, rp.rz}];
+            if (list.size() < DICTIONARY_TRAINING_SAMPLES) {
+                list.push_back(cbor);
+            }
+        }
+        for (const auto& [key, list] : samples) {
+            auto dictionary = trainCompressionDictionary(list);
+            result.dictionaryBytes += dictionary.size();
+            if (firstDictionary.empty()) {
+                firstDictionary = dictionary;
+            }
+            (void)regionFor(ColumnPos(key.first * REGION_SIZE, key.second * REGION_SIZE))
+                .addDictionary(std::move(dictionary));
+        }
+    }
+
+    Stopwatch saveTimer;
+    for (const auto& [pos, cbor] : columns) {
+        regionFor(pos).saveColumnRaw(pos, cbor);
+    }
+    result.saveMs = saveTimer.elapsedMs();
+
+    for (const auto& [key, region] : regions) {
+        result.storedBytes += region->dataFileSize();
+    }
+
+    Stopwatch loadTimer;
+    for (int round = 0; round < loadRounds; ++round) {
+        for (const auto& [pos, cbor] : columns) {
+            auto column = regionFor(pos).loadColumn(pos);
+            if (!column) {
+                std::cerr << "  load failed at (" << pos.x << ", " << pos.z << ")\n";
+            }
+        }
+    }
+    result.loadMs = loadTimer.elapsedMs() / loadRounds;
+    result.decompressMs = timeDecompression(columns, useDictionary ? &firstDictionary : nullptr,
+                                            loadRounds);
+
+    return result;
+}
+
+// Generate size x size columns and serialize them to CBOR
+std::vector<std::pair<ColumnPos, std::vector<uint8_t>>> generateCborColumns(
+        int32_t size, uint64_t seed, uint64_t& rawBytes) {
+    auto gen = makeDefaultWorldgen(seed);
+    World world;
+    std::vector<std::pair<ColumnPos, std::vector<uint8_t>>> columns;
+    rawBytes = 0;
+    for (ColumnPos pos : squareArea(size)) {
+        auto& column = world.getOrCreateColumn(pos);
+        gen->pipeline.generateColumn(column, world, *gen->biomeMap);
+    }
+    for (ColumnPos pos : squareArea(size)) {
+        auto cbor = ColumnSerializer::toCBOR(*world.getColumn(pos), pos.x, pos.z);
+        rawBytes += cbor.size();
+        columns.emplace_back(pos, std::move(cbor));
+    }
+    return columns;
+}
+
+int regionCompression(const BenchArgs& args) {
+    int32_t size = static_cast<int32_t>(args.getInt("size", 8));
+    uint64_t seed = static_cast<uint64_t>(args.getInt("seed", 42));
+    int loadRounds = static_cast<int>(args.getInt("rounds", 5));
+
+    uint64_t rawBytes = 0;
+    auto columns = generateCborColumns(size, seed, rawBytes);
+
+    auto tempDir = std::filesystem::temp_directory_path() / "finevox_bench_region";
+    std::filesystem::remove_all(tempDir);
+    ConfigManager::instance().init(tempDir / "bench.conf");
+    ConfigManager::instance().setCompressionEnabled(true);
+
+    std::cout << columns.size() << " generated columns, "
+              << rawBytes / 1024 << " KiB raw CBOR\n\n";
+    std::cout << std::left << std::setw(12) << "mode"
+              << std::right << std::setw(12) << "stored KiB"
+              << std::setw(9) << "ratio"
+              << std::setw(11) << "dict KiB"
+              << std::setw(11) << "save ms"
+              << std::setw(11) << "load ms"
+              << std::setw(13) << "load MB/s"
+              << std::setw(14) << "decomp MB/s" << "\n";
+
+    for (bool useDictionary : {false, true}) {
+        auto dir = tempDir / (useDictionary ? "dictionary" : "plain");
+        CompressionResult r = runCompressionMode(dir, columns, useDictionary, loadRounds);
+        double ratio = static_cast<double>(rawBytes) /
+                       static_cast<double>(r.storedBytes + r.dictionaryBytes);
+        double rawMb = static_cast<double>(rawBytes) / (1024.0 * 1024.0);
+        std::cout << std::left << std::setw(12) << (useDictionary ? "lz4+dict" : "lz4")
+                  << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(12) << static_cast<double>(r.storedBytes) / 1024.0
+                  << std::setw(9) << std::setprecision(2) << ratio
+                  << std::setw(11) << std::setprecision(1) << static_cast<double>(r.dictionaryBytes) / 1024.0
+                  << std::setw(11) << r.saveMs
+                  << std::setw(11) << r.loadMs
+                  << std::setw(13) << rawMb / (r.loadMs / 1000.0)
+                  << std::setw(14) << rawMb / (r.decompressMs / 1000.0) << "\n";
+    }
+
+    ConfigManager::instance().reset();
+    std::filesystem::remove_all(tempDir);
+    return 0;
+}
+
+// Stored size and encode/decode cost of each CompressionPolicy codec,
+// measured through RegionFile::saveColumnRaw/loadColumnRaw
+int regionCodecs(const BenchArgs& args) {
+    int32_t size = static_cast<int32_t>(args.getInt("size", 8));
+    uint64_t seed = static_cast<uint64_t>(args.getInt("seed", 42));
+    int loadRounds = static_cast<int>(args.getInt("rounds", 5));
+
+    uint64_t rawBytes = 0;
+    auto columns = generateCborColumns(size, seed, rawBytes);
+    double rawMb = static_cast<double>(rawBytes) / (1024.0 * 1024.0);
+
+    auto tempDir = std::filesystem::temp_directory_path() / "finevox_bench_codecs";
+    std::filesystem::remove_all(tempDir);
+    ConfigManager::instance().init(tempDir / "bench.conf");
+
+    struct Mode {
+        const char* name;
+        CompressionPolicy policy;
+    };
+    const Mode modes[] = {
+        {"none", CompressionPolicy{CompressionCodec::None}},
+        {"lz4", CompressionPolicy{CompressionCodec::LZ4}},
+        {"lz4hc-3", CompressionPolicy{CompressionCodec::LZ4HC, 3}},
+        {"lz4hc-9", CompressionPolicy{CompressionCodec::LZ4HC, 9}},
+        {"lz4hc-12", CompressionPolicy{CompressionCodec::LZ4HC, 12}},
+    };
+
+    std::cout << columns.size() << " generated columns, "
+              << rawBytes / 1024 << " KiB raw CBOR\n\n";
+    std::cout << std::left << std::setw(12) << "codec"
+              << std::right << std::setw(12) << "stored KiB"
+              << std::setw(9) << "ratio"
+              << std::setw(11) << "save ms"
+              << std::setw(12) << "save MB/s"
+              << std::setw(11) << "load ms"
+              << std::setw(12) << "load MB/s" << "\n";
+
+    for (const Mode& mode : modes) {
+        std::map<std::pair<int32_t, int32_t>, std::unique_ptr<RegionFile>> regions;
+        auto regionFor = [&](ColumnPos pos) -> RegionFile& {
+            RegionPos rp = RegionPos::fromColumn(pos);
+            auto& region = regions[{rp.rx, rp.rz}];
+            if (!region) {
+                region = std::make_unique<RegionFile>(tempDir / mode.name, rp);
+            }
+            return *region;
+        };
+
+        Stopwatch saveTimer;
+        for (const auto& [pos, cbor] : columns) {
+            regionFor(pos).saveColumnRaw(pos, cbor, mode.policy);
+        }
+        double saveMs = saveTimer.elapsedMs();
+
+        uint64_t storedBytes = 0;
+        for (const auto& [key, region] : regions) {
+            storedBytes += region->dataFileSize();
+        }
+
+        Stopwatch loadTimer;
+        for (int round = 0; round < loadRounds; ++round) {
+            for (const auto& [pos, cbor] : columns) {
+                if (regionFor(pos).loadColumnRaw(pos).size() != cbor.size()) {
+                    std::cerr << "  load failed at (" << pos.x << ", " << pos.z << ")\n";
+                }
+            }
+        }
+        double loadMs = loadTimer.elapsedMs() / loadRounds;
+
+        std::cout << std::left << std::setw(12) << mode.name
+                  << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(12) << static_cast<double>(storedBytes) / 1024.0
+                  << std::setw(9) << std::setprecision(2)
+                  << static_cast<double>(rawBytes) / static_cast<double>(storedBytes)
+                  << std::setw(11) << std::setprecision(1) << saveMs
+                  << std::setw(12) << rawMb / (saveMs / 1000.0)
+                  << std::setw(11) << loadMs
+                  << std::setw(12) << rawMb / (loadMs / 1000.0) << "\n";
+    }
+
+    ConfigManager::instance().reset();
+    std::filesystem::remove_all(tempDir);
+    return 0;
+}
+
+}  // namespace
+
+FINEVOX_BENCH_SCENARIO("region-compression",
+    "LZ4 vs LZ4+trained dictionary on generated terrain (--size N, --rounds N)",
+    regionCompression);
+
+FINEVOX_BENCH_SCENARIO("region-codecs",
+    "none vs LZ4 vs LZ4-HC levels on generated terrain (--size N, --rounds N)",
+    regionCodecs);
+
+}  // namespace finevox::bench
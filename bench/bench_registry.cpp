@@ -0,0 +1,238 @@
+/**
+ * @file bench_registry.cpp
+ * @brief Block registry and string interner lookup scenarios
+ */
+
+#include "bench.hpp"
+
+#include "finevox/core/block_handler.hpp"
+#include "finevox/core/block_type.hpp"
+#include "finevox/core/string_interner.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace finevox::bench {
+namespace {
+
+// The registry's previous lookups: types by id and handlers by name, both
+// behind a shared_mutex
+class LockedRegistry {
+public:
+    void add(BlockTypeId id, const BlockType& type, BlockHandler* handler) {
+        types_[id] = type;
+        if (handler) {
+            handlers_[std::string(id.name())] = handler;
+        }
+    }
+
+    const BlockType& getType(BlockTypeId id) const {
+        std::shared_lock lock(mutex_);
+        auto it = types_.find(id);
+        return it != types_.end() ? it->second : BlockRegistry::defaultType();
+    }
+
+    BlockHandler* getHandler(BlockTypeId id) {
+        std::unique_lock lock(mutex_);  // The old getHandler locked exclusively
+        auto it = handlers_.find(std::string(id.name()));
+        return it != handlers_.end() ? it->second : nullptr;
+    }
+
+private:
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<BlockTypeId, BlockType> types_;
+    std::unordered_map<std::string, BlockHandler*> handlers_;
+};
+
+class BenchNamed : public BlockHandler {
+public:
+    explicit BenchNamed(std::string name) : name_(std::move(name)) {}
+    [[nodiscard]] std::string_view name() const override { return name_; }
+
+private:
+    std::string name_;
+};
+
+// getType + getHandler per looked-up block, as processEvent does per event
+int registryLookup(const BenchArgs& args) {
+    int64_t typeCount = args.getInt("types", 500);
+    int64_t lookups = args.getInt("lookups", 5000000);
+
+    auto& registry = BlockRegistry::global();
+    LockedRegistry locked;
+    std::vector<BlockTypeId> ids;
+    for (int64_t i = 0; i < typeCount; ++i) {
+        std::string name = "bench:lookup_" + std::to_string(i);
+        BlockTypeId id = BlockTypeId::fromName(name);
+        BlockType type;
+        type.setLightEmission(static_cast<uint8_t>(i % 16));
+        registry.registerType(id, type);
+        BlockHandler* handler = nullptr;
+        if (i % 4 == 0) {
+            registry.registerHandler(name, std::make_unique<BenchNamed>(name));
+            handler = registry.getHandler(name);
+        }
+        locked.add(id, type, handler);
+        ids.push_back(id);
+    }
+
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<size_t> pick(0, ids.size() - 1);
+    std::vector<BlockTypeId> sequence(static_cast<size_t>(lookups));
+    for (auto& id : sequence) {
+        id = ids[pick(rng)];
+    }
+
+    auto run = [&](auto& lookup) {
+        uint64_t checksum = 0;
+        Stopwatch timer;
+        for (BlockTypeId id : sequence) {
+            checksum += lookup.getType(id).lightEmission();
+            checksum += lookup.getHandler(id) != nullptr ? 1 : 0;
+        }
+        return std::pair{timer.elapsedMs(), checksum};
+    };
+    auto [lockedMs, lockedSum] = run(locked);
+    auto [denseMs, denseSum] = run(registry);
+
+    std::cout << std::fixed << std::setprecision(1)
+              << typeCount << " types, " << lookups << " getType+getHandler pairs\n"
+              << "  map + lock:  " << lockedMs << " ms\n"
+              << "  dense table: " << denseMs << " ms ("
+              << std::setprecision(2) << lockedMs / denseMs << "x)\n";
+    return lockedSum == denseSum ? 0 : 1;
+}
+
+// The interner's previous storage: a vector and a map behind a shared_mutex
+class LockedInterner {
+public:
+    InternedId intern(std::string_view str) {
+        std::string key(str);
+        {
+            std::shared_lock lock(mutex_);
+            auto it = ids_.find(key);
+            if (it != ids_.end()) {
+                return it->second;
+            }
+        }
+        std::unique_lock lock(mutex_);
+        auto [it, inserted] = ids_.try_emplace(std::move(key), static_cast<InternedId>(strings_.size()));
+        if (inserted) {
+            strings_.emplace_back(str);
+        }
+        return it->second;
+    }
+
+    std::string_view lookup(InternedId id) const {
+        std::shared_lock lock(mutex_);
+        return id < strings_.size() ? std::string_view(strings_[id]) : std::string_view{};
+    }
+
+    std::optional<InternedId> find(std::string_view str) const {
+        std::shared_lock lock(mutex_);
+        auto it = ids_.find(std::string(str));
+        return it != ids_.end() ? std::optional(it->second) : std::nullopt;
+    }
+
+private:
+    mutable std::shared_mutex mutex_;
+    std::deque<std::string> strings_;  // Stable addresses, unlike the original vector
+    std::unordered_map<std::string, InternedId> ids_;
+};
+
+// Threads doing lookup() / find() / intern() on existing names, while one
+// extra thread interns a new name every 50us
+int internerContention(const BenchArgs& args) {
+    auto threads = static_cast<int>(args.getInt("threads", 4));
+    int64_t ops = args.getInt("ops", 2000000);
+    int64_t nameCount = args.getInt("names", 2000);
+
+    std::vector<std::string> names;
+    for (int64_t i = 0; i < nameCount; ++i) {
+        names.push_back("bench:interned_" + std::to_string(i));
+    }
+
+    auto run = [&](auto& interner, const std::string& prefix) {
+        std::vector<InternedId> ids;
+        for (const auto& name : names) {
+            ids.push_back(interner.intern(name));
+        }
+
+        std::atomic<bool> done{false};
+        std::thread writer([&] {
+            for (int i = 0; !done.load(std::memory_order_relaxed); ++i) {
+                (void)interner.intern(prefix + std::to_string(i));
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        });
+
+        std::atomic<uint64_t> checksum{0};
+        Stopwatch timer;
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                std::mt19937 rng(static_cast<uint32_t>(t + 1));
+                std::uniform_int_distribution<size_t> pick(0, names.size() - 1);
+                uint64_t sum = 0;
+                for (int64_t op = 0; op < ops; ++op) {
+                    size_t i = pick(rng);
+                    switch (op % 10) {
+                        case 0:
+                            sum += interner.intern(names[i]);
+                            break;
+                        case 1: case 2: case 3:
+                            sum += interner.find(names[i]).value_or(0);
+                            break;
+                        default:
+                            sum += interner.lookup(ids[i]).size();
+                            break;
+                    }
+                }
+                checksum.fetch_add(sum, std::memory_order_relaxed);
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        double ms = timer.elapsedMs();
+        done = true;
+        writer.join();
+        return std::pair{ms, checksum.load()};
+    };
+
+    LockedInterner locked;
+    auto [lockedMs, lockedSum] = run(locked, "bench:locked_new_");
+    auto [lockFreeMs, lockFreeSum] = run(StringInterner::global(), "bench:lockfree_new_");
+    (void)lockedSum;
+    (void)lockFreeSum;  // IDs differ between the two interners
+
+    double totalOps = static_cast<double>(ops) * threads;
+    std::cout << std::fixed << std::setprecision(1)
+              << threads << " reader threads + 1 writer, " << ops << " ops each, " << nameCount << " names\n"
+              << "  shared_mutex: " << lockedMs << " ms (" << totalOps / lockedMs / 1000.0 << " Mops/s)\n"
+              << "  lock-free:    " << lockFreeMs << " ms (" << totalOps / lockFreeMs / 1000.0 << " Mops/s, "
+              << std::setprecision(2) << lockedMs / lockFreeMs << "x)\n";
+    return 0;
+}
+
+}  // namespace
+
+FINEVOX_BENCH_SCENARIO("registry-lookup",
+    "BlockRegistry getType+getHandler: locked maps vs dense id table (--types N, --lookups N)",
+    registryLookup);
+
+FINEVOX_BENCH_SCENARIO("interner-contention",
+    "StringInterner lookup/find/intern under thread contention: shared_mutex vs lock-free (--threads N, --ops N, --names N)",
+    internerContention);
+
+}  // namespace finevox::bench
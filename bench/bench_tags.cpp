@@ -0,0 +1,127 @@
+/**
+ * @file bench_tags.cpp
+ * @brief Tag membership and recipe ingredient matching scenarios
+ */
+
+#include "bench.hpp"
+
+#include "finevox/core/item_match.hpp"
+#include "finevox/core/tag_registry.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace finevox::bench {
+namespace {
+
+// The registry's previous query index: member -> set of tags behind a shared_mutex
+class SetTagIndex {
+public:
+    void add(InternedId member, TagId tag) { memberToTags_[member].insert(tag); }
+
+    bool hasTag(InternedId member, TagId tag) const {
+        std::shared_lock lock(mutex_);
+        auto it = memberToTags_.find(member);
+        if (it == memberToTags_.end()) return false;
+        return it->second.contains(tag);
+    }
+
+private:
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<InternedId, std::unordered_set<TagId>> memberToTags_;
+};
+
+// Tagged ItemMatch evaluation: every recipe ingredient against candidate
+// items, as a crafting grid search does
+int itemMatch(const BenchArgs& args) {
+    int64_t itemCount = args.getInt("items", 20000);
+    int64_t tagCount = args.getInt("tags", 200);
+    int64_t membersPerTag = args.getInt("members", 2000);
+    int64_t ingredients = args.getInt("ingredients", 64);
+    int64_t candidates = args.getInt("candidates", 50000);
+
+    auto& registry = TagRegistry::global();
+    registry.clear();
+
+    std::vector<ItemTypeId> items;
+    for (int64_t i = 0; i < itemCount; ++i) {
+        items.push_back(ItemTypeId::fromName("bench:tag_item_" + std::to_string(i)));
+    }
+    std::vector<TagId> tags;
+    for (int64_t t = 0; t < tagCount; ++t) {
+        tags.push_back(TagId::fromName("bench:tag_" + std::to_string(t)));
+    }
+
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<size_t> pickItem(0, items.size() - 1);
+    std::uniform_int_distribution<size_t> pickTag(0, tags.size() - 1);
+    for (TagId tag : tags) {
+        for (int64_t m = 0; m < membersPerTag; ++m) {
+            registry.addMember(tag, items[pickItem(rng)]);
+        }
+    }
+    Stopwatch rebuildTimer;
+    registry.rebuild();
+    double rebuildMs = rebuildTimer.elapsedMs();
+
+    SetTagIndex sets;
+    for (TagId tag : tags) {
+        for (InternedId member : registry.getMembersOf(tag)) {
+            sets.add(member, tag);
+        }
+    }
+
+    std::vector<ItemMatch> recipe;
+    for (int64_t i = 0; i < ingredients; ++i) {
+        recipe.push_back(ItemMatch::tagged(tags[pickTag(rng)]));
+    }
+    std::vector<ItemTypeId> sequence(static_cast<size_t>(candidates));
+    for (auto& item : sequence) {
+        item = items[pickItem(rng)];
+    }
+
+    uint64_t setHits = 0;
+    Stopwatch setTimer;
+    for (ItemTypeId item : sequence) {
+        for (const ItemMatch& match : recipe) {
+            setHits += sets.hasTag(item.id, std::get<ItemMatch::Tagged>(match.match).tag) ? 1 : 0;
+        }
+    }
+    double setMs = setTimer.elapsedMs();
+
+    uint64_t bitsetHits = 0;
+    Stopwatch bitsetTimer;
+    for (ItemTypeId item : sequence) {
+        for (const ItemMatch& match : recipe) {
+            bitsetHits += match.matches(item) ? 1 : 0;
+        }
+    }
+    double bitsetMs = bitsetTimer.elapsedMs();
+
+    double checks = static_cast<double>(candidates * ingredients);
+    std::cout << std::fixed << std::setprecision(1)
+              << itemCount << " items, " << tagCount << " tags x " << membersPerTag << " members, "
+              << candidates << " candidates x " << ingredients << " ingredients\n"
+              << "  rebuild():      " << rebuildMs << " ms\n"
+              << "  set lookups:    " << setMs << " ms (" << checks / setMs / 1000.0 << " Mchecks/s)\n"
+              << "  tag bitsets:    " << bitsetMs << " ms (" << checks / bitsetMs / 1000.0 << " Mchecks/s, "
+              << std::setprecision(2) << setMs / bitsetMs << "x)\n";
+
+    registry.clear();
+    return setHits == bitsetHits ? 0 : 1;
+}
+
+}  // namespace
+
+FINEVOX_BENCH_SCENARIO("item-match",
+    "Tagged ItemMatch evaluation: member->tag sets vs compiled tag bitsets "
+    "(--items N, --tags N, --members N, --ingredients N, --candidates N)",
+    itemMatch);
+
+}  // namespace finevox::bench
@@ -0,0 +1,199 @@
+/**
+ * @file bench_terrain.cpp
+ * @brief Meshing and lighting scenarios over a synthetic terrain
+ */
+
+#include "bench.hpp"
+
+#include "finevox/core/block_type.hpp"
+#include "finevox/core/light_engine.hpp"
+#include "finevox/core/mesh.hpp"
+#include "finevox/core/world.hpp"
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace finevox::bench {
+namespace {
+
+struct TerrainTypes {
+    BlockTypeId stone;
+    BlockTypeId glass;
+    BlockTypeId leaves;
+    BlockTypeId torch;
+};
+
+TerrainTypes registerTerrainTypes() {
+    auto& registry = BlockRegistry::global();
+    TerrainTypes types{
+        BlockTypeId::fromName("bench:terrain_stone"),
+        BlockTypeId::fromName("bench:terrain_glass"),
+        BlockTypeId::fromName("bench:terrain_leaves"),
+        BlockTypeId::fromName("bench:terrain_torch")};
+
+    registry.registerType(types.stone, BlockType{});
+
+    BlockType glass;
+    glass.setOpaque(false).setTransparent(true).setLightAttenuation(1).setBlocksSkyLight(false);
+    registry.registerType(types.glass, glass);
+
+    BlockType leaves;
+    leaves.setOpaque(false).setTransparent(true).setLightAttenuation(2);
+    registry.registerType(types.leaves, leaves);
+
+    BlockType torch;
+    torch.setNoCollision().setOpaque(false).setLightEmission(14).setLightAttenuation(1).setBlocksSkyLight(false);
+    registry.registerType(types.torch, torch);
+    return types;
+}
+
+// Rolling stone terrain with glass and leaf patches near the surface and
+// one torch per column. Returns the torch positions.
+std::vector<BlockPos> buildTerrain(World& world, const TerrainTypes& types, int32_t size) {
+    std::vector<BlockPos> torches;
+    for (const ColumnPos& col : squareArea(size)) {
+        for (int32_t z = 0; z < 16; ++z) {
+            for (int32_t x = 0; x < 16; ++x) {
+                int32_t wx = col.x * 16 + x;
+                int32_t wz = col.z * 16 + z;
+                auto height = static_cast<int32_t>(
+                    24.0 + 6.0 * std::sin(wx * 0.11) + 5.0 * std::cos(wz * 0.07));
+                for (int32_t y = 0; y < height; ++y) {
+                    BlockTypeId type = types.stone;
+                    if (y >= height - 2 && (wx + wz) % 7 == 0) {
+                        type = types.glass;
+                    } else if (y == height - 1 && (wx * 3 + wz) % 5 == 0) {
+                        type = types.leaves;
+                    }
+                    world.setBlock(BlockPos{wx, y, wz}, type);
+                }
+                if (x == 8 && z == 8) {
+                    BlockPos torch{wx, height, wz};
+                    world.setBlock(torch, types.torch);
+                    torches.push_back(torch);
+                }
+            }
+        }
+    }
+    return torches;
+}
+
+// Sum fn(id) over every block of every loaded subchunk, `rounds` times
+template<typename Fn>
+std::pair<double, uint64_t> timeQueries(World& world, int64_t rounds, Fn&& fn) {
+    std::vector<const SubChunk*> subchunks;
+    for (const ChunkPos& pos : world.getAllSubChunkPositions()) {
+        subchunks.push_back(world.getSubChunk(pos));
+    }
+
+    uint64_t checksum = 0;
+    Stopwatch timer;
+    for (int64_t round = 0; round < rounds; ++round) {
+        for (const SubChunk* subchunk : subchunks) {
+            for (int32_t i = 0; i < SubChunk::VOLUME; ++i) {
+                checksum += fn(subchunk->getBlock(i));
+            }
+        }
+    }
+    return {timer.elapsedMs(), checksum};
+}
+
+void printQueryComparison(const char* what, std::pair<double, uint64_t> byType,
+                          std::pair<double, uint64_t> byTable) {
+    std::cout << std::fixed << std::setprecision(1)
+              << "  " << what << " via getType():        " << byType.first << " ms\n"
+              << "  " << what << " via property tables: " << byTable.first << " ms ("
+              << std::setprecision(2) << byType.first / byTable.first << "x)\n";
+}
+
+int lightPropagation(const BenchArgs& args) {
+    auto size = static_cast<int32_t>(args.getInt("size", 6));
+    int64_t rounds = args.getInt("rounds", 20);
+
+    TerrainTypes types = registerTerrainTypes();
+    World world;
+    std::vector<BlockPos> torches = buildTerrain(world, types, size);
+
+    LightEngine engine(world);
+    Stopwatch skyTimer;
+    for (const ColumnPos& col : squareArea(size)) {
+        engine.initializeSkyLight(col);
+    }
+    double skyMs = skyTimer.elapsedMs();
+
+    Stopwatch blockTimer;
+    for (const BlockPos& torch : torches) {
+        engine.propagateBlockLight(torch, 14);
+    }
+    double blockMs = blockTimer.elapsedMs();
+
+    // The three per-block queries the light BFS makes
+    const BlockRegistry& registry = BlockRegistry::global();
+    auto byType = timeQueries(world, rounds, [&](BlockTypeId id) {
+        const BlockType& type = registry.getType(id);
+        return type.lightAttenuation() + type.lightEmission() + (type.blocksSkyLight() ? 1u : 0u);
+    });
+    auto byTable = timeQueries(world, rounds, [&](BlockTypeId id) {
+        return registry.lightAttenuation(id) + registry.lightEmission(id) + (registry.blocksSkyLight(id) ? 1u : 0u);
+    });
+
+    std::cout << std::fixed << std::setprecision(1)
+              << size << "x" << size << " columns, " << world.getAllSubChunkPositions().size()
+              << " subchunks, " << torches.size() << " torches\n"
+              << "  sky light init:   " << skyMs << " ms\n"
+              << "  block light BFS:  " << blockMs << " ms\n";
+    printQueryComparison("light queries", byType, byTable);
+    return byType.second == byTable.second ? 0 : 1;
+}
+
+int meshBuild(const BenchArgs& args) {
+    auto size = static_cast<int32_t>(args.getInt("size", 6));
+    int64_t rounds = args.getInt("rounds", 20);
+
+    TerrainTypes types = registerTerrainTypes();
+    World world;
+    buildTerrain(world, types, size);
+
+    MeshBuilder builder;
+    BlockTextureProvider textures = [](BlockTypeId, Face) { return glm::vec4(0.0f, 0.0f, 1.0f, 1.0f); };
+    size_t vertices = 0;
+    Stopwatch meshTimer;
+    auto positions = world.getAllSubChunkPositions();
+    for (const ChunkPos& pos : positions) {
+        MeshData mesh = builder.buildSubChunkMesh(*world.getSubChunk(pos), pos, world, textures);
+        vertices += mesh.vertexCount();
+    }
+    double meshMs = meshTimer.elapsedMs();
+
+    // The per-block queries face culling and custom-mesh dispatch make
+    const BlockRegistry& registry = BlockRegistry::global();
+    auto byType = timeQueries(world, rounds, [&](BlockTypeId id) {
+        const BlockType& type = registry.getType(id);
+        return (type.isOpaque() ? 1u : 0u) + (type.isTransparent() ? 2u : 0u) + (type.hasCustomMesh() ? 4u : 0u);
+    });
+    auto byTable = timeQueries(world, rounds, [&](BlockTypeId id) {
+        return (registry.isOpaque(id) ? 1u : 0u) + (registry.isTransparent(id) ? 2u : 0u) +
+               (registry.hasCustomMesh(id) ? 4u : 0u);
+    });
+
+    std::cout << std::fixed << std::setprecision(1)
+              << size << "x" << size << " columns, " << positions.size() << " subchunks, "
+              << vertices << " vertices\n"
+              << "  mesh build:       " << meshMs << " ms\n";
+    printQueryComparison("mesh queries", byType, byTable);
+    return byType.second == byTable.second ? 0 : 1;
+}
+
+}  // namespace
+
+FINEVOX_BENCH_SCENARIO("light-propagation",
+    "Sky and block light over synthetic terrain, plus getType vs property-table queries (--size N, --rounds N)",
+    lightPropagation);
+
+FINEVOX_BENCH_SCENARIO("mesh-build",
+    "World-backed subchunk meshing over synthetic terrain, plus getType vs property-table queries (--size N, --rounds N)",
+    meshBuild);
+
+}  // namespace finevox::bench
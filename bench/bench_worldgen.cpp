@@ -0,0 +1,504 @@
+/**
+ * @file bench_worldgen.cpp
+ * @brief Noise sampling and world generation pass scenarios
+ */
+
+#include "bench.hpp"
+
+#include "finevox/core/chunk_column.hpp"
+#include "finevox/core/world.hpp"
+#include "finevox/worldgen/biome_map.hpp"
+#include "finevox/worldgen/feature_ore.hpp"
+#include "finevox/worldgen/feature_registry.hpp"
+#include "finevox/worldgen/generation_passes.hpp"
+#include "finevox/worldgen/noise_ops.hpp"
+#include "finevox/worldgen/pass_counters.hpp"
+#include "finevox/worldgen/schematic_paste.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace finevox::bench {
+namespace {
+
+using namespace finevox::worldgen;
+
+// Sample a column-sized 16 x height x 16 grid for each of `columns` columns,
+// once point by point through evaluate() and once through evaluateGrid()
+int noiseBatch(const BenchArgs& args) {
+    int32_t columns = static_cast<int32_t>(args.getInt("columns", 64));
+    int32_t height = static_cast<int32_t>(args.getInt("height", 64));
+    uint64_t seed = static_cast<uint64_t>(args.getInt("seed", 42));
+
+    struct Case {
+        const char* name;
+        std::unique_ptr<Noise2D> noise2;
+        std::unique_ptr<Noise3D> noise3;
+    };
+    std::vector<Case> cases;
+    cases.push_back({"perlin3d", nullptr, std::make_unique<PerlinNoise3D>(seed)});
+    cases.push_back({"simplex3d", nullptr, std::make_unique<OpenSimplex3D>(seed)});
+    cases.push_back({"cave fbm3d (3 oct)", nullptr, NoiseFactory::simplexFBM3D(seed, 3, 0.015f)});
+    cases.push_back({"perlin fbm3d (4 oct)", nullptr, NoiseFactory::perlinFBM3D(seed, 4)});
+    cases.push_back({"perlin2d", std::make_unique<PerlinNoise2D>(seed), nullptr});
+    cases.push_back({"simplex2d", std::make_unique<OpenSimplex2D>(seed), nullptr});
+    cases.push_back({"terrain fbm2d (6 oct)", NoiseFactory::simplexFBM(seed, 6, 0.002f), nullptr});
+    cases.push_back({"warped terrain", NoiseFactory::warpedTerrain(seed), nullptr});
+
+    std::cout << columns << " columns, 16x" << height << "x16 points per column for 3D, "
+              << "16x16 for 2D\n\n";
+    std::cout << std::left << std::setw(24) << "noise"
+              << std::right << std::setw(14) << "scalar Mpt/s"
+              << std::setw(14) << "batch Mpt/s"
+              << std::setw(10) << "speedup"
+              << std::setw(12) << "max diff" << "\n";
+
+    float sink = 0.0f;
+    for (const Case& c : cases) {
+        NoiseGrid3D grid3;
+        grid3.countY = c.noise3 ? height : 1;
+        NoiseGrid2D grid2;
+        size_t points = c.noise3 ? grid3.size() : grid2.size();
+        std::vector<float> scalar(points);
+        std::vector<float> batch(points);
+        float maxDiff = 0.0f;
+
+        double scalarMs = 0.0;
+        double batchMs = 0.0;
+        for (int32_t col = 0; col < columns; ++col) {
+            grid3.x0 = grid2.x0 = static_cast<float>(col * 16);
+            grid3.z0 = grid2.z0 = static_cast<float>(-col * 16);
+
+            Stopwatch scalarTimer;
+            size_t i = 0;
+            for (int32_t x = 0; x < 16; ++x) {
+                for (int32_t z = 0; z < 16; ++z) {
+                    float wx = grid3.x0 + static_cast<float>(x);
+                    float wz = grid3.z0 + static_cast<float>(z);
+                    if (c.noise3) {
+                        for (int32_t y = 0; y < grid3.countY; ++y) {
+                            scalar[i++] = c.noise3->evaluate(wx, static_cast<float>(y), wz);
+                        }
+                    } else {
+                        scalar[i++] = c.noise2->evaluate(wx, wz);
+                    }
+                }
+            }
+            scalarMs += scalarTimer.elapsedMs();
+
+            Stopwatch batchTimer;
+            if (c.noise3) {
+                c.noise3->evaluateGrid(grid3, batch);
+            } else {
+                c.noise2->evaluateGrid(grid2, batch);
+            }
+            batchMs += batchTimer.elapsedMs();
+
+            for (size_t k = 0; k < points; ++k) {
+                maxDiff = std::max(maxDiff, std::abs(scalar[k] - batch[k]));
+            }
+            sink += batch[0];
+        }
+
+        double total = static_cast<double>(points) * columns;
+        std::cout << std::left << std::setw(24) << c.name
+                  << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(14) << total / (scalarMs * 1000.0)
+                  << std::setw(14) << total / (batchMs * 1000.0)
+                  << std::setw(9) << scalarMs / batchMs << "x"
+                  << std::setw(12) << std::scientific << std::setprecision(1) << maxDiff
+                  << std::defaultfloat << "\n";
+    }
+
+    return std::isfinite(sink) ? 0 : 1;
+}
+
+// Default six-pass pipeline, serial, fresh world per round
+int worldgenPipeline(const BenchArgs& args) {
+    int32_t size = static_cast<int32_t>(args.getInt("size", 16));
+    int32_t rounds = static_cast<int32_t>(args.getInt("rounds", 3));
+    uint64_t seed = static_cast<uint64_t>(args.getInt("seed", 42));
+
+    auto gen = makeDefaultWorldgen(seed);
+    auto area = squareArea(size);
+    double bestMs = 0.0;
+    for (int32_t round = 0; round < rounds; ++round) {
+        World world;
+        Stopwatch timer;
+        for (ColumnPos pos : area) {
+            gen->pipeline.generateColumn(world.getOrCreateColumn(pos), world, *gen->biomeMap);
+        }
+        double ms = timer.elapsedMs();
+        bestMs = round == 0 ? ms : std::min(bestMs, ms);
+    }
+
+    double columns = static_cast<double>(area.size());
+    std::cout << std::fixed << std::setprecision(1)
+              << area.size() << " columns, best of " << rounds << ": "
+              << bestMs << " ms, " << columns * 1000.0 / bestMs << " columns/sec ("
+              << std::setprecision(3) << bestMs / columns << " ms/column)\n";
+    return 0;
+}
+
+// Default pipeline with profiling on: per-pass wall time, blocks written
+// and noise samples over a square of columns
+int worldgenProfile(const BenchArgs& args) {
+    int32_t size = static_cast<int32_t>(args.getInt("size", 16));
+    uint64_t seed = static_cast<uint64_t>(args.getInt("seed", 42));
+
+    auto gen = makeDefaultWorldgen(seed);
+    GenerationPipeline& pipeline = gen->pipeline;
+    pipeline.setProfiling(true);
+
+    World world;
+    auto area = squareArea(size);
+    Stopwatch timer;
+    for (ColumnPos pos : area) {
+        pipeline.generateColumn(world.getOrCreateColumn(pos), world, *gen->biomeMap);
+    }
+    double totalMs = timer.elapsedMs();
+
+    double passMs = 0.0;
+    for (size_t i = 0; i < pipeline.passCount(); ++i) {
+        passMs += static_cast<double>(pipeline.passProfile(i).nanoseconds.load()) / 1e6;
+    }
+
+    double columns = static_cast<double>(area.size());
+    std::cout << area.size() << " columns, " << std::fixed << std::setprecision(1)
+              << totalMs << " ms (" << columns * 1000.0 / totalMs << " columns/sec)\n\n";
+    std::cout << std::left << std::setw(20) << "pass"
+              << std::right << std::setw(10) << "ms"
+              << std::setw(8) << "share"
+              << std::setw(12) << "ms/column"
+              << std::setw(14) << "blocks/col"
+              << std::setw(14) << "noise/col" << "\n";
+    for (size_t i = 0; i < pipeline.passCount(); ++i) {
+        const auto& profile = pipeline.passProfile(i);
+        double ms = static_cast<double>(profile.nanoseconds.load()) / 1e6;
+        std::cout << std::left << std::setw(20) << pipeline.pass(i).name()
+                  << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << ms
+                  << std::setw(7) << 100.0 * ms / passMs << "%"
+                  << std::setprecision(3) << std::setw(12) << ms / columns
+                  << std::setprecision(0)
+                  << std::setw(14) << static_cast<double>(profile.blocksWritten.load()) / columns
+                  << std::setw(14) << static_cast<double>(profile.noiseSamples.load()) / columns
+                  << "\n";
+    }
+    std::cout << std::left << std::setw(20) << "(outside passes)"
+              << std::right << std::setprecision(1) << std::setw(10) << totalMs - passMs << "\n";
+    return 0;
+}
+
+// Run CavePass per block and with coarse lattice sampling over identical
+// terrain, timing the pass and comparing the carved blocks
+int caveSampling(const BenchArgs& args) {
+    int32_t size = static_cast<int32_t>(args.getInt("size", 8));
+    uint64_t seed = static_cast<uint64_t>(args.getInt("seed", 42));
+
+    auto gen = makeDefaultWorldgen(seed);
+    TerrainPass terrain(seed);
+    SurfacePass surface;
+    CavePass exactCaves(seed);
+    CavePass coarseCaves(seed, true);
+
+    World exactWorld;
+    World coarseWorld;
+    double shapeMs = 0.0;
+    double exactMs = 0.0;
+    double coarseMs = 0.0;
+    uint64_t carvable = 0;
+    uint64_t carvedExact = 0;
+    uint64_t carvedCoarse = 0;
+    uint64_t mismatched = 0;
+
+    for (ColumnPos pos : squareArea(size)) {
+        auto& exactColumn = exactWorld.getOrCreateColumn(pos);
+        auto& coarseColumn = coarseWorld.getOrCreateColumn(pos);
+        GenerationContext exactCtx{exactColumn, pos, exactWorld, *gen->biomeMap, seed, {}, {}};
+        GenerationContext coarseCtx{coarseColumn, pos, coarseWorld, *gen->biomeMap, seed, {}, {}};
+
+        Stopwatch shapeTimer;
+        terrain.generate(exactCtx);
+        surface.generate(exactCtx);
+        shapeMs += shapeTimer.elapsedMs();
+        terrain.generate(coarseCtx);
+        surface.generate(coarseCtx);
+        auto surfaceHeights = exactCtx.heightmap;
+
+        Stopwatch exactTimer;
+        exactCaves.generate(exactCtx);
+        exactMs += exactTimer.elapsedMs();
+
+        Stopwatch coarseTimer;
+        coarseCaves.generate(coarseCtx);
+        coarseMs += coarseTimer.elapsedMs();
+
+        for (int32_t lx = 0; lx < 16; ++lx) {
+            for (int32_t lz = 0; lz < 16; ++lz) {
+                int32_t top = surfaceHeights[GenerationContext::hmIndex(lx, lz)] - 2;
+                for (int32_t y = 1; y < top; ++y) {
+                    bool a = exactColumn.getBlock(lx, y, lz).isAir();
+                    bool b = coarseColumn.getBlock(lx, y, lz).isAir();
+                    ++carvable;
+                    carvedExact += a ? 1 : 0;
+                    carvedCoarse += b ? 1 : 0;
+                    mismatched += a != b ? 1 : 0;
+                }
+            }
+        }
+    }
+
+    double columns = static_cast<double>(size) * size;
+    auto pct = [&](uint64_t n) { return 100.0 * static_cast<double>(n) / static_cast<double>(carvable); };
+    std::cout << std::fixed << std::setprecision(3)
+              << size << "x" << size << " columns\n"
+              << "  per block: " << exactMs / columns << " ms/column\n"
+              << "  coarse:    " << coarseMs / columns << " ms/column ("
+              << std::setprecision(2) << exactMs / coarseMs << "x)\n"
+              << "  terrain + surface + caves: " << std::setprecision(2)
+              << (shapeMs + exactMs) / (shapeMs + coarseMs) << "x faster with coarse sampling\n"
+              << "  carved: " << pct(carvedExact) << "% per block, " << pct(carvedCoarse)
+              << "% coarse; " << pct(mismatched) << "% of carvable blocks differ\n";
+    return 0;
+}
+
+// Biomes + terrain parameters for a square of columns: per-point queries
+// (what TerrainPass did before) vs BiomeMap::sampleColumn
+int biomeGrid(const BenchArgs& args) {
+    int32_t size = static_cast<int32_t>(args.getInt("size", 32));
+    uint64_t seed = static_cast<uint64_t>(args.getInt("seed", 42));
+
+    auto gen = makeDefaultWorldgen(seed);
+    auto area = squareArea(size);
+    const BiomeMap& map = *gen->biomeMap;
+    float sink = 0.0f;
+
+    Stopwatch pointTimer;
+    for (ColumnPos pos : area) {
+        for (int32_t lx = 0; lx < 16; ++lx) {
+            for (int32_t lz = 0; lz < 16; ++lz) {
+                float x = static_cast<float>(pos.x * 16 + lx);
+                float z = static_cast<float>(pos.z * 16 + lz);
+                sink += map.getTerrainParams(x, z).first;
+                sink += static_cast<float>(map.getBiome(x, z).id);
+            }
+        }
+    }
+    double pointMs = pointTimer.elapsedMs();
+
+    double columns = static_cast<double>(area.size());
+    auto timeGrid = [&](int32_t step, double& samplesPerColumn) {
+        ColumnBiomeGrid grid;
+        uint64_t samplesBefore = PassCounters::current().noiseSamples;
+        Stopwatch timer;
+        for (ColumnPos pos : area) {
+            map.sampleColumn(pos, grid, step);
+            sink += grid.baseHeight[0];
+        }
+        double ms = timer.elapsedMs();
+        samplesPerColumn = static_cast<double>(PassCounters::current().noiseSamples - samplesBefore) / columns;
+        return ms;
+    };
+    double gridSamples = 0.0;
+    double coarseSamples = 0.0;
+    double gridMs = timeGrid(1, gridSamples);
+    double coarseMs = timeGrid(4, coarseSamples);
+
+    std::cout << std::fixed << std::setprecision(4)
+              << area.size() << " columns\n"
+              << "  per-point queries:    " << pointMs / columns << " ms/column\n"
+              << "  sampleColumn:         " << gridMs / columns << " ms/column ("
+              << std::setprecision(2) << pointMs / gridMs << "x)\n"
+              << std::setprecision(4)
+              << "  sampleColumn, step 4: " << coarseMs / columns << " ms/column ("
+              << std::setprecision(2) << pointMs / coarseMs << "x)\n"
+              << std::setprecision(1)
+              << "  Voronoi samples/column: " << gridSamples << " (step 1), "
+              << coarseSamples << " (step 4)\n"
+              << "  cell cache: " << map.stats().cellMisses.load() << " misses, "
+              << map.stats().cellHits.load() << " hits\n";
+    return std::isfinite(sink) ? 0 : 1;
+}
+
+// OrePass placing each vein through OreFeature::place() vs OreVeinBatch,
+// over identical terrain, with --ores extra ore types added to the demo set
+int orePlacement(const BenchArgs& args) {
+    int32_t size = static_cast<int32_t>(args.getInt("size", 8));
+    int32_t extraOres = static_cast<int32_t>(args.getInt("ores", 8));
+    int32_t rounds = static_cast<int32_t>(args.getInt("rounds", 5));
+    uint64_t seed = static_cast<uint64_t>(args.getInt("seed", 42));
+
+    auto gen = makeDefaultWorldgen(seed);
+    auto& features = FeatureRegistry::global();
+    auto* iron = dynamic_cast<OreFeature*>(features.getFeature("demo:iron_ore"));
+    if (!iron) {
+        std::cerr << "demo:iron_ore not loaded\n";
+        return 1;
+    }
+    for (int32_t i = 0; i < extraOres; ++i) {
+        OreConfig config = iron->config();
+        config.veinSize = 6 + (i % 4) * 2;
+        config.maxHeight = 64;
+        std::string name = "bench:ore_" + std::to_string(i);
+        features.registerFeature(std::make_shared<OreFeature>(name, config));
+        FeaturePlacement placement;
+        placement.featureName = name;
+        placement.density = 0.03f;
+        placement.maxHeight = 64;
+        features.addPlacement(placement);
+    }
+
+    TerrainPass terrain(seed);
+    SurfacePass surface;
+    auto area = squareArea(size);
+
+    // Best of rounds; terrain is regenerated untimed into a fresh world
+    auto run = [&](bool bulk, std::unique_ptr<World>& world) {
+        OrePass ores(bulk);
+        double bestMs = 0.0;
+        for (int32_t round = 0; round < rounds; ++round) {
+            world = std::make_unique<World>();
+            std::vector<std::unique_ptr<GenerationContext>> contexts;
+            for (ColumnPos pos : area) {
+                contexts.push_back(std::make_unique<GenerationContext>(GenerationContext{
+                    world->getOrCreateColumn(pos), pos, *world, *gen->biomeMap, seed, {}, {}}));
+                terrain.generate(*contexts.back());
+                surface.generate(*contexts.back());
+            }
+            Stopwatch timer;
+            for (auto& ctx : contexts) {
+                ores.generate(*ctx);
+            }
+            double ms = timer.elapsedMs();
+            bestMs = round == 0 ? ms : std::min(bestMs, ms);
+        }
+        return bestMs;
+    };
+    std::unique_ptr<World> perVeinWorld;
+    std::unique_ptr<World> bulkWorld;
+    double perVeinMs = run(false, perVeinWorld);
+    double bulkMs = run(true, bulkWorld);
+
+    uint64_t mismatched = 0;
+    for (ColumnPos pos : area) {
+        const ChunkColumn* a = perVeinWorld->getColumn(pos);
+        const ChunkColumn* b = bulkWorld->getColumn(pos);
+        for (int32_t y = 0; y < 128; ++y) {
+            for (int32_t lz = 0; lz < 16; ++lz) {
+                for (int32_t lx = 0; lx < 16; ++lx) {
+                    mismatched += a->getBlock(lx, y, lz) != b->getBlock(lx, y, lz) ? 1 : 0;
+                }
+            }
+        }
+    }
+
+    double columns = static_cast<double>(area.size());
+    std::cout << std::fixed << std::setprecision(4)
+              << area.size() << " columns, " << features.allPlacements().size() << " placements\n"
+              << "  per vein: " << perVeinMs / columns << " ms/column\n"
+              << "  bulk:     " << bulkMs / columns << " ms/column ("
+              << std::setprecision(2) << perVeinMs / bulkMs << "x)\n"
+              << "  mismatched blocks: " << mismatched << "\n";
+    return mismatched == 0 ? 0 : 1;
+}
+
+// Paste a size^3 structure (mixed types, ~70% solid) block by block through
+// World::setBlock, then through placeSchematic with 1 and N threads
+int schematicPaste(const BenchArgs& args) {
+    int32_t size = static_cast<int32_t>(args.getInt("size", 128));
+    auto threads = static_cast<size_t>(
+        args.getInt("threads", std::max(1u, std::thread::hardware_concurrency())));
+
+    Schematic schematic(size, size, size);
+    const char* types[] = {"bench:stone", "bench:brick", "bench:glass", "bench:planks"};
+    for (int32_t x = 0; x < size; ++x) {
+        for (int32_t z = 0; z < size; ++z) {
+            for (int32_t y = 0; y < size; ++y) {
+                if ((x * 7 + z * 3 + y) % 10 >= 3) {
+                    schematic.setBlock(x, y, z, types[(x / 8 + y / 4 + z / 8) % 4]);
+                }
+            }
+        }
+    }
+    BlockPos origin(-size / 2 + 3, 5, -size / 2 + 7);
+
+    World perBlockWorld;
+    Stopwatch perBlockTimer;
+    schematic.forEachBlock([&](glm::ivec3 pos, const BlockSnapshot& snap) {
+        perBlockWorld.setBlock(origin.x + pos.x, origin.y + pos.y, origin.z + pos.z,
+                               BlockTypeId::fromName(snap.typeName));
+    });
+    double perBlockMs = perBlockTimer.elapsedMs();
+
+    auto paste = [&](size_t threadCount, World& world) {
+        PlaceOptions options;
+        options.threads = threadCount;
+        Stopwatch timer;
+        placeSchematic(world, schematic, origin, options);
+        return timer.elapsedMs();
+    };
+    World singleWorld;
+    World parallelWorld;
+    double singleMs = paste(1, singleWorld);
+    double parallelMs = paste(threads, parallelWorld);
+
+    uint64_t mismatched = 0;
+    for (int32_t x = 0; x < size; ++x) {
+        for (int32_t z = 0; z < size; ++z) {
+            for (int32_t y = 0; y < size; ++y) {
+                BlockPos pos(origin.x + x, origin.y + y, origin.z + z);
+                BlockTypeId expected = perBlockWorld.getBlock(pos);
+                mismatched += singleWorld.getBlock(pos) != expected ? 1 : 0;
+                mismatched += parallelWorld.getBlock(pos) != expected ? 1 : 0;
+            }
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(1)
+              << size << "^3 schematic, " << schematic.nonAirBlockCount() << " blocks\n"
+              << "  per block:       " << perBlockMs << " ms\n"
+              << "  1 thread:        " << singleMs << " ms ("
+              << std::setprecision(2) << perBlockMs / singleMs << "x)\n"
+              << std::setprecision(1)
+              << "  " << threads << " threads:       " << parallelMs << " ms ("
+              << std::setprecision(2) << perBlockMs / parallelMs << "x)\n"
+              << "  mismatched blocks: " << mismatched << "\n";
+    return mismatched == 0 ? 0 : 1;
+}
+
+}  // namespace
+
+FINEVOX_BENCH_SCENARIO("noise-batch",
+    "Scalar evaluate() vs evaluateGrid() per noise type (--columns N, --height N)",
+    noiseBatch);
+
+FINEVOX_BENCH_SCENARIO("worldgen-pipeline",
+    "Default six-pass pipeline columns/sec, single thread (--size N, --rounds N)",
+    worldgenPipeline);
+
+FINEVOX_BENCH_SCENARIO("worldgen-profile",
+    "Per-pass time, blocks written and noise samples for the default pipeline (--size N)",
+    worldgenProfile);
+
+FINEVOX_BENCH_SCENARIO("biome-grid",
+    "Per-point biome/terrain queries vs BiomeMap::sampleColumn (--size N)",
+    biomeGrid);
+
+FINEVOX_BENCH_SCENARIO("ore-placement",
+    "OrePass per vein vs bulk OreVeinBatch, checked identical (--size N, --ores N, --rounds N)",
+    orePlacement);
+
+FINEVOX_BENCH_SCENARIO("cave-sampling",
+    "CavePass per block vs coarse 4x8x4 lattice: time and carved-block deviation (--size N)",
+    caveSampling);
+
+FINEVOX_BENCH_SCENARIO("schematic-paste",
+    "Schematic paste per block vs placeSchematic on 1 and N threads (--size N, --threads N)",
+    schematicPaste);
+
+}  // namespace finevox::bench
@@ -364,7 +364,8 @@ struct TickConfig {
     uint32_t gameTickIntervalMs = 50;
 
     /// Number of random tick attempts per subchunk per game tick
-    /// Each attempt selects a random block position
+    /// Each attempt selects a random block position; it becomes an event only
+    /// if that block's type has BlockType::wantsRandomTicks()
     /// Default: 3 (like Minecraft's randomTickSpeed)
     uint32_t randomTicksPerSubchunk = 3;
 
@@ -4,7 +4,7 @@
  * @file block_handler.hpp
  * @brief BlockContext and BlockHandler for event-driven block behavior
  *
- * Design: [24-event-system.md] §24.7 Handlers
+ * Design: [24-event-system.md] §24.7 Handlers, §24.15 Parallel Event Processing
  */
 
 #include "finevox/core/string_interner.hpp"
@@ -13,6 +13,7 @@
 #include "finevox/core/data_container.hpp"
 #include "finevox/core/block_type.hpp"
 #include <memory>
+#include <span>
 #include <string_view>
 #include <cstdint>
 
@@ -23,6 +24,8 @@ class World;
 class SubChunk;
 class BlockContext;
 class UpdateScheduler;
+struct BlockEvent;
+struct DeferredBlockEffects;
 
 // ============================================================================
 // TickType - Types of block tick events
@@ -63,6 +66,8 @@ inline bool operator&(TickType a, TickType b) {
  *
  * Thread safety: Handler methods may be called from multiple threads concurrently
  * for different blocks. Implementations must not use mutable instance state.
+ * Handlers that override isRegionSafe() are run on worker threads when the
+ * UpdateScheduler's parallel event mode is enabled.
  */
 class BlockHandler {
 public:
@@ -117,6 +122,28 @@ public:
         (void)type;
     }
 
+    /**
+     * @brief Whether tick events are delivered through onTickBatch()
+     *
+     * Default: false (one onTick() call per event).
+     */
+    [[nodiscard]] virtual bool wantsTickBatches() const { return false; }
+
+    /**
+     * @brief Called once for all pending ticks of one kind on blocks of this
+     * type within one subchunk
+     *
+     * Used instead of onTick() when wantsTickBatches() returns true. The
+     * UpdateScheduler collects these ticks while draining its inbox and
+     * delivers them after the round's other events. A block whose type
+     * changed in between goes to its new type's handler individually.
+     * Default: onTick() for each block.
+     *
+     * @param blocks One context per ticking block, in arrival order
+     * @param type Which type(s) of tick triggered this call
+     */
+    virtual void onTickBatch(std::span<BlockContext> blocks, TickType type);
+
     // ========================================================================
     // Neighbor Events
     // ========================================================================
@@ -197,6 +224,27 @@ public:
      * @param ctx Context providing access to block state and world
      */
     virtual void onRepaint(BlockContext& ctx) { (void)ctx; }
+
+    // ========================================================================
+    // Parallel Processing
+    // ========================================================================
+
+    /**
+     * @brief Whether this handler's events may run on a worker thread
+     *
+     * Return true only if every callback except onPlace/onBreak:
+     * - writes nothing but its own block, through BlockContext (setBlock,
+     *   setRotation, data, ...);
+     * - reads blocks no further away than ParallelEventConfig::margin;
+     * - emits follow-up work only through BlockContext (scheduleTick,
+     *   setRepeatTickInterval, pushEvent, notifyNeighbors), never through
+     *   UpdateScheduler or World directly.
+     *
+     * Such handlers run concurrently with handlers in other regions; their
+     * follow-up work is buffered and applied afterwards in a fixed order.
+     * Default: false (always run on the game thread).
+     */
+    [[nodiscard]] virtual bool isRegionSafe() const { return false; }
 };
 
 // ============================================================================
@@ -388,6 +436,15 @@ public:
      */
     void setRepeatTickInterval(int interval);
 
+    /**
+     * @brief Queue a follow-up event (e.g. a BlockUpdate for a neighbor)
+     *
+     * Equivalent to scheduler.outbox().push(event), but also safe from a
+     * region-safe handler running on a worker thread. No-op without a
+     * scheduler.
+     */
+    void pushEvent(const BlockEvent& event);
+
     // ========================================================================
     // Visual Updates
     // ========================================================================
@@ -418,7 +475,8 @@ public:
     /**
      * @brief Notify neighbors that this block changed
      *
-     * Triggers onNeighborChanged for all 6 adjacent blocks.
+     * Triggers onNeighborChanged for all 6 adjacent blocks. From a handler
+     * running in parallel, the notification is deferred to the game thread.
      */
     void notifyNeighbors();
 
@@ -467,6 +525,15 @@ public:
      */
     void setScheduler(UpdateScheduler* scheduler) { scheduler_ = scheduler; }
 
+    /**
+     * @brief Buffer follow-up work instead of applying it (called by UpdateScheduler)
+     *
+     * Set while a region-safe handler runs on a worker thread: scheduleTick(),
+     * setRepeatTickInterval(), pushEvent() and notifyNeighbors() append to
+     * effects, which the scheduler applies on the game thread afterwards.
+     */
+    void setDeferredEffects(DeferredBlockEffects* effects) { effects_ = effects; }
+
     // ========================================================================
     // Block Modification (for handlers to alter/undo placement)
     // ========================================================================
@@ -493,6 +560,9 @@ private:
 
     // Scheduler for tick scheduling (optional, set by UpdateScheduler)
     UpdateScheduler* scheduler_ = nullptr;
+
+    // Buffer for follow-up work while running in parallel (optional)
+    DeferredBlockEffects* effects_ = nullptr;
 };
 
 }  // namespace finevox
@@ -15,6 +15,7 @@
 #include <vector>
 #include <unordered_map>
 #include <shared_mutex>
+#include <atomic>
 #include <optional>
 #include <array>
 #include <memory>
@@ -84,6 +85,11 @@ public:
     /// Blocks with this enabled are auto-registered in per-subchunk registry
     BlockType& setWantsGameTicks(bool wants);
 
+    /// Set whether this block type wants random tick events
+    /// Subchunks containing such a type are sampled for random ticks; other
+    /// blocks never receive them
+    BlockType& setWantsRandomTicks(bool wants);
+
     /// Set whether this block has custom mesh geometry (non-cube)
     /// Blocks with custom meshes are excluded from greedy meshing
     BlockType& setHasCustomMesh(bool hasMesh);
@@ -130,6 +136,9 @@ public:
     /// Check if block wants game tick events
     [[nodiscard]] bool wantsGameTicks() const { return wantsGameTicks_; }
 
+    /// Check if block wants random tick events
+    [[nodiscard]] bool wantsRandomTicks() const { return wantsRandomTicks_; }
+
     /// Check if block has custom mesh geometry (non-cube)
     /// Custom mesh blocks are excluded from greedy meshing
     [[nodiscard]] bool hasCustomMesh() const { return hasCustomMesh_; }
@@ -152,6 +161,7 @@ private:
     uint8_t lightAttenuation_ = 15;  // Full attenuation by default (opaque)
     float hardness_ = 1.0f;          // Default mining difficulty
     bool wantsGameTicks_ = false;    // Wants game tick events (auto-registered)
+    bool wantsRandomTicks_ = false;  // Wants random tick events
     bool hasCustomMesh_ = false;     // Has custom geometry (excluded from greedy meshing)
     SoundSetId soundSet_;            // Sound set for this block type
 };
@@ -214,6 +224,56 @@ public:
     /// Get the air block type (no collision, no hit)
     [[nodiscard]] static const BlockType& airType();
 
+    // ========================================================================
+    // Property Lookups (hot paths)
+    // ========================================================================
+    //
+    // Same answers as getType(id).<property>(), read from flat per-property
+    // tables instead of the BlockType. Meant for inner loops (lighting BFS,
+    // mesh face culling, tick registration).
+
+    [[nodiscard]] bool isOpaque(BlockTypeId id) const {
+        const TablePage* page = tablePage(id);
+        return page ? page->flag(FLAG_OPAQUE, id.id) : getType(id).isOpaque();
+    }
+
+    [[nodiscard]] bool isTransparent(BlockTypeId id) const {
+        const TablePage* page = tablePage(id);
+        return page ? page->flag(FLAG_TRANSPARENT, id.id) : getType(id).isTransparent();
+    }
+
+    [[nodiscard]] bool blocksSkyLight(BlockTypeId id) const {
+        const TablePage* page = tablePage(id);
+        return page ? page->flag(FLAG_BLOCKS_SKY_LIGHT, id.id) : getType(id).blocksSkyLight();
+    }
+
+    [[nodiscard]] uint8_t lightAttenuation(BlockTypeId id) const {
+        const TablePage* page = tablePage(id);
+        return page ? page->attenuation[slotOf(id.id)].load(std::memory_order_relaxed)
+                    : getType(id).lightAttenuation();
+    }
+
+    [[nodiscard]] uint8_t lightEmission(BlockTypeId id) const {
+        const TablePage* page = tablePage(id);
+        return page ? page->emission[slotOf(id.id)].load(std::memory_order_relaxed)
+                    : getType(id).lightEmission();
+    }
+
+    [[nodiscard]] bool hasCustomMesh(BlockTypeId id) const {
+        const TablePage* page = tablePage(id);
+        return page ? page->flag(FLAG_CUSTOM_MESH, id.id) : getType(id).hasCustomMesh();
+    }
+
+    [[nodiscard]] bool wantsGameTicks(BlockTypeId id) const {
+        const TablePage* page = tablePage(id);
+        return page ? page->flag(FLAG_GAME_TICKS, id.id) : getType(id).wantsGameTicks();
+    }
+
+    [[nodiscard]] bool wantsRandomTicks(BlockTypeId id) const {
+        const TablePage* page = tablePage(id);
+        return page ? page->flag(FLAG_RANDOM_TICKS, id.id) : getType(id).wantsRandomTicks();
+    }
+
     // ========================================================================
     // Block Handler Registration
     // ========================================================================
@@ -279,6 +339,79 @@ private:
     mutable std::shared_mutex mutex_;
     std::unordered_map<BlockTypeId, BlockType> types_;
     std::unordered_map<std::string, HandlerEntry> handlers_;  // Keyed by name string
+
+    // ========================================================================
+    // Dense id-indexed table (lock-free reads)
+    // ========================================================================
+    //
+    // Interned ids are small and dense, so the id-keyed lookups read from
+    // pages of atomic pointers indexed by InternedId instead of the maps.
+    // Pages are allocated under mutex_ on first registration in their range
+    // and never freed or moved; entries point into types_ (stable nodes)
+    // and handlers_. Ids past TABLE_IDS fall back to the maps.
+    //
+    // Each page also keeps the hot BlockType properties as bitsets and byte
+    // arrays, written at registration. Slots without a registered type hold
+    // defaultType()'s values, so the accessors agree with getType().
+
+    static constexpr uint32_t TABLE_PAGE_BITS = 10;
+    static constexpr uint32_t TABLE_PAGE_SIZE = 1u << TABLE_PAGE_BITS;
+    static constexpr uint32_t TABLE_PAGES = 4096;
+    static constexpr uint32_t TABLE_IDS = TABLE_PAGES * TABLE_PAGE_SIZE;
+
+    enum TypeFlag : uint32_t {
+        FLAG_OPAQUE,
+        FLAG_TRANSPARENT,
+        FLAG_BLOCKS_SKY_LIGHT,
+        FLAG_CUSTOM_MESH,
+        FLAG_GAME_TICKS,
+        FLAG_RANDOM_TICKS,
+        FLAG_COUNT
+    };
+
+    static constexpr uint32_t FLAG_WORDS = TABLE_PAGE_SIZE / 64;
+
+    struct TablePage {
+        std::array<std::atomic<const BlockType*>, TABLE_PAGE_SIZE> types{};
+        std::array<std::atomic<BlockHandler*>, TABLE_PAGE_SIZE> handlers{};
+        std::array<std::atomic<bool>, TABLE_PAGE_SIZE> lazyHandlers{};  // Factory not run yet
+
+        // Property tables (relaxed: written once, before the id is in use)
+        std::array<std::array<std::atomic<uint64_t>, FLAG_WORDS>, FLAG_COUNT> flags{};
+        std::array<std::atomic<uint8_t>, TABLE_PAGE_SIZE> attenuation{};
+        std::array<std::atomic<uint8_t>, TABLE_PAGE_SIZE> emission{};
+
+        TablePage();
+
+        /// Copy type's hot properties into slot (caller holds mutex_ exclusively)
+        void setProperties(uint32_t slot, const BlockType& type);
+
+        [[nodiscard]] bool flag(TypeFlag which, InternedId id) const {
+            uint32_t slot = slotOf(id);
+            return (flags[which][slot >> 6].load(std::memory_order_relaxed) >> (slot & 63)) & 1;
+        }
+    };
+
+    std::array<std::atomic<TablePage*>, TABLE_PAGES> pages_{};
+    std::vector<std::unique_ptr<TablePage>> ownedPages_;
+
+    /// Page holding id, or nullptr if none was allocated (id < TABLE_IDS)
+    [[nodiscard]] const TablePage* findPage(InternedId id) const {
+        return pages_[id >> TABLE_PAGE_BITS].load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] static uint32_t slotOf(InternedId id) { return id & (TABLE_PAGE_SIZE - 1); }
+
+    /// Page holding id, or nullptr if it has none or is past TABLE_IDS
+    [[nodiscard]] const TablePage* tablePage(BlockTypeId id) const {
+        return id.id < TABLE_IDS ? findPage(id.id) : nullptr;
+    }
+
+    /// Page holding id, allocating it if needed. Caller holds mutex_ exclusively.
+    TablePage& pageFor(InternedId id);
+
+    /// Publish a handler entry (caller holds mutex_ exclusively)
+    void publishHandler(std::string_view name, BlockHandler* handler, bool lazy);
 };
 
 /**
@@ -160,6 +160,28 @@ public:
     /// Reset light initialization flag (e.g., after major terrain changes)
     void resetLightInitialized() { lightInitialized_ = false; }
 
+    // ========================================================================
+    // Generation Stage (resumable world generation)
+    // ========================================================================
+    // Priority of the last generation pass applied to this column, and how
+    // many passes of that priority were applied, so generation interrupted
+    // between passes can resume. Columns not built by the generator, and
+    // columns saved before stages were recorded, count as complete. A rank
+    // of 0 (saved before ranks were recorded) means every pass at the stage.
+
+    static constexpr int32_t GENERATION_NOT_STARTED = std::numeric_limits<int32_t>::min();
+    static constexpr int32_t GENERATION_COMPLETE = std::numeric_limits<int32_t>::max();
+
+    [[nodiscard]] int32_t generationStage() const { return generationStage_; }
+    [[nodiscard]] int32_t generationStageRank() const { return generationStageRank_; }
+    void setGenerationStage(int32_t stage, int32_t rank = 0) {
+        generationStage_ = stage;
+        generationStageRank_ = rank;
+    }
+    [[nodiscard]] bool isGenerationComplete() const {
+        return generationStage_ == GENERATION_COMPLETE;
+    }
+
     // ========================================================================
     // Column Extra Data (per-column game state)
     // ========================================================================
@@ -186,10 +208,15 @@ public:
 
     /// Rebuild game tick registries for all subchunks in this column
     /// Call this after loading a column from disk so that blocks with
-    /// wantsGameTicks() are properly registered.
+    /// wantsGameTicks() are properly registered. Also refreshes each
+    /// subchunk's random tick flags.
     /// Requires that all block type modules are already loaded.
     void rebuildGameTickRegistries();
 
+    /// Attach every subchunk (and any created later) to a RandomTickSet
+    /// nullptr detaches them. World attaches the columns it owns.
+    void setRandomTickSet(RandomTickSet* set);
+
     // ========================================================================
     // Activity Timer (for cross-chunk update unload protection)
     // ========================================================================
@@ -217,6 +244,7 @@ public:
 private:
     ColumnPos pos_;
     std::unordered_map<int32_t, std::shared_ptr<SubChunk>> subChunks_;
+    RandomTickSet* randomTickSet_ = nullptr;  // Owned by World; subchunks may outlive us
 
     // Heightmap: Y coordinate of highest sky-light-blocking block + 1 for each (x, z)
     // Index = z * 16 + x
@@ -229,6 +257,10 @@ private:
     // Used for lazy initialization - mesher can wait for this before building
     bool lightInitialized_ = false;
 
+    // See generationStage()
+    int32_t generationStage_ = GENERATION_COMPLETE;
+    int32_t generationStageRank_ = 0;
+
     // Column-level extra data (pending events, biome data, etc.)
     std::unique_ptr<DataContainer> data_;
 
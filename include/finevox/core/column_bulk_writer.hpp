@@ -0,0 +1,80 @@
+#pragma once
+
+/**
+ * @file column_bulk_writer.hpp
+ * @brief Batched block writes into a ChunkColumn for world generation
+ *
+ * Design: [05-world-management.md] §5.1.1 Bulk Writes
+ *
+ * ChunkColumn::setBlock() looks up the subchunk, the palette index, updates
+ * usage counts, bumps the block version and calls the change callback for
+ * every block. Generation writes whole runs and layers into columns nobody
+ * else can see yet, so ColumnBulkWriter writes palette indices directly and
+ * defers all bookkeeping to finish().
+ */
+
+#include "finevox/core/chunk_column.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace finevox {
+
+class ColumnBulkWriter {
+public:
+    /// Nothing else may modify column until finish() (or destruction).
+    /// Reading blocks in between is fine.
+    explicit ColumnBulkWriter(ChunkColumn& column);
+    ~ColumnBulkWriter();
+
+    ColumnBulkWriter(const ColumnBulkWriter&) = delete;
+    ColumnBulkWriter& operator=(const ColumnBulkWriter&) = delete;
+
+    /// Set one block (local x/z, world y)
+    void setBlock(int32_t localX, int32_t y, int32_t localZ, BlockTypeId type);
+
+    /// Set one block to type if it currently is expected (missing subchunks
+    /// read as air). Compares palette indices, no type lookup per block.
+    /// Keeps usage counts current, so subchunks only written this way are
+    /// not recounted by finish(). Returns whether the block was written.
+    bool replaceBlock(int32_t localX, int32_t y, int32_t localZ, BlockTypeId expected,
+                      BlockTypeId type);
+
+    /// Set a vertical run: y in [y0, y1) at local (x, z)
+    void fillRun(int32_t localX, int32_t localZ, int32_t y0, int32_t y1, BlockTypeId type);
+
+    /// Set all 256 blocks of each layer y in [y0, y1). Subchunks covered
+    /// completely are filled with SubChunk::fill().
+    void fillLayers(int32_t y0, int32_t y1, BlockTypeId type);
+
+    /// Blocks written so far (air writes where no subchunk exists don't count)
+    [[nodiscard]] uint64_t blocksWritten() const { return written_; }
+
+    /// Rebuild usage counts and palettes, bump block versions once per
+    /// touched subchunk and drop subchunks left empty. Called by the
+    /// destructor if not called explicitly.
+    void finish();
+
+private:
+    struct Slot {
+        SubChunk* subChunk = nullptr;
+        BlockTypeId lastType;                 ///< Palette lookup cache
+        SubChunk::LocalIndex lastIndex = 0;
+        BlockTypeId lastExpected;             ///< replaceBlock() lookup cache
+        SubChunk::LocalIndex lastExpectedIndex = 0;
+        bool recount = false;                 ///< Uncounted writes: endBulkWrite()
+    };
+
+    ChunkColumn& column_;
+    std::unordered_map<int32_t, Slot> slots_;  ///< Touched subchunks by chunk Y
+    int32_t lastChunkY_ = 0;
+    Slot* lastSlot_ = nullptr;
+    bool finished_ = false;
+    uint64_t written_ = 0;
+
+    /// Slot for chunkY; nullptr if the subchunk doesn't exist and create is false
+    Slot* slot(int32_t chunkY, bool create);
+    [[nodiscard]] static SubChunk::LocalIndex paletteIndex(Slot& slot, BlockTypeId type);
+};
+
+}  // namespace finevox
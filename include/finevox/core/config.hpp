@@ -29,6 +29,9 @@ class ConfigFile;
 //
 // Config file format (key: value pairs):
 //   compression.enabled: true
+//   compression.dictionary: false
+//   compression.codec: lz4
+//   compression.hc_level: 9
 //   debug.logging: false
 //   io.thread_count: 2
 //
@@ -71,6 +74,18 @@ public:
     [[nodiscard]] bool compressionEnabled() const;
     void setCompressionEnabled(bool enabled);
 
+    // Compress region data against a per-region trained LZ4 dictionary
+    [[nodiscard]] bool compressionDictionaryEnabled() const;
+    void setCompressionDictionaryEnabled(bool enabled);
+
+    // Codec for new writes: "lz4" (default), "lz4hc" or "none"
+    [[nodiscard]] std::string compressionCodec() const;
+    void setCompressionCodec(const std::string& codec);
+
+    // LZ4-HC level used when the codec is "lz4hc" (clamped to 3-12)
+    [[nodiscard]] int compressionHCLevel() const;
+    void setCompressionHCLevel(int level);
+
     // Debug settings
     [[nodiscard]] bool debugLogging() const;
     void setDebugLogging(bool enabled);
@@ -127,6 +142,9 @@ private:
 
     // Pre-interned config keys for fast access
     DataKey keyCompressionEnabled_ = 0;
+    DataKey keyCompressionDictionary_ = 0;
+    DataKey keyCompressionCodec_ = 0;
+    DataKey keyCompressionHCLevel_ = 0;
     DataKey keyDebugLogging_ = 0;
     DataKey keyIoThreadCount_ = 0;
     DataKey keyMaxOpenRegions_ = 0;
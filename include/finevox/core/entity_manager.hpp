@@ -21,6 +21,7 @@ namespace finevox {
 // Forward declarations
 class World;
 class UpdateScheduler;
+class TickProfiler;
 
 // ============================================================================
 // PlayerAuthority - Server-side tracking of player state for validation
@@ -206,6 +207,11 @@ public:
     void setValidationEnabled(bool enabled) { validationEnabled_ = enabled; }
     bool validationEnabled() const { return validationEnabled_; }
 
+    /**
+     * @brief Time tick() into profiler as EntityPhysics and SnapshotPublish (nullptr = off)
+     */
+    void setProfiler(TickProfiler* profiler) { profiler_ = profiler; }
+
     // ========================================================================
     // Physics Access
     // ========================================================================
@@ -233,6 +239,9 @@ private:
     float correctionThreshold_ = 0.1f;  // 10 cm
     bool validationEnabled_ = true;
 
+    // Optional phase timing (not owned)
+    TickProfiler* profiler_ = nullptr;
+
     // Entities pending removal (cleaned up at end of tick)
     std::vector<EntityId> pendingRemovals_;
 
@@ -4,12 +4,14 @@
  * @file event_queue.hpp
  * @brief Three-queue event architecture and UpdateScheduler
  *
- * Design: [24-event-system.md] §24.6 Three-Queue, §24.13 UpdateScheduler
+ * Design: [24-event-system.md] §24.6 Three-Queue, §24.13 UpdateScheduler,
+ *         §24.15 Parallel Event Processing, §24.16 Batched Tick Dispatch
  * Outbox consolidation: keyed by (BlockPos, EventType)
  */
 
 #include "finevox/core/block_event.hpp"
 #include "finevox/core/position.hpp"
+#include "finevox/core/tick_wheel.hpp"
 
 #include <unordered_map>
 #include <vector>
@@ -20,6 +22,7 @@
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
+#include <thread>
 
 namespace finevox {
 
@@ -27,6 +30,8 @@ namespace finevox {
 class World;
 class SubChunk;
 class BlockContext;
+class BlockHandler;
+class TickProfiler;
 
 // ============================================================================
 // EventOutbox - Staging area for handler-generated events with consolidation
@@ -59,7 +64,8 @@ public:
     /**
      * @brief Transfer all pending events to a vector (for inbox swap)
      *
-     * Clears the outbox after transfer.
+     * Events are appended in the order their (position, type) key was first
+     * pushed. Clears the outbox after transfer; its storage is kept.
      * @param inbox Vector to receive the events
      */
     void swapTo(std::vector<BlockEvent>& inbox);
@@ -67,42 +73,19 @@ public:
     /**
      * @brief Get number of pending events (after consolidation)
      */
-    [[nodiscard]] size_t size() const { return pending_.size(); }
+    [[nodiscard]] size_t size() const { return events_.size(); }
 
     /**
      * @brief Check if outbox is empty
      */
-    [[nodiscard]] bool empty() const { return pending_.empty(); }
+    [[nodiscard]] bool empty() const { return events_.empty(); }
 
     /**
      * @brief Clear all pending events
      */
-    void clear() { pending_.clear(); }
+    void clear();
 
 private:
-    // Key for outbox: (BlockPos, EventType)
-    // Different event types at same position are kept separate
-    struct EventKey {
-        BlockPos pos;
-        EventType type;
-
-        bool operator==(const EventKey& other) const {
-            return pos.x == other.pos.x && pos.y == other.pos.y &&
-                   pos.z == other.pos.z && type == other.type;
-        }
-    };
-
-    // Hash function for EventKey
-    struct EventKeyHash {
-        size_t operator()(const EventKey& key) const {
-            size_t h = std::hash<int32_t>{}(key.pos.x);
-            h ^= std::hash<int32_t>{}(key.pos.y) + 0x9e3779b9 + (h << 6) + (h >> 2);
-            h ^= std::hash<int32_t>{}(key.pos.z) + 0x9e3779b9 + (h << 6) + (h >> 2);
-            h ^= std::hash<uint8_t>{}(static_cast<uint8_t>(key.type)) + 0x9e3779b9 + (h << 6) + (h >> 2);
-            return h;
-        }
-    };
-
     /**
      * @brief Merge two events of the same type at the same position
      *
@@ -112,27 +95,68 @@ private:
      */
     static BlockEvent mergeEvents(const BlockEvent& existing, const BlockEvent& incoming);
 
-    std::unordered_map<EventKey, BlockEvent, EventKeyHash> pending_;
+    // Home slot of a (BlockPos, EventType) key: multiplicative hash, top bits
+    [[nodiscard]] size_t slotFor(const BlockPos& pos, EventType type) const;
+
+    // Double the slot table and re-index events_
+    void grow();
+
+    // Pending events in first-push order. Different event types at the same
+    // position are kept separate.
+    std::vector<BlockEvent> events_;
+
+    // Open-addressing index into events_, linear probing, at most half full.
+    // Each slot is (generation << 32) | index; a slot from an older
+    // generation is empty, so clear() does not touch the table.
+    std::vector<uint64_t> slots_;
+    uint32_t generation_ = 1;
+    int slotShift_ = 64;  // 64 - log2(slots_.size())
 };
 
 // ============================================================================
-// ScheduledTick - Entry in the scheduled tick priority queue
+// Parallel event processing
 // ============================================================================
 
 /**
- * @brief A scheduled tick for a specific block at a specific time
+ * @brief Settings for the opt-in region-partitioned event mode
  *
- * Used in a min-heap priority queue, ordered by targetTick.
+ * Space is cut into cubic regions of 16 << regionShift blocks, aligned to
+ * subchunks. Events whose block is at least `margin` blocks inside its region
+ * and whose handler is BlockHandler::isRegionSafe() run on worker threads,
+ * one region per worker at a time. Everything else runs on the game thread.
  */
-struct ScheduledTick {
-    BlockPos pos;
-    uint64_t targetTick;  // Game tick when this should fire
-    TickType type;        // Type of tick (Scheduled or Repeat)
-
-    // Min-heap ordering: earlier ticks first
-    bool operator>(const ScheduledTick& other) const {
-        return targetTick > other.targetTick;
-    }
+struct ParallelEventConfig {
+    bool enabled = false;
+
+    /// Worker threads, including the calling thread (0 = hardware concurrency)
+    size_t threads = 0;
+
+    /// Region edge is 16 << regionShift blocks (default 32)
+    int32_t regionShift = 1;
+
+    /// Events closer than this to a region face run on the game thread.
+    /// Must cover how far region-safe handlers read.
+    int32_t margin = 2;
+
+    /// Inbox batches smaller than this are processed serially
+    size_t minBatch = 256;
+};
+
+/**
+ * @brief Follow-up work buffered by a BlockContext while running in parallel
+ *
+ * Applied by the UpdateScheduler on the game thread, region by region.
+ */
+struct DeferredBlockEffects {
+    struct Tick {
+        BlockPos pos;
+        int ticksFromNow;
+        TickType type;
+    };
+
+    std::vector<Tick> ticks;
+    std::vector<BlockEvent> events;
+    std::vector<BlockPos> neighborNotifies;
 };
 
 // ============================================================================
@@ -148,7 +172,8 @@ struct ScheduledTick {
  * - Outbox: events generated by handlers (consolidating)
  *
  * Thread safety: External input methods are thread-safe. Event processing
- * must happen on a single thread.
+ * must be driven from a single thread; with ParallelEventConfig enabled it
+ * fans region-safe handlers out to worker threads internally.
  */
 class UpdateScheduler {
 public:
@@ -174,6 +199,25 @@ public:
      */
     [[nodiscard]] uint64_t currentTick() const { return currentTick_; }
 
+    /**
+     * @brief Enable or configure region-partitioned parallel event processing
+     *
+     * Off by default. When on, the final world depends only on the events,
+     * not on thread count or timing: the outbox keeps first-push order, each
+     * region runs its events in batch order, region results are merged in
+     * region-key order, and events that stay serial run in batch order.
+     */
+    void setParallelConfig(const ParallelEventConfig& config);
+
+    [[nodiscard]] const ParallelEventConfig& parallelConfig() const { return parallel_; }
+
+    /**
+     * @brief Time the stages of advanceGameTick() into profiler (nullptr = off)
+     *
+     * Records DeferredEvents, GameTicks, RandomTicks and ScheduledTicks.
+     */
+    void setProfiler(TickProfiler* profiler) { profiler_ = profiler; }
+
     // ========================================================================
     // Scheduled Ticks (called by BlockContext)
     // ========================================================================
@@ -190,7 +234,7 @@ public:
      * @brief Cancel all scheduled ticks for a block position
      *
      * Called when a block is broken to prevent orphaned ticks.
-     * Note: This is O(n) where n is total scheduled ticks - use sparingly.
+     * Cost is proportional to the ticks pending at pos, not the total.
      */
     void cancelScheduledTicks(BlockPos pos);
 
@@ -268,6 +312,12 @@ public:
     [[nodiscard]] size_t pendingEventCount() const;
     [[nodiscard]] size_t deferredEventCount() const;
 
+    /// Events handled on worker threads since construction (parallel mode)
+    [[nodiscard]] uint64_t parallelEventCount() const { return parallelEvents_; }
+
+    /// Tick events delivered through BlockHandler::onTickBatch since construction
+    [[nodiscard]] uint64_t batchedTickCount() const { return batchedTicks_; }
+
     // ========================================================================
     // Deferred Events (for cross-chunk updates to unloaded chunks)
     // ========================================================================
@@ -287,12 +337,12 @@ private:
     TickConfig config_;
     uint64_t currentTick_ = 0;
 
-    // Random number generator for random ticks
+    // Random number generator for random ticks (one draw per game tick)
     std::mt19937 rng_;
 
-    // Scheduled ticks priority queue (min-heap by targetTick)
-    std::priority_queue<ScheduledTick, std::vector<ScheduledTick>,
-                        std::greater<ScheduledTick>> scheduledTicks_;
+    // Scheduled ticks, indexed by target tick and by position
+    TickWheel scheduledTicks_;
+    std::vector<ScheduledTick> dueTicks_;  // Reused by processScheduledTicks
 
     // Three-queue architecture
     std::vector<BlockEvent> inbox_;
@@ -309,16 +359,85 @@ private:
     // Callback to request chunk loading
     std::function<void(ColumnPos)> chunkLoadCallback_;
 
+    // Region-partitioned processing (opt-in)
+    ParallelEventConfig parallel_;
+    uint64_t parallelEvents_ = 0;
+
+    // Worker threads for region batches, started on first use and kept until
+    // the config changes or the scheduler is destroyed. Each batch bumps
+    // jobGeneration_; every worker runs *job_ once and checks in.
+    std::vector<std::thread> workers_;
+    std::mutex workMutex_;
+    std::condition_variable workCv_;
+    std::condition_variable workDoneCv_;
+    const std::function<void()>* job_ = nullptr;
+    uint64_t jobGeneration_ = 0;
+    size_t workersRunning_ = 0;
+    bool stopWorkers_ = false;
+
+    // Optional phase timing (not owned)
+    TickProfiler* profiler_ = nullptr;
+
+    // Tick events for handlers with wantsTickBatches(), grouped by
+    // (subchunk, block type, tick type) in arrival order. The first
+    // tickBatchCount_ entries are live; the rest keep their capacity.
+    struct TickBatch {
+        ChunkPos chunkPos;
+        BlockTypeId blockType;
+        TickType tickType;
+        BlockHandler* handler;
+        std::vector<std::pair<BlockPos, LocalBlockPos>> blocks;
+    };
+    struct TickBatchKey {
+        ChunkPos chunkPos;
+        BlockTypeId blockType;
+        TickType tickType;
+
+        bool operator==(const TickBatchKey&) const = default;
+    };
+    struct TickBatchKeyHash {
+        size_t operator()(const TickBatchKey& key) const {
+            size_t h = std::hash<ChunkPos>{}(key.chunkPos);
+            h ^= std::hash<BlockTypeId>{}(key.blockType) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            h ^= static_cast<size_t>(key.tickType) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            return h;
+        }
+    };
+    std::vector<TickBatch> tickBatches_;
+    size_t tickBatchCount_ = 0;
+    size_t lastTickBatch_ = 0;  // Consecutive ticks usually share a batch
+    std::unordered_map<TickBatchKey, size_t, TickBatchKeyHash> tickBatchIndex_;
+    std::vector<BlockContext> batchContexts_;  // Reused by flushTickBatches
+    uint64_t batchedTicks_ = 0;
+
     // Process a single event (returns true if processed, false if deferred)
     bool processEvent(const BlockEvent& event);
 
+    // Process the whole inbox by region; returns the number of events
+    size_t processInboxParallel();
+
+    // Run job on the calling thread and every worker; returns when all are done
+    void runOnWorkers(size_t threads, const std::function<void()>& job);
+    void workerLoop(uint64_t seen);  // seen: generation current at start
+    void stopWorkers();
+
+    // Apply one region's buffered effects on the game thread
+    void applyDeferredEffects(DeferredBlockEffects& effects);
+
+    // Add a tick event to its batch (handler->wantsTickBatches() is true)
+    void queueTickBatch(const BlockEvent& event, BlockTypeId blockType, BlockHandler* handler);
+
+    // Deliver every queued batch through onTickBatch
+    void flushTickBatches();
+
     // Process deferred events whose chunks are now loaded
     void processDeferredEvents();
 
     // Generate game tick events for all registered blocks
     void generateGameTickEvents();
 
-    // Generate random tick events
+    // Generate random tick events for blocks whose type wants them, visiting
+    // only the subchunks in World::randomTickSet()
     void generateRandomTickEvents();
 
     // Process scheduled ticks that are due
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "finevox/core/game_actions.hpp"
+#include "finevox/core/tick_profiler.hpp"
 #include <memory>
 
 namespace finevox {
@@ -27,6 +28,7 @@ struct GameSessionConfig {
     float gravity = -14.0f;
     uint32_t tickRate = 20;           // TPS
     uint32_t randomTicksPerChunk = 3;
+    bool profileTicks = true;         // Per-phase tick timing (see tickProfile())
 };
 
 /// Owns all game state and provides the session boundary.
@@ -73,6 +75,12 @@ public:
     /// Check if game thread is running
     [[nodiscard]] bool isGameThreadRunning() const;
 
+    // === Tick Profiling (thread-safe) ===
+    /// Per-phase percentiles and skipped-tick count (empty if profileTicks is off)
+    [[nodiscard]] TickProfileSnapshot tickProfile() const;
+    /// The profiler itself, e.g. for setTraceCapacity() / writeChromeTrace()
+    TickProfiler& tickProfiler();
+
     // === Tick Processing (synchronous, for tests / backwards compat) ===
     /// Advance game state by dt seconds. Must NOT be called while game thread is running.
     void tick(float dt);
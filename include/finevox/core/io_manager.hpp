@@ -10,13 +10,18 @@
 #include "finevox/core/position.hpp"
 #include "finevox/core/chunk_column.hpp"
 #include "finevox/core/region_file.hpp"
+#include "finevox/core/lru_cache.hpp"
 #include <memory>
 #include <thread>
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
+#include <optional>
 #include <unordered_map>
+#include <unordered_set>
 #include <filesystem>
 
 namespace finevox {
@@ -31,8 +36,13 @@ class ColumnManager;
 // Manages background I/O operations for world persistence:
 // - Save thread processes dirty columns from ColumnManager
 // - Load thread handles async column loading requests
-// - Maintains open region files (LRU-cached)
+// - Maintains open region files (LRU-cached), and keeps parsed ToC indexes
+//   of recently closed regions so reopening them skips the .toc parse
+// - Reads ahead across region borders: a load on a region's edge also
+//   fetches the adjacent columns in the neighboring region
 // - Coordinates with ColumnManager to prevent save/load races
+// - Optionally recompresses cold regions (e.g. LZ4-HC) while the save
+//   thread is idle
 //
 // Thread safety: All public methods are thread-safe
 //
@@ -78,6 +88,10 @@ public:
     // Queue save with callback notification
     void queueSave(ColumnPos pos, const ChunkColumn& column, SaveCallback callback);
 
+    // Queue save with an explicit compression policy (instead of config)
+    void queueSave(ColumnPos pos, const ChunkColumn& column, const CompressionPolicy& policy,
+                   SaveCallback callback = nullptr);
+
     // Flush all pending saves (blocks until complete)
     void flush();
 
@@ -89,17 +103,59 @@ public:
     [[nodiscard]] size_t pendingLoadCount() const;
     [[nodiscard]] size_t pendingSaveCount() const;
     [[nodiscard]] size_t regionFileCount() const;
+    [[nodiscard]] size_t cachedIndexCount() const;
+
+    struct Stats {
+        std::atomic<uint64_t> regionOpens{0};       // RegionFile instances created
+        std::atomic<uint64_t> indexCacheHits{0};    // Opens that skipped the .toc parse
+        std::atomic<uint64_t> readAheadColumns{0};  // Columns fetched ahead of a request
+        std::atomic<uint64_t> readAheadHits{0};     // Loads served from read-ahead
+    };
+    [[nodiscard]] const Stats& stats() const { return stats_; }
 
     // Configuration
     void setMaxOpenRegions(size_t count);
+    void setMaxCachedIndexes(size_t count);  // 0 disables the index cache
+    void setReadAheadEnabled(bool enabled) { readAheadEnabled_ = enabled; }
+
+    // Rewrite open regions not accessed for idleTime with the given policy
+    // (typically CompressionPolicy::cold()). Runs on the save thread when it
+    // has nothing else to do, one region per idle period. A region that is
+    // saved to again goes back to the normal policy for new writes.
+    void setColdRegionRecompression(const CompressionPolicy& policy,
+                                    std::chrono::milliseconds idleTime);
+    void disableColdRegionRecompression();
+
+    // Recompress up to maxRegions cold regions now (blocking)
+    // Returns the number of columns rewritten
+    size_t recompressColdRegions(size_t maxRegions = SIZE_MAX);
 
 private:
     std::filesystem::path worldPath_;
 
+    // An open region file. RegionFile is not thread-safe, so the load and
+    // save threads lock the handle while using it.
+    struct RegionHandle {
+        std::mutex mutex;
+        std::unique_ptr<RegionFile> file;
+    };
+    using RegionHandlePtr = std::shared_ptr<RegionHandle>;
+
     // Region file cache
     mutable std::mutex regionMutex_;
-    std::unordered_map<uint64_t, std::unique_ptr<RegionFile>> regionFiles_;
-    size_t maxOpenRegions_ = 16;
+    LRUCache<uint64_t, RegionHandlePtr> regionFiles_{16};
+    // Evicted while a thread still held them; reused on reopen so a region
+    // never has two RegionFile instances at once
+    std::unordered_map<uint64_t, std::weak_ptr<RegionHandle>> retiredRegions_;
+    // Parsed indexes of closed regions
+    LRUCache<uint64_t, RegionIndex> regionIndexes_{256};
+    bool indexCacheEnabled_ = true;
+
+    // Cold region recompression (guarded by regionMutex_)
+    std::unordered_map<uint64_t, std::chrono::steady_clock::time_point> regionLastAccess_;
+    std::unordered_set<uint64_t> archivedRegions_;  // Already rewritten with coldPolicy_
+    std::optional<CompressionPolicy> coldPolicy_;
+    std::chrono::milliseconds coldIdleTime_{0};
 
     // Load queue
     struct LoadRequest {
@@ -115,11 +171,21 @@ private:
         ColumnPos pos;
         std::vector<uint8_t> serializedData;  // Pre-serialized CBOR
         SaveCallback callback;
+        std::optional<CompressionPolicy> policy;  // nullopt = from config
     };
     mutable std::mutex saveMutex_;
     std::condition_variable saveCond_;
     std::vector<SaveRequest> saveQueue_;
 
+    // Read-ahead: raw CBOR of columns across region borders, keyed by
+    // ColumnPos::pack(). Entries are dropped when the column is saved.
+    static constexpr size_t READ_AHEAD_CAPACITY = 64;
+    std::mutex readAheadMutex_;
+    LRUCache<uint64_t, std::vector<uint8_t>> readAhead_{READ_AHEAD_CAPACITY};
+    std::atomic<bool> readAheadEnabled_{true};
+
+    Stats stats_;
+
     // Threads
     std::thread loadThread_;
     std::thread saveThread_;
@@ -129,8 +195,11 @@ private:
     void loadThreadFunc();
     void saveThreadFunc();
 
-    RegionFile* getOrOpenRegion(RegionPos pos);
-    void evictOldestRegion();
+    [[nodiscard]] static uint64_t regionKey(RegionPos pos);
+    RegionHandlePtr getOrOpenRegion(RegionPos pos, bool forWrite = false);
+    void retireRegion(uint64_t key, RegionHandlePtr handle);  // Caller holds regionMutex_
+    void readAheadAcrossBorder(ColumnPos pos);
+    [[nodiscard]] std::optional<std::chrono::milliseconds> coldCheckInterval() const;
 };
 
 }  // namespace finevox
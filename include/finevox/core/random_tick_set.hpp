@@ -0,0 +1,58 @@
+#pragma once
+
+/**
+ * @file random_tick_set.hpp
+ * @brief Set of subchunks that contain random-tickable block types
+ *
+ * Design: [24-event-system.md] §24.14 Random Ticks
+ *
+ * Each World owns one RandomTickSet. A SubChunk attached to it adds its
+ * position when the first block of a type with BlockType::wantsRandomTicks()
+ * enters its palette and removes it when the last one leaves, so the
+ * UpdateScheduler only visits subchunks where a random tick can land.
+ *
+ * Positions are kept in a dense vector (swap-remove on erase), so iteration
+ * order depends only on the sequence of add/remove calls.
+ *
+ * Thread safety: all methods lock an internal mutex; membership changes are
+ * rare (palette transitions only), so contention is negligible.
+ */
+
+#include "finevox/core/position.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace finevox {
+
+class RandomTickSet {
+public:
+    /// Add pos (no-op if already present)
+    void add(ChunkPos pos);
+
+    /// Remove pos (no-op if absent)
+    void remove(ChunkPos pos);
+
+    [[nodiscard]] bool contains(ChunkPos pos) const;
+    [[nodiscard]] size_t size() const;
+
+    /// Call fn(ChunkPos) for every member while holding the set's lock.
+    /// fn must not add to or remove from this set.
+    template<typename Fn>
+    void forEach(Fn&& fn) const {
+        std::lock_guard lock(mutex_);
+        for (const ChunkPos& pos : positions_) {
+            fn(pos);
+        }
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<ChunkPos> positions_;
+    std::unordered_map<ChunkPos, uint32_t> slots_;  ///< Position -> index in positions_
+};
+
+}  // namespace finevox
@@ -16,6 +16,7 @@
 #include <optional>
 #include <set>
 #include <span>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -29,9 +30,81 @@ constexpr int32_t COLUMNS_PER_REGION = REGION_SIZE * REGION_SIZE;
 namespace ChunkFlags {
     constexpr uint32_t NONE = 0;
     constexpr uint32_t COMPRESSED_LZ4 = 1 << 0;  // Data is LZ4 compressed
-    // Reserved: bits 1-31 for future use
+    constexpr uint32_t LZ4_DICTIONARY = 1 << 1;  // LZ4 data was compressed against a region dictionary
+    constexpr uint32_t COMPRESSED_LZ4HC = 1 << 2;  // LZ4 data was encoded with LZ4-HC (decodes as LZ4)
+
+    // Bits 8-15: region dictionary id (only meaningful with LZ4_DICTIONARY)
+    constexpr uint32_t DICTIONARY_ID_SHIFT = 8;
+    constexpr uint32_t DICTIONARY_ID_MASK = 0xFFu << DICTIONARY_ID_SHIFT;
+    // Reserved: bits 3-7 and 16-31 for future use
+
+    [[nodiscard]] constexpr uint8_t dictionaryId(uint32_t flags) {
+        return static_cast<uint8_t>((flags & DICTIONARY_ID_MASK) >> DICTIONARY_ID_SHIFT);
+    }
+
+    [[nodiscard]] constexpr uint32_t withDictionaryId(uint32_t flags, uint8_t id) {
+        return (flags & ~DICTIONARY_ID_MASK) | (static_cast<uint32_t>(id) << DICTIONARY_ID_SHIFT);
+    }
+}
+
+// ============================================================================
+// Compression policy
+// ============================================================================
+
+enum class CompressionCodec : uint8_t {
+    None,   // Store raw CBOR
+    LZ4,    // LZ4 fast path (hot regions)
+    LZ4HC,  // LZ4-HC: slower encode, smaller output, same decode speed (cold regions)
+};
+
+[[nodiscard]] std::string_view compressionCodecName(CompressionCodec codec);
+[[nodiscard]] std::optional<CompressionCodec> compressionCodecFromName(std::string_view name);
+
+// Codec a chunk was written with, from its header flags
+[[nodiscard]] constexpr CompressionCodec chunkCodec(uint32_t flags) {
+    if (!(flags & ChunkFlags::COMPRESSED_LZ4)) return CompressionCodec::None;
+    return (flags & ChunkFlags::COMPRESSED_LZ4HC) ? CompressionCodec::LZ4HC : CompressionCodec::LZ4;
 }
 
+// How a single write is compressed
+struct CompressionPolicy {
+    static constexpr int HC_LEVEL_MIN = 3;
+    static constexpr int HC_LEVEL_DEFAULT = 9;
+    static constexpr int HC_LEVEL_MAX = 12;
+
+    CompressionCodec codec = CompressionCodec::LZ4;
+    int hcLevel = HC_LEVEL_DEFAULT;  // Only used by LZ4HC (clamped to 3-12)
+    bool useDictionary = false;      // Compress against the region dictionary
+
+    // Policy from ConfigManager (compression.enabled / .codec / .hc_level /
+    // .dictionary). Defaults to plain LZ4 if ConfigManager isn't initialized.
+    [[nodiscard]] static CompressionPolicy fromConfig();
+
+    // Archival policy for regions nobody is visiting
+    [[nodiscard]] static CompressionPolicy cold(int level = HC_LEVEL_MAX) {
+        return CompressionPolicy{CompressionCodec::LZ4HC, level, false};
+    }
+
+    // True if a chunk stored with these flags already satisfies this policy
+    [[nodiscard]] bool matches(uint32_t flags) const;
+
+    constexpr bool operator==(const CompressionPolicy&) const = default;
+};
+
+// LZ4 only looks back 64KB, so a larger dictionary is wasted space
+constexpr size_t LZ4_DICTIONARY_MAX_SIZE = 64 * 1024;
+
+// Number of columns a region buffers before training its first dictionary
+constexpr size_t DICTIONARY_TRAINING_SAMPLES = 16;
+
+// Build an LZ4 dictionary from sample payloads (typically raw column CBOR).
+// Picks the byte segments shared by the most samples (CBOR keys, palette
+// names, common light arrays), most valuable segments last since LZ4 keeps
+// the tail of an oversized dictionary. Deterministic for a given input.
+[[nodiscard]] std::vector<uint8_t> trainCompressionDictionary(
+    const std::vector<std::vector<uint8_t>>& samples,
+    size_t maxSize = LZ4_DICTIONARY_MAX_SIZE);
+
 // Region position (identifies which region file)
 struct RegionPos {
     int32_t rx = 0;
@@ -99,23 +172,50 @@ struct FreeSpan {
     }
 };
 
+// Parsed ToC state of a region file. IOManager keeps these after closing a
+// region so reopening it skips re-reading the .toc. Only trusted while the
+// .dat and .toc files still have the recorded sizes.
+struct RegionIndex {
+    std::unordered_map<uint32_t, TocEntry> entries;  // Local key -> latest entry
+    std::multiset<FreeSpan> freeSpans;
+    uint64_t datFileSize = 0;
+    uint64_t tocFileSize = 0;
+};
+
 // Region file manager - handles one 32x32 region
 //
 // File structure:
-//   r.{rx}.{rz}.dat - Chunk data (append-mostly)
-//   r.{rx}.{rz}.toc - Table of contents (journal-style)
+//   r.{rx}.{rz}.dat  - Chunk data (append-mostly)
+//   r.{rx}.{rz}.toc  - Table of contents (journal-style)
+//   r.{rx}.{rz}.dict - LZ4 dictionaries (optional, append-only)
 //
 // The ToC is append-only during normal operation. Each entry records
 // where a chunk is stored in the .dat file. Latest entry for each (x,z)
 // is authoritative. Periodic compaction removes obsolete entries.
 //
+// Dictionary compression (compression.dictionary config key): the region
+// buffers its first DICTIONARY_TRAINING_SAMPLES columns, trains a dictionary
+// from them, and compresses later writes against it. Dictionaries are never
+// rewritten, so every chunk that names a dictionary id stays readable.
+//
 class RegionFile {
 public:
     // Open or create a region file
     // basePath should be the regions directory (e.g., "world/regions/")
     explicit RegionFile(const std::filesystem::path& basePath, RegionPos pos);
+
+    // Open using an index captured earlier with captureIndex(), skipping the
+    // .toc parse. Falls back to parsing if the files changed since capture.
+    RegionFile(const std::filesystem::path& basePath, RegionPos pos, RegionIndex index);
+
     ~RegionFile();
 
+    // Snapshot the in-memory index for a later reopen (flushes first)
+    [[nodiscard]] RegionIndex captureIndex();
+
+    // True if this instance was opened from a RegionIndex without parsing
+    [[nodiscard]] bool indexReused() const { return indexReused_; }
+
     // Non-copyable, non-movable (owns file handles)
     RegionFile(const RegionFile&) = delete;
     RegionFile& operator=(const RegionFile&) = delete;
@@ -128,13 +228,29 @@ public:
 
     // Save pre-serialized column data (avoids double serialization)
     // The data should be CBOR-encoded column data
-    // Returns true on success
+    // Uses CompressionPolicy::fromConfig(); returns true on success
     bool saveColumnRaw(ColumnPos pos, std::span<const uint8_t> cborData);
 
+    // Save pre-serialized column data with an explicit compression policy
+    bool saveColumnRaw(ColumnPos pos, std::span<const uint8_t> cborData,
+                       const CompressionPolicy& policy);
+
     // Load a column
     // Returns nullptr if column doesn't exist or on error
     [[nodiscard]] std::unique_ptr<ChunkColumn> loadColumn(ColumnPos pos);
 
+    // Load a column's decompressed CBOR without deserializing it
+    // Returns empty if column doesn't exist or on error
+    [[nodiscard]] std::vector<uint8_t> loadColumnRaw(ColumnPos pos);
+
+    // Header flags of the stored column (nullopt if missing or unreadable)
+    [[nodiscard]] std::optional<uint32_t> columnFlags(ColumnPos pos);
+
+    // Rewrite every column not already stored per the given policy, then
+    // compact the ToC. Columns stored raw (compression didn't shrink them)
+    // are skipped. Returns the number of columns rewritten.
+    size_t recompress(const CompressionPolicy& policy);
+
     // Check if column exists in this region
     [[nodiscard]] bool hasColumn(ColumnPos pos) const;
 
@@ -148,6 +264,16 @@ public:
     // Call periodically or on close
     void compactToc();
 
+    // Register a compression dictionary (persisted to the .dict file).
+    // New dictionary-compressed writes use it from now on.
+    // Returns the assigned id (1-255), or nullopt if empty, ids are
+    // exhausted, or the write failed.
+    std::optional<uint8_t> addDictionary(std::vector<uint8_t> dictionary);
+
+    // Dictionary used for new writes (0 = none trained yet)
+    [[nodiscard]] uint8_t activeDictionaryId() const { return activeDictionary_; }
+    [[nodiscard]] size_t dictionaryCount() const { return dictionaries_.size(); }
+
     // Get region position
     [[nodiscard]] RegionPos position() const { return pos_; }
 
@@ -161,6 +287,7 @@ private:
     std::filesystem::path basePath_;
     std::filesystem::path datPath_;
     std::filesystem::path tocPath_;
+    std::filesystem::path dictPath_;
 
     std::fstream datFile_;
     std::fstream tocFile_;
@@ -174,11 +301,33 @@ private:
     // End of data file (for appending)
     uint64_t dataFileEnd_ = 0;
 
+    // Compression dictionaries by id, and the one used for new writes
+    std::unordered_map<uint8_t, std::vector<uint8_t>> dictionaries_;
+    uint8_t activeDictionary_ = 0;
+
+    // Highest id seen in the .dict file, including a truncated last entry,
+    // so a new dictionary never reuses it
+    uint8_t lastDictionaryId_ = 0;
+
+    // Bytes of the .dict file that parsed cleanly (0 = no usable header).
+    // Anything past this is an interrupted append and is cut off before the
+    // next one.
+    uint64_t dictValidSize_ = 0;
+
+    // Column payloads buffered until there are enough to train a dictionary
+    std::vector<std::vector<uint8_t>> trainingSamples_;
+
+    bool indexReused_ = false;
+
     // Convert local (x,z) to index key
     [[nodiscard]] static uint32_t localKey(int32_t lx, int32_t lz) {
         return static_cast<uint32_t>(lz * REGION_SIZE + lx);
     }
 
+    // Construct file paths, open files, and load the index (from cached
+    // if given and still valid, otherwise from the .toc)
+    void open(std::optional<RegionIndex> cached);
+
     // Open/create files
     bool openFiles();
 
@@ -188,6 +337,25 @@ private:
     // Append entry to ToC file
     bool appendTocEntry(const TocEntry& entry);
 
+    // Load dictionaries from the .dict file (missing file is not an error).
+    // Returns false on a corrupt or truncated file; the entries before the
+    // damage are still loaded.
+    bool loadDictionaries();
+
+    // Buffer a sample and train the first dictionary once enough are collected
+    void collectTrainingSample(std::span<const uint8_t> cborData);
+
+    // LZ4-compress with a 4-byte original-size prefix, optionally against a
+    // dictionary. hcLevel > 0 selects LZ4-HC. Returns empty on failure.
+    [[nodiscard]] static std::vector<uint8_t> compressLz4(std::span<const uint8_t> src,
+                                                          const std::vector<uint8_t>* dictionary,
+                                                          int hcLevel);
+
+    // Undo compressLz4 (or pass through uncompressed data) per chunk flags.
+    // Returns nullopt if the data is corrupt or its dictionary is missing.
+    [[nodiscard]] std::optional<std::vector<uint8_t>> decodeChunk(std::vector<uint8_t> data,
+                                                                  uint32_t flags) const;
+
     // Write chunk data to dat file at given offset
     // flags: ChunkFlags bitmask (e.g., COMPRESSED_LZ4)
     bool writeChunkData(uint64_t offset, const std::vector<uint8_t>& data, uint32_t flags = 0);
@@ -214,5 +382,7 @@ private:
 constexpr uint32_t DAT_CHUNK_MAGIC = 0x56584348;  // "VXCH"
 constexpr uint32_t TOC_MAGIC = 0x56585443;        // "VXTC"
 constexpr uint32_t TOC_VERSION = 1;
+constexpr uint32_t DICT_MAGIC = 0x56584443;       // "VXDC"
+constexpr uint32_t DICT_VERSION = 1;
 
 }  // namespace finevox
@@ -7,12 +7,15 @@
  * Design: [04-core-data-structures.md] §4.3 StringInterner
  */
 
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <vector>
-#include <unordered_map>
-#include <shared_mutex>
 #include <optional>
 
 namespace finevox {
@@ -28,6 +31,12 @@ constexpr InternedId UNKNOWN_INTERNED_ID = 2;  // Unknown - unrecognized block t
 // Thread-safe string interner for block type names
 // Strings are interned once and never removed (lifetime of engine)
 //
+// Append-only: lookup(), find() and the already-interned path of intern()
+// take no lock. Strings live in fixed-size chunks that never move, published
+// by an atomic count; the name-to-ID hash is an open-addressing table of
+// atomic slots, replaced (not resized in place) when it fills. Only adding a
+// new string takes a mutex.
+//
 // Usage:
 //   auto& interner = StringInterner::global();
 //   InternedId id = interner.intern("blockgame:stone");
@@ -54,16 +63,75 @@ public:
     // Get total number of interned strings (including reserved ID 0)
     [[nodiscard]] size_t size() const;
 
+    // Marks the current thread as running hot-path code (e.g. a world
+    // generation pass) for the scope's lifetime. intern() and find() calls
+    // made inside a scope are counted in hotPathLookups(): each hashes and
+    // compares the string, so hot loops should use pre-resolved IDs.
+    // Scopes nest.
+    class HotPathScope {
+    public:
+        HotPathScope();
+        ~HotPathScope();
+        HotPathScope(const HotPathScope&) = delete;
+        HotPathScope& operator=(const HotPathScope&) = delete;
+    };
+
+    // Number of intern()/find() calls made inside a HotPathScope (any thread)
+    [[nodiscard]] uint64_t hotPathLookups() const {
+        return hotPathLookups_.load(std::memory_order_relaxed);
+    }
+
     // Non-copyable, non-movable (singleton)
     StringInterner(const StringInterner&) = delete;
     StringInterner& operator=(const StringInterner&) = delete;
 
+    // Capacity: CHUNK_COUNT * CHUNK_SIZE strings (intern() throws
+    // std::length_error past it)
+    static constexpr uint32_t CHUNK_BITS = 10;
+    static constexpr uint32_t CHUNK_SIZE = 1u << CHUNK_BITS;
+    static constexpr uint32_t CHUNK_COUNT = 4096;
+
 private:
     StringInterner();
 
-    mutable std::shared_mutex mutex_;
-    std::vector<std::string> strings_;  // Index = ID, value = string
-    std::unordered_map<std::string, InternedId> lookup_;  // Fast reverse lookup (owns strings)
+    // ID -> string storage. Chunks are allocated under writeMutex_ and never
+    // freed or moved, so views returned by lookup() stay valid.
+    struct Chunk {
+        std::array<std::string, CHUNK_SIZE> strings;
+    };
+
+    // Name -> ID. Each slot holds (hash32 << 32) | (id + 1), or 0 if empty.
+    // Linear probing; a full table is copied into one twice the size and
+    // the old one is retired but kept alive for readers still probing it.
+    struct HashTable {
+        explicit HashTable(size_t capacity);
+
+        size_t mask;
+        std::unique_ptr<std::atomic<uint64_t>[]> slots;
+    };
+
+    std::array<std::atomic<Chunk*>, CHUNK_COUNT> chunks_{};
+    std::atomic<uint32_t> size_{0};
+    std::atomic<HashTable*> table_{nullptr};
+
+    // Owned storage and the writer lock (appends only)
+    std::mutex writeMutex_;
+    std::vector<std::unique_ptr<Chunk>> ownedChunks_;
+    std::vector<std::unique_ptr<HashTable>> tables_;
+    size_t tableEntries_ = 0;
+
+    mutable std::atomic<uint64_t> hotPathLookups_{0};
+
+    [[nodiscard]] std::string_view stringAt(InternedId id) const;
+    [[nodiscard]] std::optional<InternedId> probe(std::string_view str, uint32_t hash) const;
+
+    /// Append str as the next ID (caller holds writeMutex_)
+    InternedId append(std::string_view str, uint32_t hash);
+
+    /// Add an ID to the current table, growing it if needed (caller holds writeMutex_)
+    void insertEntry(uint64_t entry);
+
+    void noteLookup() const;
 };
 
 // Convenience wrapper for block type IDs
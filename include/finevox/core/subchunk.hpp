@@ -23,8 +23,9 @@
 
 namespace finevox {
 
-// Forward declaration
+// Forward declarations
 class DataContainer;
+class RandomTickSet;
 
 // Callback type for block change notifications
 // Parameters: subchunk position, local block position, old block type, new block type
@@ -104,6 +105,37 @@ public:
     // Fill entire subchunk with a single block type
     void fill(BlockTypeId type);
 
+    // ========================================================================
+    // Bulk Writes (world generation)
+    // ========================================================================
+    // Write palette indices straight into the block array. Usage counts,
+    // palette cleanup, the non-air count and the block version are only
+    // brought up to date by endBulkWrite(); the change callback is not
+    // called. Reads stay correct in between, but nothing else may modify the
+    // subchunk until endBulkWrite(). Used through ColumnBulkWriter.
+
+    /// Palette index for type, adding it to the palette if needed
+    [[nodiscard]] LocalIndex bulkPaletteIndex(BlockTypeId type) { return palette_.addType(type); }
+
+    /// Set y in [y0, y1) at local (x, z) to a palette index
+    void bulkSetRun(int32_t x, int32_t z, int32_t y0, int32_t y1, LocalIndex localIndex);
+
+    /// Set all 256 blocks of layers y in [y0, y1) to a palette index
+    void bulkSetLayers(int32_t y0, int32_t y1, LocalIndex localIndex);
+
+    /// Recount usage and non-air blocks, drop unused palette entries and bump
+    /// the block version once
+    void endBulkWrite();
+
+    /// Sparse variant: set one block (array index) and keep usage and non-air
+    /// counts current so nothing needs recounting. Entries whose usage drops
+    /// to zero stay in the palette, keeping indices valid, until endSparseWrite().
+    void bulkSetCounted(int32_t index, LocalIndex localIndex);
+
+    /// Drop palette entries bulkSetCounted() left unused and bump the block
+    /// version once. Only for subchunks that saw no uncounted bulk writes.
+    void endSparseWrite();
+
     // Get usage counts for each palette entry (for compaction)
     [[nodiscard]] std::vector<uint32_t> getUsageCounts() const { return usageCounts_; }
 
@@ -304,6 +336,30 @@ public:
     /// Check if a specific block is registered for game ticks
     [[nodiscard]] bool isRegisteredForGameTicks(int32_t index) const;
 
+    // ========================================================================
+    // Random Tick Tracking
+    // ========================================================================
+    // Tracked by palette membership rather than per block: an entry is flagged
+    // when its usage count rises from zero and its type wants random ticks.
+    // While any flagged entry is in use, the subchunk is in its RandomTickSet.
+
+    /// Whether any block here wants random ticks
+    [[nodiscard]] bool hasRandomTickBlocks() const { return randomTickTypes_ > 0; }
+
+    /// Whether the block at an array index wants random ticks (no registry lookup)
+    [[nodiscard]] bool wantsRandomTick(int32_t index) const {
+        LocalIndex localIndex = blocks_[index];
+        return localIndex < randomTickFlags_.size() && randomTickFlags_[localIndex] != 0;
+    }
+
+    /// Attach to a RandomTickSet (nullptr detaches), moving membership along
+    void setRandomTickSet(RandomTickSet* set);
+
+    /// Re-read every palette entry's flag from BlockRegistry
+    /// Called after bulk writes; call it too if types are registered after
+    /// blocks were placed
+    void rebuildRandomTickTypes();
+
     // ========================================================================
     // Change Notifications
     // ========================================================================
@@ -369,6 +425,11 @@ private:
     // O(1) insert/remove/lookup via hash set
     std::unordered_set<uint16_t> gameTickBlocks_;
 
+    // Random tick tracking: flag per palette index, count of flagged entries in use
+    std::vector<uint8_t> randomTickFlags_;
+    uint32_t randomTickTypes_ = 0;
+    RandomTickSet* randomTickSet_ = nullptr;
+
     // Convert local coordinates to array index
     [[nodiscard]] static constexpr int32_t toIndex(int32_t x, int32_t y, int32_t z) {
         return y * 256 + z * 16 + x;
@@ -396,6 +457,11 @@ private:
     void decrementUsage(LocalIndex oldIndex);
     void incrementUsage(LocalIndex newIndex);
 
+    // Update random tick membership when an entry comes into or out of use
+    void onPaletteEntryUsed(LocalIndex index);
+    void onPaletteEntryUnused(LocalIndex index);
+    void setRandomTickTypes(uint32_t count);
+
     // Internal setBlock implementation (no dirty tracking or callbacks)
     void setBlockInternal(int32_t index, BlockTypeId type, BlockTypeId oldType);
 };
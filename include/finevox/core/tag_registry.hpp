@@ -8,7 +8,10 @@
  *
  * Tags are applied to both items and blocks via raw InternedId.
  * Tag composition allows a tag to include other tags (transitive).
- * The resolved (transitive closure) state is computed by rebuild().
+ * The resolved (transitive closure) state is computed by rebuild(), which
+ * also compiles it for queries: each tag gets a bitset over member
+ * InternedIds (hasTag is a bit test), and each member a contiguous list of
+ * its tags (getTagsFor is a slice copy).
  *
  * Thread-safe singleton (shared_mutex).
  */
@@ -114,12 +117,21 @@ private:
                     std::unordered_set<TagId>& visiting,
                     std::unordered_set<TagId>& resolved);
 
+    /// Rebuild the compiled query tables from resolvedTags_ (caller holds mutex_)
+    void compile();
+
     mutable std::shared_mutex mutex_;
 
     std::unordered_map<TagId, RawTagData> rawTags_;
     std::unordered_map<TagId, ResolvedTagData> resolvedTags_;
-    std::unordered_map<InternedId, std::unordered_set<TagId>> memberToTags_;
     bool resolved_ = false;
+
+    // Compiled by rebuild(), all indexed directly by InternedId
+    static constexpr uint32_t NO_TAG_SLOT = UINT32_MAX;
+    std::vector<uint32_t> tagSlots_;                 ///< TagId.id -> index into tagBits_
+    std::vector<std::vector<uint64_t>> tagBits_;     ///< Member bitset per tag
+    std::vector<uint32_t> memberTagOffsets_;         ///< Member id -> start in memberTags_ (size + 1 entries)
+    std::vector<TagId> memberTags_;                  ///< Tags of each member, sorted by id
 };
 
 // ============================================================================
@@ -0,0 +1,190 @@
+#pragma once
+
+/**
+ * @file tick_profiler.hpp
+ * @brief Per-phase timing of the game thread's tick loop
+ *
+ * Design: [14-threading.md] §14.7 Game Thread Tick Profiling
+ *
+ * The game thread records how long each phase of a tick took (command
+ * draining, the parts of UpdateScheduler::advanceGameTick, event processing,
+ * entity physics, snapshot publishing). Each phase keeps a rolling window of
+ * recent durations, from which snapshot() computes percentiles. Ticks the
+ * loop gave up on after falling behind are counted separately.
+ *
+ * Optionally, the last N phase spans are kept for writeChromeTrace(), which
+ * emits the Trace Event Format read by chrome://tracing and Perfetto.
+ *
+ * Thread safety: all methods lock an internal mutex, so snapshot() and
+ * writeChromeTrace() may be called from any thread while the game thread
+ * records.
+ */
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace finevox {
+
+// ============================================================================
+// TickPhase
+// ============================================================================
+
+enum class TickPhase : uint8_t {
+    Commands,         ///< Draining and executing queued player commands
+    DeferredEvents,   ///< Retrying events for chunks that were not loaded
+    GameTicks,        ///< Game tick events for registered blocks
+    RandomTicks,      ///< Random tick generation
+    ScheduledTicks,   ///< Firing due scheduled ticks
+    EventProcessing,  ///< UpdateScheduler::processEvents after the tick
+    EntityPhysics,    ///< Entity AI, physics, transfers, validation
+    SnapshotPublish,  ///< Publishing entity snapshots to the graphics thread
+    Count
+};
+
+constexpr size_t TICK_PHASE_COUNT = static_cast<size_t>(TickPhase::Count);
+
+/// Short lower-case name ("commands", "game_ticks", ...)
+[[nodiscard]] const char* tickPhaseName(TickPhase phase);
+
+// ============================================================================
+// Snapshot
+// ============================================================================
+
+/// Durations over the rolling window, in milliseconds
+struct TickPhaseStats {
+    uint64_t samples = 0;  ///< Total recorded since the last reset
+    double meanMs = 0.0;
+    double p50Ms = 0.0;
+    double p95Ms = 0.0;
+    double p99Ms = 0.0;
+    double maxMs = 0.0;
+};
+
+struct TickProfileSnapshot {
+    std::array<TickPhaseStats, TICK_PHASE_COUNT> phases{};
+    TickPhaseStats tick;        ///< Whole game tick (beginTick to endTick)
+    uint64_t ticks = 0;         ///< Completed game ticks
+    uint64_t skippedTicks = 0;  ///< Ticks dropped by the catch-up limit
+
+    [[nodiscard]] const TickPhaseStats& operator[](TickPhase phase) const {
+        return phases[static_cast<size_t>(phase)];
+    }
+};
+
+// ============================================================================
+// TickProfiler
+// ============================================================================
+
+class TickProfiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t DEFAULT_WINDOW = 512;
+
+    /// @param window Recent samples per phase used for percentiles
+    explicit TickProfiler(size_t window = DEFAULT_WINDOW);
+
+    /// Times one phase from construction to destruction. A null profiler
+    /// makes it a no-op, so callers need not check.
+    class Scope {
+    public:
+        Scope(TickProfiler* profiler, TickPhase phase)
+            : profiler_(profiler), phase_(phase) {
+            if (profiler_) {
+                start_ = Clock::now();
+            }
+        }
+        ~Scope() {
+            if (profiler_) {
+                profiler_->record(phase_, start_, Clock::now());
+            }
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        TickProfiler* profiler_;
+        TickPhase phase_;
+        Clock::time_point start_;
+    };
+
+    /// Record one phase span
+    void record(TickPhase phase, Clock::time_point start, Clock::time_point end);
+
+    /// Bracket one game tick (the phases recorded in between belong to it)
+    void beginTick();
+    void endTick();
+
+    /// Count game ticks the loop skipped instead of running
+    void addSkippedTicks(uint64_t count);
+
+    [[nodiscard]] TickProfileSnapshot snapshot() const;
+
+    /// Clear all samples, counters and trace events
+    void reset();
+
+    // ========================================================================
+    // Chrome trace
+    // ========================================================================
+
+    /// Keep the most recent `events` spans for writeChromeTrace (0 = off, default)
+    void setTraceCapacity(size_t events);
+    [[nodiscard]] size_t traceCapacity() const;
+    [[nodiscard]] size_t traceEventCount() const;
+
+    /// Write retained spans as Trace Event Format JSON
+    void writeChromeTrace(std::ostream& out) const;
+
+    /// Write to a file; returns false if it could not be opened
+    bool writeChromeTrace(const std::string& path) const;
+
+private:
+    // Rolling window of durations in nanoseconds
+    struct Window {
+        std::vector<uint64_t> samples;
+        size_t next = 0;
+        uint64_t count = 0;
+
+        void add(uint64_t ns, size_t capacity);
+        /// Sorts samples in place, so call it on a copy
+        [[nodiscard]] TickPhaseStats summarize();
+    };
+
+    // Spans are tagged with a phase index; these mark the extra kinds
+    static constexpr uint8_t TRACE_TICK = TICK_PHASE_COUNT;
+    static constexpr uint8_t TRACE_SKIPPED = TICK_PHASE_COUNT + 1;
+
+    struct TraceEvent {
+        int64_t startUs;  ///< Since the profiler's epoch
+        int64_t durUs;
+        uint64_t tick;
+        uint64_t value;   ///< Skipped count for TRACE_SKIPPED
+        uint8_t kind;
+    };
+
+    mutable std::mutex mutex_;
+    size_t window_;
+    Clock::time_point epoch_;
+
+    std::array<Window, TICK_PHASE_COUNT> phases_;
+    Window tick_;
+    Clock::time_point tickStart_;
+    bool inTick_ = false;
+    uint64_t ticks_ = 0;
+    uint64_t skippedTicks_ = 0;
+
+    std::vector<TraceEvent> trace_;  // Ring buffer
+    size_t traceCapacity_ = 0;
+    size_t traceNext_ = 0;
+
+    void addTraceEvent(uint8_t kind, Clock::time_point start, Clock::time_point end, uint64_t value);
+};
+
+}  // namespace finevox
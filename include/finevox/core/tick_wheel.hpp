@@ -0,0 +1,135 @@
+#pragma once
+
+/**
+ * @file tick_wheel.hpp
+ * @brief Hierarchical timing wheel for scheduled block ticks
+ *
+ * Design: [24-event-system.md] §24.14 Scheduled Ticks
+ *
+ * TickWheel keeps scheduled ticks in four levels of slots keyed by target
+ * tick: 256 one-tick slots, then three levels of 64 slots, each slot 64
+ * times wider than the one below. Ticks beyond the last level wait in an
+ * overflow list. A tick is filed by how far away it is; when the wheel
+ * reaches the start of a wider slot, that slot's ticks are refiled one
+ * level down, so every tick reaches the one-tick level before it is due.
+ *
+ * Every tick is also linked into a per-position chain, making cancel() and
+ * contains() O(ticks at that position) instead of O(all ticks). Ticks due
+ * on the same game tick are returned in the order they were scheduled.
+ *
+ * Thread safety: NOT thread-safe, like the rest of the event loop.
+ */
+
+#include "finevox/core/block_event.hpp"
+#include "finevox/core/position.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace finevox {
+
+// ============================================================================
+// ScheduledTick - A tick due at a specific game tick
+// ============================================================================
+
+/**
+ * @brief A scheduled tick for a specific block at a specific time
+ */
+struct ScheduledTick {
+    BlockPos pos;
+    uint64_t targetTick;  // Game tick when this should fire
+    TickType type;        // Type of tick (Scheduled or Repeat)
+
+    // Ordering by target tick: earlier ticks first
+    bool operator>(const ScheduledTick& other) const {
+        return targetTick > other.targetTick;
+    }
+};
+
+// ============================================================================
+// TickWheel
+// ============================================================================
+
+class TickWheel {
+public:
+    /// Wheel starts having processed everything up to and including now
+    explicit TickWheel(uint64_t now = 0) : now_(now) {}
+
+    /// Schedule a tick. Targets at or before now() fire on the next advance.
+    void schedule(BlockPos pos, uint64_t targetTick, TickType type);
+
+    /// Remove every tick for pos. Returns how many were removed.
+    size_t cancel(BlockPos pos);
+
+    /// Whether pos has any tick pending
+    [[nodiscard]] bool contains(BlockPos pos) const { return byPos_.contains(pos); }
+
+    /// Advance to tick, appending every tick with targetTick <= tick to due
+    /// in target order, then scheduling order
+    void advanceTo(uint64_t tick, std::vector<ScheduledTick>& due);
+
+    /// Last tick processed by advanceTo()
+    [[nodiscard]] uint64_t now() const { return now_; }
+
+    [[nodiscard]] size_t size() const { return count_; }
+    [[nodiscard]] bool empty() const { return count_ == 0; }
+
+    void clear();
+
+private:
+    static constexpr uint32_t NIL = UINT32_MAX;
+
+    static constexpr int LEVEL0_BITS = 8;   // 256 one-tick slots
+    static constexpr int LEVEL_BITS = 6;    // 64 slots per upper level
+    static constexpr int UPPER_LEVELS = 3;
+    static constexpr uint32_t LEVEL0_SLOTS = 1u << LEVEL0_BITS;
+    static constexpr uint32_t LEVEL_SLOTS = 1u << LEVEL_BITS;
+    static constexpr uint32_t OVERFLOW_LIST = LEVEL0_SLOTS + UPPER_LEVELS * LEVEL_SLOTS;
+    static constexpr uint32_t LIST_COUNT = OVERFLOW_LIST + 1;
+
+    struct Node {
+        ScheduledTick tick;
+        uint64_t sequence;  ///< Scheduling order, for same-tick ordering
+        uint32_t list;      ///< Slot list holding this node
+        uint32_t prev, next;        ///< Slot list links (next is the free-list link when free)
+        uint32_t posPrev, posNext;  ///< Per-position chain links
+    };
+
+    struct List {
+        uint32_t head = NIL;
+        uint32_t tail = NIL;
+    };
+
+    uint64_t now_;
+    uint64_t nextSequence_ = 0;
+    size_t count_ = 0;
+
+    std::vector<Node> nodes_;
+    uint32_t freeHead_ = NIL;
+    std::array<List, LIST_COUNT> lists_{};
+    std::unordered_map<BlockPos, uint32_t> byPos_;  ///< Head of each position's chain
+
+    std::vector<uint32_t> scratch_;  ///< Refiled or fired nodes
+
+    /// Slot list for a target, from its distance to now_
+    [[nodiscard]] uint32_t listFor(uint64_t targetTick) const;
+
+    void link(uint32_t list, uint32_t node);
+    void unlink(uint32_t node);
+    void release(uint32_t node);  // Unlinks from the position chain and frees
+
+    /// Move every node of list into scratch_ and empty the list
+    void drain(uint32_t list);
+
+    /// Refile a level's slot at the wheel's current position
+    void cascade(uint32_t list);
+
+    /// Advance now_ by one, refile any slots that start there, and append
+    /// the one-tick slot's ticks to due
+    void step(std::vector<ScheduledTick>& due);
+};
+
+}  // namespace finevox
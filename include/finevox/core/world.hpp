@@ -13,6 +13,7 @@
 #include "finevox/core/subchunk.hpp"
 #include "finevox/core/mesh_rebuild_queue.hpp"
 #include "finevox/core/name_registry.hpp"
+#include "finevox/core/random_tick_set.hpp"
 #include <unordered_map>
 #include <memory>
 #include <shared_mutex>
@@ -121,6 +122,14 @@ public:
     // Get all subchunk positions that have data
     [[nodiscard]] std::vector<ChunkPos> getAllSubChunkPositions() const;
 
+    // Subchunks containing at least one block type that wants random ticks
+    // Maintained by the subchunks of every column this world owns
+    [[nodiscard]] const RandomTickSet& randomTickSet() const { return randomTickSet_; }
+
+    // Call callback for each subchunk in randomTickSet(), taking the column
+    // lock once. The callback must not add or remove blocks.
+    void forEachRandomTickSubChunk(const std::function<void(ChunkPos, SubChunk&)>& callback);
+
     // Clear entire world
     void clear();
 
@@ -237,6 +246,9 @@ public:
     [[nodiscard]] const NameRegistry& nameRegistry() const { return nameRegistry_; }
 
 private:
+    // Declared before columns_: column destructors detach from it
+    RandomTickSet randomTickSet_;
+
     mutable std::shared_mutex columnMutex_;
     std::unordered_map<uint64_t, std::unique_ptr<ChunkColumn>> columns_;
     ColumnGenerator columnGenerator_;
@@ -12,6 +12,7 @@
 
 #include "finevox/core/string_interner.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <optional>
 #include <shared_mutex>
@@ -69,17 +70,28 @@ struct BiomeProperties {
     float heightVariation = 16.0f;
     float heightScale = 1.0f;
 
-    // ---- Surface composition (block type names, resolved at generation time) ----
+    // ---- Surface composition (block type names) ----
     std::string surfaceBlock = "grass";
     std::string fillerBlock = "dirt";
     int32_t fillerDepth = 3;
     std::string stoneBlock = "stone";
     std::string underwaterBlock = "sand";
 
+    // ---- Resolved block IDs (filled by resolveBlockIds()) ----
+    // Generation passes read these instead of interning the names per block.
+    BlockTypeId surfaceBlockId;
+    BlockTypeId fillerBlockId;
+    BlockTypeId stoneBlockId;
+    BlockTypeId underwaterBlockId;
+
     // ---- Feature density multipliers ----
     float treeDensity = 0.0f;
     float oreDensity = 1.0f;
     float decorationDensity = 1.0f;
+
+    /// Intern the surface composition names into the *BlockId fields.
+    /// BiomeRegistry::registerBiome() calls this.
+    void resolveBlockIds();
 };
 
 // ============================================================================
@@ -87,11 +99,16 @@ struct BiomeProperties {
 // ============================================================================
 
 /// Thread-safe global registry of biome definitions
+///
+/// generation() changes whenever the registered set changes (register or
+/// clear). Consumers that cache data derived from biome properties, such as
+/// SurfacePass's resolved block table, compare it to rebuild after a reload.
 class BiomeRegistry {
 public:
     static BiomeRegistry& global();
 
-    /// Register a biome (thread-safe, typically called during module init)
+    /// Register a biome (thread-safe, typically called during module init).
+    /// Resolves the properties' block IDs; replaces any biome of that name.
     void registerBiome(std::string_view name, BiomeProperties properties);
 
     /// Get biome properties by ID (returns nullptr if not found)
@@ -109,6 +126,11 @@ public:
     /// Clear all registrations (for testing)
     void clear();
 
+    /// Bumped by every registerBiome() and clear()
+    [[nodiscard]] uint64_t generation() const {
+        return generation_.load(std::memory_order_acquire);
+    }
+
     /// Find the biome whose climate range best matches given temperature/humidity
     [[nodiscard]] BiomeId selectBiome(float temperature, float humidity) const;
 
@@ -117,6 +139,7 @@ private:
 
     mutable std::shared_mutex mutex_;
     std::unordered_map<BiomeId, BiomeProperties> biomes_;
+    std::atomic<uint64_t> generation_{0};
 };
 
 }  // namespace finevox::worldgen
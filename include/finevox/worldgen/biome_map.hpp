@@ -7,6 +7,12 @@
  * BiomeMap combines Voronoi tessellation with climate noise to assign
  * biomes to world positions. Supports blended queries for smooth
  * transitions at biome borders.
+ *
+ * Everything that depends only on the Voronoi cell (climate noise at its
+ * center, the selected biomes and their terrain parameters) is computed once
+ * per cell and kept in a small LRU shared by all threads, so neighboring
+ * columns generated concurrently reuse each other's cells. Per query only
+ * the nearest-center search and the border blend weight remain.
  */
 
 #pragma once
@@ -14,9 +20,14 @@
 #include "finevox/worldgen/biome.hpp"
 #include "finevox/worldgen/noise.hpp"
 #include "finevox/worldgen/noise_voronoi.hpp"
+#include "finevox/core/lru_cache.hpp"
+#include "finevox/core/position.hpp"
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 
 namespace finevox::worldgen {
 
@@ -27,14 +38,40 @@ struct BiomeBlend {
     float blendWeight = 0.0f;   ///< 0.0 = all primary, 1.0 = all secondary
 };
 
+/// Biomes and blended terrain parameters for the 16x16 blocks of a column,
+/// indexed like GenerationContext (localX * 16 + localZ)
+struct ColumnBiomeGrid {
+    std::array<BiomeId, 256> biomes{};
+    std::array<float, 256> baseHeight{};
+    std::array<float, 256> heightVariation{};
+};
+
 /// Spatial biome assignment from Voronoi cells + climate noise
 class BiomeMap {
 public:
+    struct Stats {
+        std::atomic<uint64_t> cellHits{0};    ///< Cell lookups served from the cache
+        std::atomic<uint64_t> cellMisses{0};  ///< Cells evaluated (climate noise + selection)
+    };
+
+    static constexpr size_t DEFAULT_CACHED_CELLS = 256;
+
     /// @param worldSeed Deterministic seed for all noise
     /// @param registry Biome registry to select from (must outlive BiomeMap)
     /// @param cellSize Voronoi cell size in blocks (default 256)
+    /// @param cachedCells Voronoi cells kept in the shared cache
     BiomeMap(uint64_t worldSeed, const BiomeRegistry& registry,
-             float cellSize = 256.0f);
+             float cellSize = 256.0f, size_t cachedCells = DEFAULT_CACHED_CELLS);
+
+    /// Biomes and terrain parameters for every block of column pos.
+    /// Biomes are always per block. With paramStep > 1 terrain parameters
+    /// are evaluated every paramStep blocks (the corners of paramStep-sized
+    /// squares, including the far column edge) and bilinearly interpolated in
+    /// between; paramStep must divide 16. Squares whose corners share a
+    /// Voronoi cell take its biome without a per-block search, so only
+    /// squares on a cell border cost more than their corners. paramStep 1
+    /// matches getBiome() and getTerrainParams() exactly.
+    void sampleColumn(ColumnPos pos, ColumnBiomeGrid& out, int32_t paramStep = 1) const;
 
     /// Get the primary biome at world position (x, z)
     [[nodiscard]] BiomeId getBiome(float x, float z) const;
@@ -52,15 +89,48 @@ public:
     /// Returns (baseHeight, heightVariation) blended by nearby biomes
     [[nodiscard]] std::pair<float, float> getTerrainParams(float x, float z) const;
 
+    [[nodiscard]] const Stats& stats() const { return stats_; }
+
 private:
+    /// Everything about a Voronoi cell that does not depend on the query point
+    struct CellInfo {
+        BiomeId primary;
+        BiomeId secondary;          ///< Perturbed-climate neighbor biome
+        bool hasPrimaryProps = false;
+        bool hasSecondaryProps = false;
+        float primaryBase = 0.0f;
+        float primaryVariation = 0.0f;
+        float secondaryBase = 0.0f;
+        float secondaryVariation = 0.0f;
+    };
+
+    /// One query point: its cell plus the point-dependent blend weight
+    struct Sample {
+        CellInfo cell;
+        float blendWeight = 0.0f;
+    };
+
     const BiomeRegistry& registry_;
     VoronoiNoise2D voronoi_;
     std::unique_ptr<Noise2D> temperatureNoise_;
     std::unique_ptr<Noise2D> humidityNoise_;
 
+    mutable std::mutex cellMutex_;
+    mutable LRUCache<uint64_t, CellInfo> cells_;
+    mutable uint64_t cellsGeneration_ = 0;  ///< BiomeRegistry::generation() the cache was built against
+    mutable Stats stats_;
+
     /// Get climate values at a Voronoi cell center
     [[nodiscard]] std::pair<float, float> cellClimate(
         float cellCenterX, float cellCenterZ) const;
+
+    /// Cached (or newly evaluated) info for the cell of a Voronoi result
+    [[nodiscard]] CellInfo cellInfo(const VoronoiResult& voronoi) const;
+    [[nodiscard]] CellInfo evaluateCell(const VoronoiResult& voronoi) const;
+
+    [[nodiscard]] float blendWeight(const VoronoiResult& voronoi) const;
+    [[nodiscard]] Sample sample(float x, float z) const;
+    [[nodiscard]] static std::pair<float, float> terrainParams(const Sample& sample);
 };
 
 }  // namespace finevox::worldgen
@@ -37,12 +37,16 @@ public:
     void clearAll();
 
     // ---- History ----
+    // Stored schematics are compacted first. The oldest entries are dropped
+    // once either the entry count or the memory budget is exceeded.
 
     void pushHistory(Schematic schematic);
     [[nodiscard]] const Schematic* historyAt(size_t index) const;
     [[nodiscard]] size_t historySize() const;
+    [[nodiscard]] size_t historyMemoryUsage() const;
     void clearHistory();
     void setMaxHistorySize(size_t max);
+    void setMaxHistoryMemory(size_t bytes);
 
 private:
     ClipboardManager() = default;
@@ -51,7 +55,11 @@ private:
     std::unique_ptr<Schematic> clipboard_;
     std::unordered_map<std::string, Schematic> namedClipboards_;
     std::deque<Schematic> history_;
-    size_t maxHistorySize_ = 10;
+    size_t historyBytes_ = 0;  ///< Sum of memoryUsage() over history_
+    size_t maxHistorySize_ = 64;
+    size_t maxHistoryBytes_ = size_t{256} << 20;
+
+    void trimHistory();  // mutex_ held
 };
 
 }  // namespace finevox::worldgen
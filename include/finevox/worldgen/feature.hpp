@@ -18,6 +18,7 @@
 #include <string_view>
 
 namespace finevox {
+class ChunkColumn;
 class World;
 }
 
@@ -41,12 +42,37 @@ enum class FeatureResult {
 // ============================================================================
 
 /// Context passed to Feature::place() with all information needed for placement
+///
+/// Features should access blocks through getBlock()/setBlock()/replaceBlock()
+/// rather than world. During generation, blocks of the column being generated
+/// are accessed directly (no World lock), and writes into other columns are
+/// queued in the generation's FeatureWriteBuffer when it has one. Queued
+/// writes land once the target column is final, so express "only if the
+/// block is X" with replaceBlock(), which re-checks at that point. Reads
+/// outside the generated column see the neighbor as it currently is.
 struct FeaturePlacementContext {
     World& world;
     BlockPos origin;                ///< Placement origin (usually surface position)
     BiomeId biome;
     uint64_t seed;                  ///< Per-placement deterministic seed
     GenerationContext* genCtx;      ///< Null for runtime placement
+
+    [[nodiscard]] BlockTypeId getBlock(BlockPos pos) const;
+
+    /// Write unconditionally
+    void setBlock(BlockPos pos, BlockTypeId type);
+
+    /// Write type where the block is currently expected. Returns false if the
+    /// block was checked and did not match; queued writes return true and are
+    /// checked when applied.
+    bool replaceBlock(BlockPos pos, BlockTypeId expected, BlockTypeId type);
+
+private:
+    /// Column being generated, if pos lies in it
+    [[nodiscard]] ChunkColumn* ownColumn(BlockPos pos) const;
+    /// Queue in the generation's write buffer; false if there is none or the
+    /// target column was already flushed
+    bool defer(BlockPos pos, BlockTypeId type, BlockTypeId expected, bool conditional);
 };
 
 // ============================================================================
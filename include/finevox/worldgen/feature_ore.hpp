@@ -11,6 +11,7 @@
 #include "finevox/core/string_interner.hpp"
 
 #include <string>
+#include <vector>
 
 namespace finevox::worldgen {
 
@@ -33,9 +34,61 @@ public:
     [[nodiscard]] FeatureResult place(FeaturePlacementContext& ctx) override;
     [[nodiscard]] BlockPos maxExtent() const override;
 
+    [[nodiscard]] const OreConfig& config() const { return config_; }
+
+    /// Append the positions place() would try, in order (none if origin is
+    /// outside the height range). Positions may repeat.
+    void veinPositions(BlockPos origin, uint64_t seed, std::vector<BlockPos>& out) const;
+
 private:
     std::string name_;
     OreConfig config_;
 };
 
+// ============================================================================
+// OreVeinBatch
+// ============================================================================
+
+/// Ore blocks of many veins, collected up front and applied together.
+/// Blocks inside the generating column are written by ColumnBulkWriter one
+/// subchunk at a time, comparing palette indices against each ore's
+/// replaceable block; the rest go through FeaturePlacementContext in vein
+/// order. The result equals calling place() on each vein in turn.
+class OreVeinBatch {
+public:
+    void clear() {
+        positions_.clear();
+        veins_.clear();
+    }
+
+    /// Queue the vein feature.place() would produce from origin and seed
+    void addVein(const OreFeature& feature, BlockPos origin, uint64_t seed);
+
+    /// Apply all queued veins. ctx supplies the world and, through genCtx,
+    /// the column written in bulk (without genCtx everything goes to the
+    /// world). Returns the number of blocks written or queued.
+    size_t apply(FeaturePlacementContext& ctx);
+
+    /// Queued block positions (one per vein step)
+    [[nodiscard]] size_t size() const { return positions_.size(); }
+
+private:
+    struct Vein {
+        BlockTypeId replace;
+        BlockTypeId ore;
+        uint32_t begin;  ///< Range in positions_
+        uint32_t end;
+    };
+    struct Pending {
+        uint32_t position;
+        uint32_t vein;
+    };
+
+    std::vector<BlockPos> positions_;
+    std::vector<Vein> veins_;
+    std::vector<Pending> inColumn_;      ///< Steps inside the generating column
+    std::vector<uint32_t> bucketStart_;  ///< Counting sort by subchunk
+    std::vector<Pending> sorted_;
+};
+
 }  // namespace finevox::worldgen
@@ -41,10 +41,10 @@ private:
     [[nodiscard]] int32_t trunkHeight(uint64_t seed) const;
 
     /// Check that the origin has suitable ground below
-    [[nodiscard]] bool checkSoil(World& world, BlockPos origin) const;
+    [[nodiscard]] bool checkSoil(const FeaturePlacementContext& ctx) const;
 
     /// Check that the trunk area is clear (air)
-    [[nodiscard]] bool checkClearance(World& world, BlockPos origin, int32_t height) const;
+    [[nodiscard]] bool checkClearance(const FeaturePlacementContext& ctx, int32_t height) const;
 };
 
 }  // namespace finevox::worldgen
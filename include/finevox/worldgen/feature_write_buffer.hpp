@@ -0,0 +1,104 @@
+/**
+ * @file feature_write_buffer.hpp
+ * @brief Deferred cross-column block writes from feature placement
+ *
+ * Design: [27-world-generation.md] Section 27.6.3
+ *
+ * A feature placed in one column may reach into its neighbors (leaf
+ * canopies, ore veins). Instead of writing those blocks through World while
+ * the neighbor is still being generated, FeaturePlacementContext queues them
+ * here under the target column. The queue for a column is applied in one go
+ * by flush() once nothing else will generate into it, in a fixed order
+ * (source column, then issue order), so the result does not depend on which
+ * thread placed which feature first.
+ */
+
+#pragma once
+
+#include "finevox/core/position.hpp"
+#include "finevox/core/string_interner.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace finevox {
+class ChunkColumn;
+}
+
+namespace finevox::worldgen {
+
+// ============================================================================
+// FeatureWriteBuffer
+// ============================================================================
+
+class FeatureWriteBuffer {
+public:
+    struct Stats {
+        std::atomic<uint64_t> buffered{0};   ///< Writes queued for a later flush
+        std::atomic<uint64_t> applied{0};    ///< Queued writes that changed a block
+        std::atomic<uint64_t> rejected{0};   ///< Conditional writes whose block no longer matched
+        std::atomic<uint64_t> columnsFlushed{0};
+    };
+
+    /// One queued block write
+    struct Write {
+        ColumnPos source;           ///< Column whose feature issued the write
+        uint32_t sequence = 0;      ///< Issue order within the source column
+        BlockPos pos;               ///< World block position (inside the target column)
+        BlockTypeId type;
+        BlockTypeId expected;       ///< Required current block when conditional
+        bool conditional = false;
+    };
+
+    /// Sees each write before add() queues it; returning true means the
+    /// router took the write (add() returns true without queueing it)
+    using Router = std::function<bool(const Write&)>;
+
+    FeatureWriteBuffer() = default;
+    FeatureWriteBuffer(const FeatureWriteBuffer&) = delete;
+    FeatureWriteBuffer& operator=(const FeatureWriteBuffer&) = delete;
+
+    /// Set before generation starts (not synchronized with add())
+    void setRouter(Router router) { router_ = std::move(router); }
+
+    /// Queue a write for the column containing write.pos. Returns false (and
+    /// queues nothing) if that column was already flushed; the caller then
+    /// writes directly.
+    bool add(const Write& write);
+
+    /// Remove and return every queued write, for targets that will never be
+    /// flushed here. Flushed marks are kept.
+    [[nodiscard]] std::vector<Write> takePending();
+
+    /// Forget column pos: drop its queued writes and its flushed mark.
+    /// Returns the number of writes dropped.
+    size_t discard(ColumnPos pos);
+
+    /// Apply and drop everything queued for column pos, ordered by (source,
+    /// sequence), and mark the column flushed so later writes go direct.
+    /// Returns the number of blocks changed.
+    size_t flush(ColumnPos pos, ChunkColumn& column);
+
+    /// Whether flush() has run for pos
+    [[nodiscard]] bool isFlushed(ColumnPos pos) const;
+
+    /// Writes queued across all columns
+    [[nodiscard]] size_t pendingWrites() const;
+
+    [[nodiscard]] const Stats& stats() const { return stats_; }
+
+private:
+    Router router_;
+    mutable std::mutex mutex_;
+    std::unordered_map<ColumnPos, std::vector<Write>> pending_;
+    std::unordered_set<ColumnPos> flushed_;
+    size_t pendingCount_ = 0;
+    Stats stats_;
+};
+
+}  // namespace finevox::worldgen
@@ -12,9 +12,12 @@
 
 #include "finevox/worldgen/world_generator.hpp"
 #include "finevox/worldgen/noise.hpp"
+#include "finevox/worldgen/noise_ops.hpp"
 #include "finevox/worldgen/feature_registry.hpp"
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 namespace finevox::worldgen {
 
@@ -24,7 +27,11 @@ namespace finevox::worldgen {
 
 class TerrainPass : public GenerationPass {
 public:
-    explicit TerrainPass(uint64_t worldSeed);
+    /// @param biomeParamStep Spacing of the biome terrain parameter samples
+    ///        (BiomeMap::sampleColumn); must divide 16. 1 samples every
+    ///        block, 4 samples a 5x5 lattice and interpolates (slightly
+    ///        smoother biome borders). Biomes themselves stay per block.
+    explicit TerrainPass(uint64_t worldSeed, int32_t biomeParamStep = 1);
 
     [[nodiscard]] std::string_view name() const override { return "core:terrain"; }
     [[nodiscard]] int32_t priority() const override {
@@ -36,6 +43,8 @@ private:
     std::unique_ptr<Noise2D> continentNoise_;   ///< Large-scale height
     std::unique_ptr<Noise2D> detailNoise_;      ///< Small-scale detail
     std::unique_ptr<Noise3D> densityNoise_;     ///< 3D density for overhangs
+    BlockTypeId stoneId_;                       ///< Resolved once at construction
+    int32_t biomeParamStep_;
 };
 
 // ============================================================================
@@ -44,11 +53,32 @@ private:
 
 class SurfacePass : public GenerationPass {
 public:
+    SurfacePass();
+
     [[nodiscard]] std::string_view name() const override { return "core:surface"; }
     [[nodiscard]] int32_t priority() const override {
         return static_cast<int32_t>(GenerationPriority::Surface);
     }
     void generate(GenerationContext& ctx) override;
+
+private:
+    /// Per-biome block IDs copied out of the registry's resolved properties
+    struct BiomeBlocks {
+        BlockTypeId surface;
+        BlockTypeId filler;
+        BlockTypeId stone;
+        int32_t fillerDepth = 0;
+    };
+    using BlockTable = std::unordered_map<BiomeId, BiomeBlocks>;
+
+    /// Current table, rebuilt when BiomeRegistry::generation() has moved on
+    /// since the last build (biomes registered, reloaded or cleared)
+    [[nodiscard]] std::shared_ptr<const BlockTable> blockTable();
+
+    BlockTypeId stoneId_;
+    std::mutex tableMutex_;
+    std::shared_ptr<const BlockTable> table_;
+    uint64_t tableGeneration_ = 0;
 };
 
 // ============================================================================
@@ -57,7 +87,10 @@ public:
 
 class CavePass : public GenerationPass {
 public:
-    explicit CavePass(uint64_t worldSeed);
+    /// @param coarseSampling Sample the cheese cave noise on a 4x8x4 lattice
+    ///        and interpolate (CoarseDensitySampler) instead of per block.
+    ///        Faster; cavern outlines shift slightly (Section 27.2.8).
+    explicit CavePass(uint64_t worldSeed, bool coarseSampling = false);
 
     [[nodiscard]] std::string_view name() const override { return "core:caves"; }
     [[nodiscard]] int32_t priority() const override {
@@ -68,6 +101,7 @@ public:
 private:
     std::unique_ptr<Noise3D> cheeseNoise_;      ///< Large caverns
     std::unique_ptr<Noise3D> spaghettiNoise_;   ///< Tunnel-like caves
+    std::unique_ptr<CoarseDensitySampler> cheeseSampler_;  ///< Set with coarseSampling
 };
 
 // ============================================================================
@@ -76,11 +110,21 @@ private:
 
 class OrePass : public GenerationPass {
 public:
+    /// @param bulk Collect every vein of the column first and apply them with
+    ///        OreVeinBatch (palette-index writes per subchunk). Same blocks
+    ///        as placing each vein through OreFeature::place().
+    explicit OrePass(bool bulk = true) : bulk_(bulk) {}
+
     [[nodiscard]] std::string_view name() const override { return "core:ores"; }
     [[nodiscard]] int32_t priority() const override {
         return static_cast<int32_t>(GenerationPriority::Ores);
     }
     void generate(GenerationContext& ctx) override;
+    /// Veins random-walk across column borders through World
+    [[nodiscard]] bool needsNeighbors() const override { return true; }
+
+private:
+    bool bulk_;
 };
 
 // ============================================================================
@@ -0,0 +1,169 @@
+/**
+ * @file generation_scheduler.hpp
+ * @brief Multi-threaded column generation with neighbor dependencies
+ *
+ * Design: [27-world-generation.md] Section 27.7.1
+ *
+ * GenerationScheduler runs the pipeline's passes one at a time per column on
+ * a pool of worker threads. Passes that only touch their own column run as
+ * soon as the column reaches them. A pass whose needsNeighbors() is true
+ * waits until all 8 neighbors have finished the passes before it, then runs
+ * with the whole 3x3 neighborhood claimed so no other pass can touch those
+ * columns while it reads and writes across borders.
+ *
+ * After every pass the column's generation stage marker is updated, so a
+ * column saved mid-generation picks up where it stopped when it is scheduled
+ * again.
+ *
+ * Features write into neighboring columns through the scheduler's
+ * FeatureWriteBuffer. A column's queued writes are applied when it becomes
+ * ready (no neighbor pass can still write into it), just before its ready
+ * callbacks, in an order independent of the thread count. Writes into a
+ * column the scheduler is not generating are dropped rather than kept for a
+ * column that may never come.
+ *
+ * The scheduler keeps a pointer to each column it has seen in World. Call
+ * forget() before World::removeColumn(); it drops the column's state and its
+ * queued writes. A column removed without forget() is noticed the next time
+ * the scheduler reaches it, but a pass or callback already under way would
+ * still use the freed column.
+ */
+
+#pragma once
+
+#include "finevox/worldgen/world_generator.hpp"
+#include "finevox/worldgen/feature_write_buffer.hpp"
+#include "finevox/core/position.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace finevox::worldgen {
+
+// ============================================================================
+// GenerationScheduler
+// ============================================================================
+
+class GenerationScheduler {
+public:
+    /// Called once a requested column is final: all passes done on it and
+    /// no neighbor pass can still write into it. Runs on a worker thread
+    /// (or the requesting thread if already ready) - keep it fast.
+    using ReadyCallback = std::function<void(ColumnPos pos, ChunkColumn& column)>;
+
+    struct Stats {
+        std::atomic<uint64_t> passesRun{0};
+        std::atomic<uint64_t> columnsReady{0};
+        std::atomic<uint64_t> neighborWaits{0};  ///< Neighbor passes deferred on a 3x3 check
+        std::atomic<uint64_t> writesDropped{0};  ///< Feature writes into columns not being generated
+    };
+
+    /// pipeline, world and biomeMap must outlive the scheduler. Columns are
+    /// created in world as needed; existing columns keep their stage marker.
+    GenerationScheduler(GenerationPipeline& pipeline, World& world, const BiomeMap& biomeMap,
+                        size_t threads = 1);
+    ~GenerationScheduler();
+
+    GenerationScheduler(const GenerationScheduler&) = delete;
+    GenerationScheduler& operator=(const GenerationScheduler&) = delete;
+
+    /// Start worker threads
+    void start();
+
+    /// Stop worker threads (passes in flight finish, queued work stays queued)
+    void stop();
+
+    [[nodiscard]] bool isRunning() const { return running_; }
+
+    /// Generate pos to completion. Neighbors are generated as far as the
+    /// neighbor-dependent passes need. The callback fires once pos is ready.
+    void request(ColumnPos pos, ReadyCallback callback = nullptr);
+
+    /// Drop everything kept for pos (state, unfired callbacks, queued feature
+    /// writes into it) so the column can be removed from World. Returns false,
+    /// keeping the state, while a pass or callback uses the column or a
+    /// neighbor still needs its state to advance or become ready; retry later.
+    bool forget(ColumnPos pos);
+
+    /// Block until no pass is queued or running
+    void waitIdle();
+
+    /// Whether a requested column has become ready
+    [[nodiscard]] bool isReady(ColumnPos pos) const;
+
+    /// Number of passes pos has completed (0 if unknown to the scheduler)
+    [[nodiscard]] size_t completedPasses(ColumnPos pos) const;
+
+    [[nodiscard]] const Stats& stats() const { return stats_; }
+
+    /// Cross-column feature writes not yet applied
+    [[nodiscard]] const FeatureWriteBuffer& pendingWrites() const { return pendingWrites_; }
+
+private:
+    struct ColumnState {
+        ChunkColumn* column = nullptr;
+        std::unique_ptr<GenerationContext> ctx;  ///< Dropped once all passes ran
+        size_t stage = 0;   ///< Passes completed
+        size_t target = 0;  ///< Passes wanted
+        bool busy = false;  ///< Claimed by a running pass (own or a neighbor's)
+        bool queued = false;
+        bool requested = false;
+        bool ready = false;
+        size_t delivering = 0;  ///< Notifications holding column, not yet run
+        std::vector<ReadyCallback> callbacks;
+    };
+
+    /// Work for a column that became ready, run outside the lock: flush its
+    /// queued feature writes, or fire one callback
+    struct Notification {
+        ColumnPos pos;
+        ChunkColumn* column;
+        ReadyCallback callback;  ///< Null for the flush entry
+    };
+
+    GenerationPipeline& pipeline_;
+    World& world_;
+    const BiomeMap& biomeMap_;
+    size_t threadCount_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable workCv_;
+    std::condition_variable idleCv_;
+    std::unordered_map<uint64_t, ColumnState> states_;
+    std::deque<ColumnPos> queue_;
+    size_t runningPasses_ = 0;
+
+    /// Passes a column's neighbors must complete before it counts as ready
+    /// (one past the last neighbor-dependent pass)
+    size_t settledStage_ = 0;
+
+    FeatureWriteBuffer pendingWrites_;
+
+    std::vector<std::thread> workers_;
+    std::atomic<bool> running_{false};
+    Stats stats_;
+
+    void workerLoop();
+    void deliver(std::vector<Notification>& notify);
+
+    // All below require mutex_ held
+    ColumnState& ensure(ColumnPos pos);
+    bool tryForget(ColumnPos pos);
+    void delivered(const std::vector<Notification>& notify);
+    void raiseTarget(ColumnPos pos, size_t target);
+    void enqueue(ColumnPos pos);
+    void enqueueAround(ColumnPos pos, int32_t radius);
+    void checkReady(ColumnPos pos, std::vector<Notification>& notify);
+    [[nodiscard]] bool neighborsAllow(ColumnPos pos, size_t passIndex) const;
+    void setNeighborhoodBusy(ColumnPos pos, bool busy);
+};
+
+}  // namespace finevox::worldgen
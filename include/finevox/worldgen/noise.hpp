@@ -12,8 +12,10 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
 
 namespace finevox::worldgen {
 
@@ -34,6 +36,45 @@ public:
     [[nodiscard]] static uint64_t deriveSeed(uint64_t baseSeed, uint64_t salt);
 };
 
+// ============================================================================
+// Sample grids
+// ============================================================================
+
+/// Regular 2D lattice of sample points; the defaults cover one column
+/// at one-block spacing. Point (ix, iz) is (x0 + ix * stepX, z0 + iz * stepZ)
+/// and lands at out[ix * countZ + iz] (same order as GenerationContext::hmIndex).
+struct NoiseGrid2D {
+    float x0 = 0.0f;
+    float z0 = 0.0f;
+    float stepX = 1.0f;
+    float stepZ = 1.0f;
+    int32_t countX = 16;
+    int32_t countZ = 16;
+
+    [[nodiscard]] size_t size() const {
+        return static_cast<size_t>(countX) * static_cast<size_t>(countZ);
+    }
+};
+
+/// Regular 3D lattice of sample points. Point (ix, iy, iz) lands at
+/// out[(ix * countZ + iz) * countY + iy], so each vertical run is contiguous.
+struct NoiseGrid3D {
+    float x0 = 0.0f;
+    float y0 = 0.0f;
+    float z0 = 0.0f;
+    float stepX = 1.0f;
+    float stepY = 1.0f;
+    float stepZ = 1.0f;
+    int32_t countX = 16;
+    int32_t countY = 1;
+    int32_t countZ = 16;
+
+    [[nodiscard]] size_t size() const {
+        return static_cast<size_t>(countX) * static_cast<size_t>(countY) *
+               static_cast<size_t>(countZ);
+    }
+};
+
 // ============================================================================
 // Base interfaces
 // ============================================================================
@@ -45,6 +86,16 @@ public:
 
     /// Evaluate noise at (x, z). Returns approximately [-1, 1].
     [[nodiscard]] virtual float evaluate(float x, float z) const = 0;
+
+    /// Evaluate out.size() points (xs[i], zs[i]) into out[i]. The default
+    /// calls evaluate() per point; built-in noises and wrappers override it
+    /// with one virtual call per batch (per octave for fractals) and
+    /// vectorized kernels. Matches evaluate() to float rounding.
+    virtual void evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                               std::span<float> out) const;
+
+    /// Evaluate every point of grid into out (out.size() >= grid.size())
+    void evaluateGrid(const NoiseGrid2D& grid, std::span<float> out) const;
 };
 
 /// Abstract 3D noise evaluator
@@ -54,8 +105,20 @@ public:
 
     /// Evaluate noise at (x, y, z). Returns approximately [-1, 1].
     [[nodiscard]] virtual float evaluate(float x, float y, float z) const = 0;
+
+    /// Evaluate out.size() points (xs[i], ys[i], zs[i]) into out[i]
+    /// (see Noise2D::evaluateBatch)
+    virtual void evaluateBatch(std::span<const float> xs, std::span<const float> ys,
+                               std::span<const float> zs, std::span<float> out) const;
+
+    /// Evaluate every point of grid into out (out.size() >= grid.size())
+    void evaluateGrid(const NoiseGrid3D& grid, std::span<float> out) const;
 };
 
+/// Points per evaluateBatch() call made by evaluateGrid() and the fractal
+/// wrappers (bounds their stack scratch buffers)
+constexpr size_t NOISE_BATCH_CHUNK = 256;
+
 // ============================================================================
 // Perlin noise
 // ============================================================================
@@ -66,6 +129,8 @@ public:
     explicit PerlinNoise2D(uint64_t seed);
 
     [[nodiscard]] float evaluate(float x, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                       std::span<float> out) const override;
 
 private:
     std::array<uint8_t, 512> perm_;
@@ -80,6 +145,8 @@ public:
     explicit PerlinNoise3D(uint64_t seed);
 
     [[nodiscard]] float evaluate(float x, float y, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> ys,
+                       std::span<const float> zs, std::span<float> out) const override;
 
 private:
     std::array<uint8_t, 512> perm_;
@@ -98,6 +165,8 @@ public:
     explicit OpenSimplex2D(uint64_t seed);
 
     [[nodiscard]] float evaluate(float x, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                       std::span<float> out) const override;
 
 private:
     std::array<int16_t, 2048> perm_;
@@ -112,6 +181,8 @@ public:
     explicit OpenSimplex3D(uint64_t seed);
 
     [[nodiscard]] float evaluate(float x, float y, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> ys,
+                       std::span<const float> zs, std::span<float> out) const override;
 
 private:
     std::array<int16_t, 2048> perm_;
@@ -2,7 +2,7 @@
  * @file noise_ops.hpp
  * @brief Composable noise operations: fractal, warp, scale, combine
  *
- * Design: [27-world-generation.md] Section 27.2.4, 27.2.5
+ * Design: [27-world-generation.md] Section 27.2.4, 27.2.5, 27.2.8
  *
  * All operations wrap Noise2D/Noise3D via unique_ptr, enabling
  * arbitrary composition. Example:
@@ -14,9 +14,14 @@
 #pragma once
 
 #include "finevox/worldgen/noise.hpp"
+#include "finevox/core/lru_cache.hpp"
+#include "finevox/core/position.hpp"
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace finevox::worldgen {
 
@@ -35,6 +40,8 @@ public:
                float lacunarity = 2.0f, float persistence = 0.5f);
 
     [[nodiscard]] float evaluate(float x, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                       std::span<float> out) const override;
 
 private:
     std::unique_ptr<Noise2D> base_;
@@ -50,6 +57,8 @@ public:
                float lacunarity = 2.0f, float persistence = 0.5f);
 
     [[nodiscard]] float evaluate(float x, float y, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> ys,
+                       std::span<const float> zs, std::span<float> out) const override;
 
 private:
     std::unique_ptr<Noise3D> base_;
@@ -65,6 +74,8 @@ public:
                   float lacunarity = 2.0f, float gain = 0.5f);
 
     [[nodiscard]] float evaluate(float x, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                       std::span<float> out) const override;
 
 private:
     std::unique_ptr<Noise2D> base_;
@@ -81,6 +92,8 @@ public:
                   float lacunarity = 2.0f, float gain = 0.5f);
 
     [[nodiscard]] float evaluate(float x, float y, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> ys,
+                       std::span<const float> zs, std::span<float> out) const override;
 
 private:
     std::unique_ptr<Noise3D> base_;
@@ -97,6 +110,8 @@ public:
                   float lacunarity = 2.0f, float persistence = 0.5f);
 
     [[nodiscard]] float evaluate(float x, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                       std::span<float> out) const override;
 
 private:
     std::unique_ptr<Noise2D> base_;
@@ -112,6 +127,8 @@ public:
                   float lacunarity = 2.0f, float persistence = 0.5f);
 
     [[nodiscard]] float evaluate(float x, float y, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> ys,
+                       std::span<const float> zs, std::span<float> out) const override;
 
 private:
     std::unique_ptr<Noise3D> base_;
@@ -137,6 +154,8 @@ public:
                  float warpStrength = 1.0f);
 
     [[nodiscard]] float evaluate(float x, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                       std::span<float> out) const override;
 
 private:
     std::unique_ptr<Noise2D> source_;
@@ -155,6 +174,8 @@ public:
                  float warpStrength = 1.0f);
 
     [[nodiscard]] float evaluate(float x, float y, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> ys,
+                       std::span<const float> zs, std::span<float> out) const override;
 
 private:
     std::unique_ptr<Noise3D> source_;
@@ -181,6 +202,8 @@ public:
                   float amplitude = 1.0f, float offset = 0.0f);
 
     [[nodiscard]] float evaluate(float x, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                       std::span<float> out) const override;
 
 private:
     std::unique_ptr<Noise2D> source_;
@@ -196,6 +219,8 @@ public:
                   float amplitude = 1.0f, float offset = 0.0f);
 
     [[nodiscard]] float evaluate(float x, float y, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> ys,
+                       std::span<const float> zs, std::span<float> out) const override;
 
 private:
     std::unique_ptr<Noise3D> source_;
@@ -210,6 +235,8 @@ public:
                    float minVal = -1.0f, float maxVal = 1.0f);
 
     [[nodiscard]] float evaluate(float x, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                       std::span<float> out) const override;
 
 private:
     std::unique_ptr<Noise2D> source_;
@@ -236,6 +263,8 @@ public:
                     CombineOp op, float blendFactor = 0.5f);
 
     [[nodiscard]] float evaluate(float x, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                       std::span<float> out) const override;
 
 private:
     std::unique_ptr<Noise2D> a_, b_;
@@ -252,12 +281,77 @@ public:
                   std::function<float(float)> mapFunc);
 
     [[nodiscard]] float evaluate(float x, float z) const override;
+    void evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                       std::span<float> out) const override;
 
 private:
     std::unique_ptr<Noise2D> source_;
     std::function<float(float)> mapFunc_;
 };
 
+// ============================================================================
+// Coarse-lattice density sampling
+// ============================================================================
+
+/// Samples a smooth Noise3D on a coarse lattice (by default every 4 x 8 x 4
+/// blocks) and trilinearly interpolates per-block values for whole columns.
+///
+/// The lattice is stored as posts: the samples along one vertical line of
+/// lattice points. Posts on a column's border lie on the face it shares with
+/// its neighbor, so they are cached (LRU) and reused by the neighbor instead
+/// of being evaluated again. A post computed for a lower range is extended
+/// when a taller one is needed. Values at lattice points equal the source
+/// exactly; everything in between is an approximation, so only use this for
+/// noise that varies slowly relative to the cell size. Thread-safe.
+class CoarseDensitySampler {
+public:
+    struct Stats {
+        std::atomic<uint64_t> postsComputed{0};  ///< Posts evaluated or extended
+        std::atomic<uint64_t> postsReused{0};    ///< Posts served from the cache
+        std::atomic<uint64_t> samplesEvaluated{0};  ///< Source evaluations
+    };
+
+    static constexpr int32_t DEFAULT_CELL_XZ = 4;
+    static constexpr int32_t DEFAULT_CELL_Y = 8;
+    static constexpr size_t DEFAULT_CACHED_POSTS = 4096;
+
+    /// @param source Noise to sample (not owned; must outlive the sampler)
+    /// @param cellXZ Horizontal lattice spacing; must divide 16
+    /// @param cellY Vertical lattice spacing (> 0)
+    /// @param cachedPosts Posts kept in the cache
+    explicit CoarseDensitySampler(const Noise3D& source,
+                                  int32_t cellXZ = DEFAULT_CELL_XZ,
+                                  int32_t cellY = DEFAULT_CELL_Y,
+                                  size_t cachedPosts = DEFAULT_CACHED_POSTS);
+
+    /// Interpolated values for the blocks of column pos with minY <= y < maxY.
+    /// out must hold 256 * (maxY - minY) values and uses the NoiseGrid3D
+    /// layout for the column: out[(lx * 16 + lz) * (maxY - minY) + (y - minY)].
+    void sampleColumn(ColumnPos pos, int32_t minY, int32_t maxY, std::span<float> out);
+
+    [[nodiscard]] int32_t cellXZ() const { return cellXZ_; }
+    [[nodiscard]] int32_t cellY() const { return cellY_; }
+    [[nodiscard]] const Stats& stats() const { return stats_; }
+
+private:
+    /// Samples at lattice levels firstLevel .. firstLevel + values.size() - 1
+    struct Post {
+        int32_t firstLevel = 0;
+        std::vector<float> values;
+    };
+
+    const Noise3D& source_;
+    int32_t cellXZ_;
+    int32_t cellY_;
+
+    std::mutex mutex_;
+    LRUCache<uint64_t, Post> posts_;
+    Stats stats_;
+
+    /// Evaluate lattice levels [lo, hi] of the post at lattice (gx, gz)
+    void evaluatePost(int32_t gx, int32_t gz, int32_t lo, int32_t hi, float* out);
+};
+
 // ============================================================================
 // Convenience factories
 // ============================================================================
@@ -0,0 +1,144 @@
+/**
+ * @file noise_simd.hpp
+ * @brief Four-lane float helpers for the batched noise kernels
+ *
+ * Design: [27-world-generation.md] Section 27.2.7
+ *
+ * Noise kernels split each group of four points into a scalar setup
+ * (lattice hashing, permutation table lookups, vertex selection) and the
+ * floating-point math (fade curves, gradient dot products, attenuation),
+ * which runs in these lanes. SSE2 is used when available (always on x86-64);
+ * other targets fall back to plain four-element loops the compiler can
+ * vectorize on its own.
+ *
+ * Lane math performs the same operations in the same order as the scalar
+ * evaluate() paths, so batched output matches scalar output.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FINEVOX_NOISE_SSE2 1
+#include <emmintrin.h>
+#else
+#define FINEVOX_NOISE_SSE2 0
+#endif
+
+namespace finevox::worldgen::simd {
+
+constexpr size_t LANES = 4;
+
+/// Four floats processed together
+struct Float4 {
+#if FINEVOX_NOISE_SSE2
+    __m128 v;
+
+    [[nodiscard]] static Float4 load(const float* p) { return {_mm_loadu_ps(p)}; }
+    [[nodiscard]] static Float4 splat(float f) { return {_mm_set1_ps(f)}; }
+    void store(float* p) const { _mm_storeu_ps(p, v); }
+#else
+    std::array<float, LANES> v;
+
+    [[nodiscard]] static Float4 load(const float* p) { return {{p[0], p[1], p[2], p[3]}}; }
+    [[nodiscard]] static Float4 splat(float f) { return {{f, f, f, f}}; }
+    void store(float* p) const {
+        for (size_t i = 0; i < LANES; ++i) p[i] = v[i];
+    }
+#endif
+};
+
+#if FINEVOX_NOISE_SSE2
+
+inline Float4 operator+(Float4 a, Float4 b) { return {_mm_add_ps(a.v, b.v)}; }
+inline Float4 operator-(Float4 a, Float4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+inline Float4 operator*(Float4 a, Float4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+
+/// value in lanes where gate > 0, 0 elsewhere
+inline Float4 whereGatePositive(Float4 gate, Float4 value) {
+    return {_mm_and_ps(_mm_cmpgt_ps(gate.v, _mm_setzero_ps()), value.v)};
+}
+
+/// std::floor per lane, also written to cells as ints (|x| < 2^31)
+inline Float4 floorLanes(Float4 x, int* cells) {
+    __m128i truncated = _mm_cvttps_epi32(x.v);
+    // Truncation rounded a negative fraction up: subtract 1 (mask is -1)
+    __m128 roundedUp = _mm_cmpgt_ps(_mm_cvtepi32_ps(truncated), x.v);
+    __m128i floored = _mm_add_epi32(truncated, _mm_castps_si128(roundedUp));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(cells), floored);
+    return {_mm_cvtepi32_ps(floored)};
+}
+
+#else
+
+namespace detail {
+template <typename Op>
+inline Float4 laneWise(Float4 a, Float4 b, Op op) {
+    Float4 r;
+    for (size_t i = 0; i < LANES; ++i) r.v[i] = op(a.v[i], b.v[i]);
+    return r;
+}
+}  // namespace detail
+
+inline Float4 operator+(Float4 a, Float4 b) { return detail::laneWise(a, b, [](float x, float y) { return x + y; }); }
+inline Float4 operator-(Float4 a, Float4 b) { return detail::laneWise(a, b, [](float x, float y) { return x - y; }); }
+inline Float4 operator*(Float4 a, Float4 b) { return detail::laneWise(a, b, [](float x, float y) { return x * y; }); }
+
+inline Float4 whereGatePositive(Float4 gate, Float4 value) {
+    return detail::laneWise(gate, value, [](float g, float x) { return g > 0.0f ? x : 0.0f; });
+}
+
+inline Float4 floorLanes(Float4 x, int* cells) {
+    Float4 r;
+    for (size_t i = 0; i < LANES; ++i) {
+        cells[i] = static_cast<int>(std::floor(x.v[i]));
+        r.v[i] = static_cast<float>(cells[i]);
+    }
+    return r;
+}
+
+#endif
+
+/// Perlin fade curve 6t^5 - 15t^4 + 10t^3, evaluated as the scalar fade()
+inline Float4 fade(Float4 t) {
+    return t * t * t * (t * (t * Float4::splat(6.0f) - Float4::splat(15.0f)) + Float4::splat(10.0f));
+}
+
+/// a + t * (b - a), as the scalar lerp()
+inline Float4 lerp(Float4 t, Float4 a, Float4 b) {
+    return a + t * (b - a);
+}
+
+/// Run kernel over count points in groups of LANES. The final partial
+/// group is padded with copies of the last point into scratch buffers so
+/// kernels always see full lanes. kernel(inputs, out) receives one pointer
+/// per input stream and the output, each covering LANES floats.
+template <size_t N, typename Kernel>
+inline void forEachLaneGroup(const std::array<const float*, N>& inputs, float* out,
+                             size_t count, Kernel&& kernel) {
+    size_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        std::array<const float*, N> in;
+        for (size_t k = 0; k < N; ++k) in[k] = inputs[k] + i;
+        kernel(in, out + i);
+    }
+    if (i < count) {
+        std::array<std::array<float, LANES>, N> pad;
+        std::array<const float*, N> in;
+        for (size_t k = 0; k < N; ++k) {
+            for (size_t l = 0; l < LANES; ++l) {
+                pad[k][l] = inputs[k][i + std::min(l, count - i - 1)];
+            }
+            in[k] = pad[k].data();
+        }
+        std::array<float, LANES> result;
+        kernel(in, result.data());
+        for (size_t l = 0; i + l < count; ++l) out[i + l] = result[l];
+    }
+}
+
+}  // namespace finevox::worldgen::simd
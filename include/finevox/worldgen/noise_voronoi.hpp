@@ -18,6 +18,8 @@ struct VoronoiResult {
     float distance2 = 0.0f;       ///< Distance to second-nearest cell center
     glm::vec2 cellCenter{0.0f};   ///< Position of nearest cell center
     uint32_t cellId = 0;          ///< Deterministic ID for nearest cell
+    int32_t cellX = 0;            ///< Grid cell holding the nearest center
+    int32_t cellZ = 0;
 };
 
 /// Voronoi (Worley) cell noise in 2D
@@ -0,0 +1,30 @@
+/**
+ * @file pass_counters.hpp
+ * @brief Per-thread work tallies read around each generation pass
+ *
+ * Design: [27-world-generation.md] Section 27.4.7
+ *
+ * Generation code adds the blocks it writes and the noise points it samples
+ * to the calling thread's counters. GenerationPipeline reads them before and
+ * after each pass while profiling, so a pass's share is the difference. The
+ * counters only ever grow and cost a thread-local add per call site.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace finevox::worldgen {
+
+struct PassCounters {
+    uint64_t blocksWritten = 0;  ///< Block writes (and queued cross-column writes)
+    uint64_t noiseSamples = 0;   ///< Points requested from noise functions
+
+    /// Counters of the calling thread
+    [[nodiscard]] static PassCounters& current() {
+        thread_local PassCounters counters;
+        return counters;
+    }
+};
+
+}  // namespace finevox::worldgen
@@ -0,0 +1,118 @@
+/**
+ * @file pregenerator.hpp
+ * @brief Headless bulk generation of a rectangular area into region files
+ *
+ * Design: [27-world-generation.md] Section 27.8.5
+ *
+ * WorldPregenerator warms a world before launch. It bypasses ColumnManager:
+ * each worker thread claims a whole region, generates that region's columns
+ * into a private World, and writes them straight to the region's RegionFile.
+ * Feature writes that job cannot apply are patched into the written columns
+ * in a second phase, again one job per region, so no two threads ever touch
+ * the same region file and no locking is needed.
+ */
+
+#pragma once
+
+#include "finevox/worldgen/world_generator.hpp"
+#include "finevox/core/position.hpp"
+#include "finevox/core/region_file.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <optional>
+
+namespace finevox::worldgen {
+
+// ============================================================================
+// PregenArea
+// ============================================================================
+
+/// Inclusive rectangle of column positions
+struct PregenArea {
+    ColumnPos min;
+    ColumnPos max;
+
+    /// Square of (2 * radius + 1)^2 columns centered on center
+    [[nodiscard]] static PregenArea square(ColumnPos center, int32_t radius);
+
+    [[nodiscard]] bool contains(ColumnPos pos) const {
+        return pos.x >= min.x && pos.x <= max.x && pos.z >= min.z && pos.z <= max.z;
+    }
+
+    [[nodiscard]] uint64_t columnCount() const;
+};
+
+// ============================================================================
+// WorldPregenerator
+// ============================================================================
+
+struct PregenOptions {
+    size_t threads = 1;
+
+    /// Leave columns already in the region files alone (makes runs resumable)
+    bool skipExisting = true;
+
+    /// nullopt = CompressionPolicy::fromConfig()
+    std::optional<CompressionPolicy> compression;
+
+    /// Rows kept resident behind the one generating, in columns; 0 = derived
+    /// from the widest feature in FeatureRegistry::global()
+    int32_t featureReach = 0;
+};
+
+/// Running totals, reported after each region completes
+struct PregenProgress {
+    size_t regionsDone = 0;
+    size_t regionsTotal = 0;
+    uint64_t columnsGenerated = 0;
+    uint64_t columnsSkipped = 0;
+    double seconds = 0.0;
+};
+
+struct PregenResult {
+    uint64_t columnsGenerated = 0;
+    uint64_t columnsSkipped = 0;
+    uint64_t writeFailures = 0;
+    uint64_t featureWritesPatched = 0;  ///< Blocks changed by the patch phase
+    uint64_t featureWritesDropped = 0;  ///< Feature writes outside the area
+    size_t regionsWritten = 0;          ///< Regions with at least one column saved
+    double seconds = 0.0;
+
+    [[nodiscard]] double columnsPerSecond() const {
+        return seconds > 0.0 ? static_cast<double>(columnsGenerated) / seconds : 0.0;
+    }
+};
+
+/// Generates an area region by region on N threads
+///
+/// Columns are generated row by row (along x, rows advancing in z) and each
+/// row is written once the featureReach rows after it are done, so features
+/// spilling back into it land before the write. Feature writes into another
+/// region, or into a row already written, are collected and applied once
+/// every region is generated: each target column is loaded, patched in
+/// (source, sequence) order, and saved again. Writes outside the area are
+/// dropped.
+class WorldPregenerator {
+public:
+    /// Called after each region, from whichever worker finished it
+    /// (calls are serialized)
+    using ProgressCallback = std::function<void(const PregenProgress&)>;
+
+    /// pipeline and biomeMap must outlive the pregenerator; the pipeline's
+    /// passes are shared by all worker threads
+    WorldPregenerator(GenerationPipeline& pipeline, const BiomeMap& biomeMap,
+                      std::filesystem::path regionDir);
+
+    /// Generate every column in area (blocks until done)
+    PregenResult run(const PregenArea& area, const PregenOptions& options = {},
+                     ProgressCallback progress = nullptr);
+
+private:
+    GenerationPipeline& pipeline_;
+    const BiomeMap& biomeMap_;
+    std::filesystem::path regionDir_;
+};
+
+}  // namespace finevox::worldgen
@@ -5,7 +5,8 @@
  * Design: [21-clipboard-schematic.md] Sections 21.3-21.5, 21.8
  *
  * A Schematic stores a 3D region of BlockSnapshots for clipboard,
- * structure generation, and file-based templates.
+ * structure generation, and file-based templates, palette-compressed in
+ * memory (Section 21.4).
  */
 
 #pragma once
@@ -61,9 +62,23 @@ struct BlockSnapshot {
 // Schematic
 // ============================================================================
 
-/// 3D region of block snapshots, stored in YZX order
+/// 3D region of block snapshots, stored in YZX order.
+///
+/// Cells are bit-packed indices (0 to 32 bits each) into a palette of
+/// snapshots that differ only by type name and rotation; index 0 is air. A
+/// cell with displacement or extra data keeps its full snapshot in a sparse
+/// side table instead, and so does a cell handed out for editing by the
+/// non-const at(). Readers always get a const BlockSnapshot&, either the
+/// palette entry or the side-table entry.
+///
+/// setBlock()/set() write the packed form directly and are the way to fill
+/// large schematics. compact() folds edited cells back into the palette,
+/// drops unused palette entries and narrows the index width.
 class Schematic {
 public:
+    /// paletteIndex() of a cell whose snapshot lives in the side table
+    static constexpr uint32_t NO_PALETTE_INDEX = UINT32_MAX;
+
     Schematic(int32_t sizeX, int32_t sizeY, int32_t sizeZ);
 
     // ---- Dimensions ----
@@ -78,11 +93,25 @@ public:
 
     // ---- Block access ----
 
+    /// Edit a cell in place. Moves the cell into the side table until the
+    /// next compact(); the reference stays valid until then or until the
+    /// cell is overwritten with setBlock()/set().
     [[nodiscard]] BlockSnapshot& at(int32_t x, int32_t y, int32_t z);
     [[nodiscard]] const BlockSnapshot& at(int32_t x, int32_t y, int32_t z) const;
     [[nodiscard]] BlockSnapshot& at(glm::ivec3 pos) { return at(pos.x, pos.y, pos.z); }
     [[nodiscard]] const BlockSnapshot& at(glm::ivec3 pos) const { return at(pos.x, pos.y, pos.z); }
 
+    /// Write a block with no displacement or extra data ("" or "air" clears)
+    void setBlock(int32_t x, int32_t y, int32_t z, std::string_view typeName,
+                  Rotation rotation = Rotation::IDENTITY);
+    void setBlock(glm::ivec3 pos, std::string_view typeName, Rotation rotation = Rotation::IDENTITY) {
+        setBlock(pos.x, pos.y, pos.z, typeName, rotation);
+    }
+
+    /// Write a full snapshot; displacement and extra data go to the side table
+    void set(int32_t x, int32_t y, int32_t z, BlockSnapshot snapshot);
+    void set(glm::ivec3 pos, BlockSnapshot snapshot) { set(pos.x, pos.y, pos.z, std::move(snapshot)); }
+
     [[nodiscard]] bool contains(int32_t x, int32_t y, int32_t z) const;
     [[nodiscard]] bool contains(glm::ivec3 pos) const {
         return contains(pos.x, pos.y, pos.z);
@@ -93,18 +122,55 @@ public:
     /// Iterate all non-air blocks. func(glm::ivec3 pos, const BlockSnapshot& snap)
     template<typename Func>
     void forEachBlock(Func&& func) const {
+        forEachBlockIndexed([&](glm::ivec3 pos, uint32_t, const BlockSnapshot& snap) {
+            func(pos, snap);
+        });
+    }
+
+    /// Iterate all non-air blocks with their palette index (NO_PALETTE_INDEX
+    /// for side-table cells). func(glm::ivec3 pos, uint32_t paletteIndex,
+    /// const BlockSnapshot& snap)
+    template<typename Func>
+    void forEachBlockIndexed(Func&& func) const {
+        size_t i = 0;
         for (int32_t x = 0; x < sizeX_; ++x) {
             for (int32_t z = 0; z < sizeZ_; ++z) {
-                for (int32_t y = 0; y < sizeY_; ++y) {
-                    const auto& snap = blocks_[index(x, y, z)];
-                    if (!snap.isAir()) {
-                        func(glm::ivec3(x, y, z), snap);
+                for (int32_t y = 0; y < sizeY_; ++y, ++i) {
+                    if (inSideTable(i)) {
+                        const auto& snap = side_.find(static_cast<uint32_t>(i))->second;
+                        if (!snap.isAir()) {
+                            func(glm::ivec3(x, y, z), NO_PALETTE_INDEX, snap);
+                        }
+                    } else if (uint32_t p = packedAt(i); p != 0) {
+                        func(glm::ivec3(x, y, z), p, palette_[p]);
                     }
                 }
             }
         }
     }
 
+    // ---- Palette ----
+
+    /// Distinct (type name, rotation) snapshots; entry 0 is air. May hold
+    /// entries no cell uses until compact().
+    [[nodiscard]] const std::vector<BlockSnapshot>& palette() const { return palette_; }
+
+    /// Palette index of a cell, or NO_PALETTE_INDEX if it is in the side table
+    [[nodiscard]] uint32_t paletteIndex(int32_t x, int32_t y, int32_t z) const;
+
+    /// Side-table snapshots keyed by cell index (y + sizeY * (z + sizeZ * x))
+    [[nodiscard]] const std::unordered_map<uint32_t, BlockSnapshot>& sideTable() const { return side_; }
+
+    /// Bits per packed cell index (0 while the schematic is all air)
+    [[nodiscard]] uint8_t bitsPerIndex() const { return bits_; }
+
+    /// Fold edited cells back into the palette, drop unused palette entries
+    /// and repack at the narrowest index width
+    void compact();
+
+    /// Approximate heap and object bytes held (extra data counted by entry)
+    [[nodiscard]] size_t memoryUsage() const;
+
     // ---- Statistics ----
 
     [[nodiscard]] size_t nonAirBlockCount() const;
@@ -118,14 +184,47 @@ public:
     [[nodiscard]] std::string_view author() const { return author_; }
 
 private:
+    struct PaletteKey {
+        std::string typeName;
+        uint8_t rotation;
+        bool operator==(const PaletteKey&) const = default;
+    };
+    struct PaletteKeyHash {
+        size_t operator()(const PaletteKey& key) const {
+            return std::hash<std::string>{}(key.typeName) * 31 + key.rotation;
+        }
+    };
+
     int32_t sizeX_, sizeY_, sizeZ_;
-    std::vector<BlockSnapshot> blocks_;
+    std::vector<BlockSnapshot> palette_;
+    std::unordered_map<PaletteKey, uint32_t, PaletteKeyHash> paletteLookup_;
+    uint32_t lastPaletteIndex_ = 0;    ///< Most recent lookup, checked first
+    uint8_t bits_ = 0;                 ///< 0, 1, 2, 4, 8, 16 or 32: never straddles a word
+    std::vector<uint64_t> packed_;
+    std::unordered_map<uint32_t, BlockSnapshot> side_;
+    std::vector<uint64_t> sideMask_;   ///< One bit per cell, allocated with the first side entry
     std::string name_;
     std::string author_;
 
     [[nodiscard]] size_t index(int32_t x, int32_t y, int32_t z) const {
         return static_cast<size_t>(y + sizeY_ * (z + sizeZ_ * x));
     }
+
+    [[nodiscard]] uint32_t packedAt(size_t i) const {
+        if (bits_ == 0) return 0;
+        size_t bit = i * bits_;
+        uint64_t mask = (uint64_t{1} << bits_) - 1;
+        return static_cast<uint32_t>((packed_[bit >> 6] >> (bit & 63)) & mask);
+    }
+
+    [[nodiscard]] bool inSideTable(size_t i) const {
+        return !side_.empty() && ((sideMask_[i >> 6] >> (i & 63)) & 1) != 0;
+    }
+
+    void setPacked(size_t i, uint32_t value);
+    void repack(uint8_t bits);
+    [[nodiscard]] uint32_t paletteIndexFor(std::string_view typeName, Rotation rotation);
+    void setSideBit(size_t i, bool present);
 };
 
 // ============================================================================
@@ -0,0 +1,60 @@
+/**
+ * @file schematic_paste.hpp
+ * @brief Multi-threaded schematic placement, committed per subchunk
+ *
+ * Design: [21-clipboard-schematic.md] Section 21.5
+ *
+ * placeSchematic() resolves the schematic's block type names to ids once,
+ * splits the target box into the subchunks it covers and stages each
+ * subchunk's changes on worker threads without touching the world. Missing
+ * subchunks are then created on the calling thread, and every subchunk is
+ * committed in one bulk write (one block version bump, no per-block change
+ * callbacks). Lighting is recalculated once per touched column and one mesh
+ * rebuild is queued per touched subchunk and its face neighbors.
+ *
+ * Subchunks are disjoint, so the result does not depend on the thread count
+ * and matches placing the same blocks one at a time.
+ */
+
+#pragma once
+
+#include "finevox/core/position.hpp"
+#include "finevox/worldgen/schematic.hpp"
+
+#include <cstddef>
+
+namespace finevox {
+class World;
+}
+
+namespace finevox::worldgen {
+
+// ============================================================================
+// Schematic placement
+// ============================================================================
+
+/// Options for placeSchematic()
+struct PlaceOptions {
+    bool pasteAir = false;       ///< Write the schematic's air cells (clears the target)
+    bool replaceNonAir = true;   ///< Overwrite blocks that are not air in the world
+    bool relight = true;         ///< Recalculate touched columns if the world has a LightEngine
+    bool remesh = true;          ///< Queue mesh rebuilds if the world has a MeshRebuildQueue
+    size_t threads = 1;          ///< Worker threads for staging and commit (0 = hardware)
+};
+
+/// What placeSchematic() changed
+struct PlaceResult {
+    size_t blocksPlaced = 0;      ///< Cells written (including unchanged types)
+    size_t subChunksTouched = 0;  ///< Subchunks that received at least one write
+    size_t columnsTouched = 0;
+};
+
+/// Place schematic with its (0, 0, 0) corner at origin. Rotation index and
+/// extra data are written with each block; writing a cell drops any block
+/// data stored there before. Relighting calls LightEngine::recalculateColumn
+/// on this thread, so the lighting thread must not be running (or pass
+/// relight = false and relight later).
+PlaceResult placeSchematic(World& world, const Schematic& schematic, BlockPos origin,
+                           const PlaceOptions& options = {});
+
+}  // namespace finevox::worldgen
@@ -17,6 +17,7 @@
 #include "finevox/core/position.hpp"
 
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <string_view>
@@ -29,6 +30,8 @@ class World;
 
 namespace finevox::worldgen {
 
+class FeatureWriteBuffer;
+
 // ============================================================================
 // GenerationPriority
 // ============================================================================
@@ -62,6 +65,13 @@ struct GenerationContext {
     /// Biome per (localX * 16 + localZ), populated by TerrainPass
     std::array<BiomeId, 256> biomes{};
 
+    /// Queue for feature writes into other columns (Section 27.6.3). Null
+    /// makes features write into neighbors through World immediately.
+    FeatureWriteBuffer* pendingWrites = nullptr;
+
+    /// Issue counter for this column's queued writes
+    uint32_t pendingWriteSequence = 0;
+
     /// Per-column deterministic seed derived from worldSeed + column position
     [[nodiscard]] uint64_t columnSeed() const;
 
@@ -100,6 +110,14 @@ public:
 /// Orchestrates ordered generation passes over chunk columns
 class GenerationPipeline {
 public:
+    /// Totals for one pass, collected while profiling is enabled
+    struct PassProfile {
+        std::atomic<uint64_t> runs{0};
+        std::atomic<uint64_t> nanoseconds{0};    ///< Wall time inside generate()
+        std::atomic<uint64_t> blocksWritten{0};  ///< See PassCounters
+        std::atomic<uint64_t> noiseSamples{0};
+    };
+
     GenerationPipeline() = default;
 
     /// Add a pass (sorted by priority on insertion)
@@ -111,8 +129,31 @@ public:
     /// Replace a pass with the same name (returns true if found and replaced)
     bool replacePass(std::unique_ptr<GenerationPass> pass);
 
-    /// Generate a column by running all passes in priority order
-    void generateColumn(ChunkColumn& column, World& world, const BiomeMap& biomeMap);
+    /// Generate a column by running all passes in priority order.
+    /// A column whose generation stage shows it was interrupted between
+    /// passes resumes after the last completed one. Leaves the column
+    /// marked GENERATION_COMPLETE.
+    ///
+    /// With pendingWrites, features queue writes into other columns there,
+    /// and writes queued for this column are flushed once its passes are done.
+    /// Neighbors generated later write into it directly.
+    void generateColumn(ChunkColumn& column, World& world, const BiomeMap& biomeMap,
+                        FeatureWriteBuffer* pendingWrites = nullptr);
+
+    /// Pass at index, in priority order
+    [[nodiscard]] GenerationPass& pass(size_t index) const { return *passes_[index].pass; }
+
+    /// Index of the first pass not yet applied to a column at the given
+    /// generation stage and rank (0 if not started, passCount() if complete).
+    /// Rank 0 means every pass at stage was applied.
+    [[nodiscard]] size_t nextPassIndex(int32_t stage, int32_t rank = 0) const;
+
+    /// Run one pass and advance the column's generation stage
+    void runPass(size_t index, GenerationContext& ctx);
+
+    /// Rebuild heightmap and biomes of a context for a column resumed
+    /// mid-generation (contexts are not saved with the column)
+    void restoreContext(GenerationContext& ctx) const;
 
     /// Set the world seed
     void setWorldSeed(uint64_t seed) { worldSeed_ = seed; }
@@ -126,9 +167,27 @@ public:
     /// Get pass by name
     [[nodiscard]] GenerationPass* getPass(std::string_view name) const;
 
+    /// Time every pass and tally its blocks written and noise samples
+    /// (off by default). Set before generating; profiles may be read while
+    /// passes run on other threads.
+    void setProfiling(bool enabled) { profiling_ = enabled; }
+    [[nodiscard]] bool isProfiling() const { return profiling_; }
+
+    /// Profile of the pass at index (replacing a pass resets its profile)
+    [[nodiscard]] const PassProfile& passProfile(size_t index) const { return *passes_[index].profile; }
+
+    /// Zero all pass profiles
+    void resetProfile();
+
 private:
+    struct PassEntry {
+        std::unique_ptr<GenerationPass> pass;
+        std::unique_ptr<PassProfile> profile;
+    };
+
     uint64_t worldSeed_ = 0;
-    std::vector<std::unique_ptr<GenerationPass>> passes_;
+    std::vector<PassEntry> passes_;
+    bool profiling_ = false;
 
     void sortPasses();
 };
@@ -3,13 +3,23 @@
 #include "finevox/core/subchunk.hpp"
 #include "finevox/core/block_type.hpp"
 #include "finevox/core/data_container.hpp"
-#include "finevox/core/event_queue.hpp"  // For UpdateScheduler
+#include "finevox/core/event_queue.hpp"  // For UpdateScheduler, DeferredBlockEffects
 
 #include <cassert>
 #include <stdexcept>
 
 namespace finevox {
 
+// ============================================================================
+// BlockHandler Implementation
+// ============================================================================
+
+void BlockHandler::onTickBatch(std::span<BlockContext> blocks, TickType type) {
+    for (BlockContext& ctx : blocks) {
+        onTick(ctx, type);
+    }
+}
+
 // ============================================================================
 // BlockContext Implementation
 // ============================================================================
@@ -45,11 +55,11 @@ bool BlockContext::isAir() const {
 }
 
 bool BlockContext::isOpaque() const {
-    return type()->isOpaque();
+    return BlockRegistry::global().isOpaque(blockType());
 }
 
 bool BlockContext::isTransparent() const {
-    return type()->isTransparent();
+    return BlockRegistry::global().isTransparent(blockType());
 }
 
 Rotation BlockContext::rotation() const {
@@ -89,13 +99,17 @@ DataContainer& BlockContext::getOrCreateData() {
 }
 
 void BlockContext::scheduleTick(int ticksFromNow) {
-    if (scheduler_) {
+    if (effects_) {
+        effects_->ticks.push_back({pos_, ticksFromNow, TickType::Scheduled});
+    } else if (scheduler_) {
         scheduler_->scheduleTick(pos_, ticksFromNow, TickType::Scheduled);
     }
 }
 
 void BlockContext::setRepeatTickInterval(int interval) {
-    if (scheduler_ && interval > 0) {
+    if (effects_ && interval > 0) {
+        effects_->ticks.push_back({pos_, interval, TickType::Repeat});
+    } else if (scheduler_ && interval > 0) {
         // Schedule a repeating tick
         scheduler_->scheduleTick(pos_, interval, TickType::Repeat);
     }
@@ -104,6 +118,14 @@ void BlockContext::setRepeatTickInterval(int interval) {
     // For now, only scheduling is implemented.
 }
 
+void BlockContext::pushEvent(const BlockEvent& event) {
+    if (effects_) {
+        effects_->events.push_back(event);
+    } else if (scheduler_) {
+        scheduler_->outbox().push(event);
+    }
+}
+
 void BlockContext::requestMeshRebuild() {
     // Touch the block to trigger version increment
     // setBlock with the same type increments blockVersion
@@ -124,6 +146,12 @@ BlockTypeId BlockContext::getNeighbor(Face face) const {
 }
 
 void BlockContext::notifyNeighbors() {
+    if (effects_) {
+        // Neighbor handlers may not be region-safe; run them on the game thread
+        effects_->neighborNotifies.push_back(pos_);
+        return;
+    }
+
     // Get handler for each neighbor and call onNeighborChanged
     BlockRegistry& registry = BlockRegistry::global();
 
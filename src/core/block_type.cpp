@@ -80,6 +80,11 @@ BlockType& BlockType::setWantsGameTicks(bool wants) {
     return *this;
 }
 
+BlockType& BlockType::setWantsRandomTicks(bool wants) {
+    wantsRandomTicks_ = wants;
+    return *this;
+}
+
 BlockType& BlockType::setHasCustomMesh(bool hasMesh) {
     hasCustomMesh_ = hasMesh;
     return *this;
@@ -134,6 +139,59 @@ BlockRegistry::BlockRegistry() {
        .setHardness(0.0f);
 
     types_[AIR_BLOCK_TYPE] = std::move(air);
+    TablePage& page = pageFor(AIR_INTERNED_ID);
+    page.setProperties(slotOf(AIR_INTERNED_ID), types_[AIR_BLOCK_TYPE]);
+    page.types[slotOf(AIR_INTERNED_ID)].store(&types_[AIR_BLOCK_TYPE], std::memory_order_release);
+}
+
+BlockRegistry::TablePage::TablePage() {
+    const BlockType& type = defaultType();
+    for (uint32_t slot = 0; slot < TABLE_PAGE_SIZE; ++slot) {
+        setProperties(slot, type);
+    }
+}
+
+void BlockRegistry::TablePage::setProperties(uint32_t slot, const BlockType& type) {
+    auto set = [&](TypeFlag which, bool value) {
+        uint64_t bit = uint64_t{1} << (slot & 63);
+        auto& word = flags[which][slot >> 6];
+        if (value) {
+            word.fetch_or(bit, std::memory_order_relaxed);
+        } else {
+            word.fetch_and(~bit, std::memory_order_relaxed);
+        }
+    };
+    set(FLAG_OPAQUE, type.isOpaque());
+    set(FLAG_TRANSPARENT, type.isTransparent());
+    set(FLAG_BLOCKS_SKY_LIGHT, type.blocksSkyLight());
+    set(FLAG_CUSTOM_MESH, type.hasCustomMesh());
+    set(FLAG_GAME_TICKS, type.wantsGameTicks());
+    set(FLAG_RANDOM_TICKS, type.wantsRandomTicks());
+    attenuation[slot].store(type.lightAttenuation(), std::memory_order_relaxed);
+    emission[slot].store(type.lightEmission(), std::memory_order_relaxed);
+}
+
+BlockRegistry::TablePage& BlockRegistry::pageFor(InternedId id) {
+    auto& slot = pages_[id >> TABLE_PAGE_BITS];
+    TablePage* page = slot.load(std::memory_order_relaxed);
+    if (!page) {
+        ownedPages_.push_back(std::make_unique<TablePage>());
+        page = ownedPages_.back().get();
+        slot.store(page, std::memory_order_release);
+    }
+    return *page;
+}
+
+void BlockRegistry::publishHandler(std::string_view name, BlockHandler* handler, bool lazy) {
+    InternedId id = StringInterner::global().intern(name);
+    if (id >= TABLE_IDS) {
+        return;
+    }
+    TablePage& page = pageFor(id);
+    uint32_t slot = id & (TABLE_PAGE_SIZE - 1);
+    // Handler before flag: a reader that sees the flag cleared also sees the handler
+    page.handlers[slot].store(handler, std::memory_order_release);
+    page.lazyHandlers[slot].store(lazy, std::memory_order_release);
 }
 
 bool BlockRegistry::registerType(BlockTypeId id, BlockType type) {
@@ -144,7 +202,14 @@ bool BlockRegistry::registerType(BlockTypeId id, BlockType type) {
         return false;
     }
 
-    types_[id] = std::move(type);
+    BlockType& stored = types_[id];
+    stored = std::move(type);
+    if (id.id < TABLE_IDS) {
+        // Properties before the type pointer: a reader that acquires the type also sees them
+        TablePage& page = pageFor(id.id);
+        page.setProperties(slotOf(id.id), stored);
+        page.types[slotOf(id.id)].store(&stored, std::memory_order_release);
+    }
     return true;
 }
 
@@ -153,6 +218,15 @@ bool BlockRegistry::registerType(std::string_view name, BlockType type) {
 }
 
 const BlockType& BlockRegistry::getType(BlockTypeId id) const {
+    if (id.id < TABLE_IDS) {
+        const TablePage* page = findPage(id.id);
+        const BlockType* type = page
+            ? page->types[id.id & (TABLE_PAGE_SIZE - 1)].load(std::memory_order_acquire)
+            : nullptr;
+        // Unregistered blocks get the default type
+        return type ? *type : defaultType();
+    }
+
     std::shared_lock lock(mutex_);
 
     auto it = types_.find(id);
@@ -173,6 +247,11 @@ const BlockType& BlockRegistry::getType(std::string_view name) const {
 }
 
 bool BlockRegistry::hasType(BlockTypeId id) const {
+    if (id.id < TABLE_IDS) {
+        const TablePage* page = findPage(id.id);
+        return page && page->types[id.id & (TABLE_PAGE_SIZE - 1)].load(std::memory_order_acquire);
+    }
+
     std::shared_lock lock(mutex_);
     return types_.find(id) != types_.end();
 }
@@ -231,7 +310,9 @@ bool BlockRegistry::registerHandler(std::string_view name, std::unique_ptr<Block
         return false;  // Already registered
     }
 
-    handlers_[nameStr].handler = std::move(handler);
+    auto& entry = handlers_[nameStr];
+    entry.handler = std::move(handler);
+    publishHandler(name, entry.handler.get(), false);
     return true;
 }
 
@@ -249,10 +330,27 @@ bool BlockRegistry::registerHandlerFactory(std::string_view name, HandlerFactory
     }
 
     handlers_[nameStr].factory = std::move(factory);
+    publishHandler(name, nullptr, true);
     return true;
 }
 
 BlockHandler* BlockRegistry::getHandler(BlockTypeId id) {
+    if (id.id < TABLE_IDS) {
+        const TablePage* page = findPage(id.id);
+        if (!page) {
+            return nullptr;
+        }
+        uint32_t slot = id.id & (TABLE_PAGE_SIZE - 1);
+        if (BlockHandler* handler = page->handlers[slot].load(std::memory_order_acquire)) {
+            return handler;
+        }
+        if (!page->lazyHandlers[slot].load(std::memory_order_acquire)) {
+            // Re-read: the factory may have just run
+            return page->handlers[slot].load(std::memory_order_acquire);
+        }
+    }
+
+    // Not loaded yet (runs the factory) or beyond the table
     return getHandler(id.name());
 }
 
@@ -274,6 +372,7 @@ BlockHandler* BlockRegistry::getHandler(std::string_view name) {
     if (it->second.hasFactory()) {
         it->second.handler = it->second.factory();
         it->second.factory = nullptr;  // Clear factory after use
+        publishHandler(name, it->second.handler.get(), false);
         return it->second.handler.get();
     }
 
@@ -281,6 +380,16 @@ BlockHandler* BlockRegistry::getHandler(std::string_view name) {
 }
 
 bool BlockRegistry::hasHandler(BlockTypeId id) const {
+    if (id.id < TABLE_IDS) {
+        const TablePage* page = findPage(id.id);
+        if (!page) {
+            return false;
+        }
+        uint32_t slot = id.id & (TABLE_PAGE_SIZE - 1);
+        // Flag first: once it reads cleared, the handler store is visible
+        return page->lazyHandlers[slot].load(std::memory_order_acquire) ||
+               page->handlers[slot].load(std::memory_order_acquire);
+    }
     return hasHandler(id.name());
 }
 
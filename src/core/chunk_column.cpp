@@ -11,7 +11,10 @@ ChunkColumn::ChunkColumn(ColumnPos pos) : pos_(pos) {
     heightmap_.fill(NO_HEIGHT);
 }
 
-ChunkColumn::~ChunkColumn() = default;
+ChunkColumn::~ChunkColumn() {
+    // Subchunks held elsewhere through shared_ptr must not keep our set entries
+    setRandomTickSet(nullptr);
+}
 
 ChunkColumn::ChunkColumn(ChunkColumn&&) noexcept = default;
 ChunkColumn& ChunkColumn::operator=(ChunkColumn&&) noexcept = default;
@@ -87,6 +90,7 @@ SubChunk& ChunkColumn::getOrCreateSubChunk(int32_t chunkY) {
     if (!ptr) {
         ptr = std::make_shared<SubChunk>();
         ptr->setPosition(toChunkPos(chunkY));
+        ptr->setRandomTickSet(randomTickSet_);
     }
     return *ptr;
 }
@@ -290,6 +294,14 @@ void ChunkColumn::removeData() {
 void ChunkColumn::rebuildGameTickRegistries() {
     for (auto& [y, subChunk] : subChunks_) {
         subChunk->rebuildGameTickRegistry();
+        subChunk->rebuildRandomTickTypes();
+    }
+}
+
+void ChunkColumn::setRandomTickSet(RandomTickSet* set) {
+    randomTickSet_ = set;
+    for (auto& [y, subChunk] : subChunks_) {
+        subChunk->setRandomTickSet(set);
     }
 }
 
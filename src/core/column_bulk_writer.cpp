@@ -0,0 +1,159 @@
+/**
+ * @file column_bulk_writer.cpp
+ * @brief Batched block writes into a ChunkColumn for world generation
+ *
+ * Design: [05-world-management.md] §5.1.1 Bulk Writes
+ */
+
+#include "finevox/core/column_bulk_writer.hpp"
+
+#include <algorithm>
+
+namespace finevox {
+
+ColumnBulkWriter::ColumnBulkWriter(ChunkColumn& column)
+    : column_(column)
+{
+}
+
+ColumnBulkWriter::~ColumnBulkWriter() {
+    finish();
+}
+
+ColumnBulkWriter::Slot* ColumnBulkWriter::slot(int32_t chunkY, bool create) {
+    if (lastSlot_ && lastChunkY_ == chunkY) {
+        return lastSlot_;
+    }
+
+    auto it = slots_.find(chunkY);
+    if (it == slots_.end()) {
+        SubChunk* subChunk = create ? &column_.getOrCreateSubChunk(chunkY)
+                                    : column_.getSubChunk(chunkY);
+        if (!subChunk) {
+            return nullptr;
+        }
+        Slot fresh;
+        fresh.subChunk = subChunk;
+        it = slots_.emplace(chunkY, fresh).first;
+    }
+
+    lastChunkY_ = chunkY;
+    lastSlot_ = &it->second;
+    return lastSlot_;
+}
+
+SubChunk::LocalIndex ColumnBulkWriter::paletteIndex(Slot& slot, BlockTypeId type) {
+    if (slot.lastType != type) {
+        slot.lastType = type;
+        slot.lastIndex = slot.subChunk->bulkPaletteIndex(type);
+    }
+    return slot.lastIndex;
+}
+
+void ColumnBulkWriter::setBlock(int32_t localX, int32_t y, int32_t localZ, BlockTypeId type) {
+    fillRun(localX, localZ, y, y + 1, type);
+}
+
+bool ColumnBulkWriter::replaceBlock(int32_t localX, int32_t y, int32_t localZ,
+                                    BlockTypeId expected, BlockTypeId type) {
+    int32_t chunkY = ChunkColumn::worldYToChunkY(y);
+    Slot* s = slot(chunkY, false);
+    if (!s) {
+        if (!expected.isAir()) {
+            return false;
+        }
+        setBlock(localX, y, localZ, type);
+        return true;
+    }
+
+    // Only found indices are cached: a later write may add expected
+    if (s->lastExpected != expected || s->lastExpectedIndex == SubChunkPalette::INVALID_LOCAL_INDEX) {
+        s->lastExpected = expected;
+        s->lastExpectedIndex = s->subChunk->palette().getLocalIndex(expected);
+        if (s->lastExpectedIndex == SubChunkPalette::INVALID_LOCAL_INDEX) {
+            return false;
+        }
+    }
+    int32_t localY = ChunkColumn::worldYToLocalY(y);
+    uint16_t index = LocalBlockPos(localX, localY, localZ).toIndex();
+    if (s->subChunk->blocks()[index] != s->lastExpectedIndex) {
+        return false;
+    }
+    finished_ = false;
+    ++written_;
+    if (s->recount) {
+        s->subChunk->bulkSetRun(localX, localZ, localY, localY + 1, paletteIndex(*s, type));
+    } else {
+        s->subChunk->bulkSetCounted(static_cast<int32_t>(index), paletteIndex(*s, type));
+    }
+    return true;
+}
+
+void ColumnBulkWriter::fillRun(int32_t localX, int32_t localZ, int32_t y0, int32_t y1,
+                               BlockTypeId type) {
+    finished_ = false;
+    // Air never creates a subchunk; writing it where none exists is a no-op
+    bool create = !type.isAir();
+    while (y0 < y1) {
+        int32_t chunkY = ChunkColumn::worldYToChunkY(y0);
+        int32_t chunkEnd = std::min(y1, (chunkY + 1) * SubChunk::SIZE);
+        if (Slot* s = slot(chunkY, create)) {
+            s->recount = true;
+            written_ += static_cast<uint64_t>(chunkEnd - y0);
+            s->subChunk->bulkSetRun(localX, localZ, ChunkColumn::worldYToLocalY(y0),
+                                    chunkEnd - chunkY * SubChunk::SIZE, paletteIndex(*s, type));
+        }
+        y0 = chunkEnd;
+    }
+}
+
+void ColumnBulkWriter::fillLayers(int32_t y0, int32_t y1, BlockTypeId type) {
+    finished_ = false;
+    bool create = !type.isAir();
+    while (y0 < y1) {
+        int32_t chunkY = ChunkColumn::worldYToChunkY(y0);
+        int32_t chunkEnd = std::min(y1, (chunkY + 1) * SubChunk::SIZE);
+        if (Slot* s = slot(chunkY, create)) {
+            s->recount = true;
+            int32_t localStart = ChunkColumn::worldYToLocalY(y0);
+            int32_t localEnd = chunkEnd - chunkY * SubChunk::SIZE;
+            written_ += static_cast<uint64_t>(localEnd - localStart) * 256;
+            if (localStart == 0 && localEnd == SubChunk::SIZE) {
+                // Whole subchunk: fill() resets the palette to just this type
+                s->subChunk->fill(type);
+                s->lastType = BlockTypeId{};
+                s->lastIndex = 0;
+                s->lastExpected = BlockTypeId{};
+                s->lastExpectedIndex = 0;
+            } else {
+                s->subChunk->bulkSetLayers(localStart, localEnd, paletteIndex(*s, type));
+            }
+        }
+        y0 = chunkEnd;
+    }
+}
+
+void ColumnBulkWriter::finish() {
+    if (finished_) {
+        return;
+    }
+    finished_ = true;
+
+    bool emptied = false;
+    for (auto& [chunkY, s] : slots_) {
+        if (s.recount) {
+            s.subChunk->endBulkWrite();
+        } else {
+            s.subChunk->endSparseWrite();
+        }
+        emptied = emptied || s.subChunk->isEmpty();
+    }
+    slots_.clear();
+    lastSlot_ = nullptr;
+
+    if (emptied) {
+        column_.pruneEmptySubChunks();
+    }
+}
+
+}  // namespace finevox
@@ -1,10 +1,20 @@
 #include "finevox/core/config.hpp"
 #include "finevox/core/config_file.hpp"
 #include "finevox/core/resource_locator.hpp"
+#include <algorithm>
 #include <chrono>
 
 namespace finevox {
 
+namespace {
+
+// LZ4HC_CLEVEL_MIN..LZ4HC_CLEVEL_MAX (same as CompressionPolicy)
+int64_t clampHCLevel(int64_t level) {
+    return std::clamp<int64_t>(level, 3, 12);
+}
+
+}  // namespace
+
 // ============================================================================
 // ConfigManager implementation
 // ============================================================================
@@ -43,6 +53,9 @@ void ConfigManager::init(const std::filesystem::path& configPath) {
 
 void ConfigManager::initKeys() {
     keyCompressionEnabled_ = internKey("compression.enabled");
+    keyCompressionDictionary_ = internKey("compression.dictionary");
+    keyCompressionCodec_ = internKey("compression.codec");
+    keyCompressionHCLevel_ = internKey("compression.hc_level");
     keyDebugLogging_ = internKey("debug.logging");
     keyIoThreadCount_ = internKey("io.thread_count");
     keyMaxOpenRegions_ = internKey("io.max_open_regions");
@@ -108,6 +121,9 @@ std::filesystem::path ConfigManager::configPath() const {
 void ConfigManager::setDefaults() {
     data_.clear();
     data_.set(keyCompressionEnabled_, true);
+    data_.set(keyCompressionDictionary_, false);
+    data_.set(keyCompressionCodec_, std::string("lz4"));
+    data_.set(keyCompressionHCLevel_, 9);
     data_.set(keyDebugLogging_, false);
     data_.set(keyIoThreadCount_, 2);
     data_.set(keyMaxOpenRegions_, 16);
@@ -122,6 +138,15 @@ void ConfigManager::syncFromFile() {
     if (configFile_->has("compression.enabled")) {
         data_.set(keyCompressionEnabled_, configFile_->getBool("compression.enabled", true));
     }
+    if (configFile_->has("compression.dictionary")) {
+        data_.set(keyCompressionDictionary_, configFile_->getBool("compression.dictionary", false));
+    }
+    if (configFile_->has("compression.codec")) {
+        data_.set(keyCompressionCodec_, configFile_->getString("compression.codec", "lz4"));
+    }
+    if (configFile_->has("compression.hc_level")) {
+        data_.set(keyCompressionHCLevel_, clampHCLevel(configFile_->getInt("compression.hc_level", 9)));
+    }
     if (configFile_->has("debug.logging")) {
         data_.set(keyDebugLogging_, configFile_->getBool("debug.logging", false));
     }
@@ -144,6 +169,10 @@ void ConfigManager::syncToFile() {
 
     // Copy values from DataContainer to ConfigFile (using pre-interned keys for reads)
     configFile_->set("compression.enabled", data_.get<bool>(keyCompressionEnabled_, true));
+    configFile_->set("compression.dictionary", data_.get<bool>(keyCompressionDictionary_, false));
+    configFile_->set("compression.codec",
+        std::string_view(data_.get<std::string>(keyCompressionCodec_, "lz4")));
+    configFile_->set("compression.hc_level", data_.get<int64_t>(keyCompressionHCLevel_, 9));
     configFile_->set("debug.logging", data_.get<bool>(keyDebugLogging_, false));
     configFile_->set("io.thread_count", data_.get<int64_t>(keyIoThreadCount_, 2));
     configFile_->set("io.max_open_regions", data_.get<int64_t>(keyMaxOpenRegions_, 16));
@@ -165,6 +194,42 @@ void ConfigManager::setCompressionEnabled(bool enabled) {
     dirty_ = true;
 }
 
+bool ConfigManager::compressionDictionaryEnabled() const {
+    std::shared_lock lock(mutex_);
+    return data_.get<bool>(keyCompressionDictionary_, false);
+}
+
+void ConfigManager::setCompressionDictionaryEnabled(bool enabled) {
+    std::unique_lock lock(mutex_);
+    data_.set(keyCompressionDictionary_, enabled);
+    dirty_ = true;
+}
+
+std::string ConfigManager::compressionCodec() const {
+    std::shared_lock lock(mutex_);
+    return data_.get<std::string>(keyCompressionCodec_, "lz4");
+}
+
+void ConfigManager::setCompressionCodec(const std::string& codec) {
+    std::unique_lock lock(mutex_);
+    // Validate: only "none", "lz4" or "lz4hc" are valid
+    if (codec == "none" || codec == "lz4" || codec == "lz4hc") {
+        data_.set(keyCompressionCodec_, codec);
+        dirty_ = true;
+    }
+}
+
+int ConfigManager::compressionHCLevel() const {
+    std::shared_lock lock(mutex_);
+    return static_cast<int>(data_.get<int64_t>(keyCompressionHCLevel_, 9));
+}
+
+void ConfigManager::setCompressionHCLevel(int level) {
+    std::unique_lock lock(mutex_);
+    data_.set(keyCompressionHCLevel_, clampHCLevel(level));
+    dirty_ = true;
+}
+
 bool ConfigManager::debugLogging() const {
     std::shared_lock lock(mutex_);
     return data_.get<bool>(keyDebugLogging_, false);
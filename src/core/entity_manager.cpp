@@ -3,6 +3,7 @@
 #include "finevox/core/item_drop_entity.hpp"
 #include "finevox/core/world.hpp"
 #include "finevox/core/event_queue.hpp"
+#include "finevox/core/tick_profiler.hpp"
 
 namespace finevox {
 
@@ -110,27 +111,34 @@ const Entity* EntityManager::getLocalPlayer() const {
 void EntityManager::tick(float tickDt) {
     ++currentTick_;
 
-    // 1. Update all entities (AI, animations, timers)
-    for (auto& [id, entity] : entities_) {
-        if (entity->isAlive()) {
-            entity->tick(tickDt, world_);
-            entity->advanceAnimation(tickDt);
+    {
+        TickProfiler::Scope scope(profiler_, TickPhase::EntityPhysics);
+
+        // 1. Update all entities (AI, animations, timers)
+        for (auto& [id, entity] : entities_) {
+            if (entity->isAlive()) {
+                entity->tick(tickDt, world_);
+                entity->advanceAnimation(tickDt);
+            }
         }
-    }
 
-    // 2. Run physics for all entities
-    physicsPass(tickDt);
+        // 2. Run physics for all entities
+        physicsPass(tickDt);
 
-    // 3. Handle chunk transfers
-    processEntityTransfers();
+        // 3. Handle chunk transfers
+        processEntityTransfers();
 
-    // 4. Validate player predictions, generate corrections
-    if (validationEnabled_) {
-        validatePlayerPredictions();
+        // 4. Validate player predictions, generate corrections
+        if (validationEnabled_) {
+            validatePlayerPredictions();
+        }
     }
 
     // 5. Publish snapshots to graphics thread
-    publishSnapshots();
+    {
+        TickProfiler::Scope scope(profiler_, TickPhase::SnapshotPublish);
+        publishSnapshots();
+    }
 
     // 6. Process pending removals
     processPendingRemovals();
@@ -4,26 +4,145 @@
 #include "finevox/core/chunk_column.hpp"  // For ChunkColumn activity timer
 #include "finevox/core/block_type.hpp"    // For BlockRegistry
 #include "finevox/core/block_handler.hpp" // For BlockContext, BlockHandler
+#include "finevox/core/tick_profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <iterator>
+#include <thread>
 
 namespace finevox {
 
+namespace {
+
+// Call the handler method matching a non-lifecycle event
+void dispatchToHandler(BlockHandler& handler, BlockContext& ctx, const BlockEvent& event) {
+    switch (event.type) {
+        case EventType::NeighborChanged:
+            // Call for each changed face
+            event.forEachChangedNeighbor([&](Face face) {
+                handler.onNeighborChanged(ctx, face);
+            });
+            break;
+
+        case EventType::BlockUpdate:
+            handler.onBlockUpdate(ctx);
+            break;
+
+        case EventType::TickGame:
+        case EventType::TickScheduled:
+        case EventType::TickRepeat:
+        case EventType::TickRandom:
+            handler.onTick(ctx, event.tickType);
+            break;
+
+        case EventType::PlayerUse:
+            handler.onUse(ctx, event.face);
+            break;
+
+        case EventType::PlayerHit:
+            handler.onHit(ctx, event.face);
+            break;
+
+        case EventType::RepaintRequested:
+            handler.onRepaint(ctx);
+            break;
+
+        default:
+            // Ignore other event types for now
+            break;
+    }
+}
+
+bool isTickEvent(EventType type) {
+    return type == EventType::TickGame || type == EventType::TickScheduled ||
+           type == EventType::TickRepeat || type == EventType::TickRandom;
+}
+
+// Events that may run on a worker thread (player input stays serial)
+bool isParallelEventType(EventType type) {
+    switch (type) {
+        case EventType::NeighborChanged:
+        case EventType::BlockUpdate:
+        case EventType::TickGame:
+        case EventType::TickScheduled:
+        case EventType::TickRepeat:
+        case EventType::TickRandom:
+        case EventType::RepaintRequested:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Whether handler may take event on a worker. Ticks for batching handlers
+// stay serial so they reach onTickBatch through the round's batches.
+bool runsOnWorker(const BlockHandler& handler, const BlockEvent& event) {
+    return handler.isRegionSafe() && !(isTickEvent(event.type) && handler.wantsTickBatches());
+}
+
+}  // namespace
+
 void EventOutbox::push(BlockEvent event) {
-    EventKey key{event.pos, event.type};
-    auto [it, inserted] = pending_.emplace(key, event);
-    if (!inserted) {
-        // Same event type at same position - merge them
-        it->second = mergeEvents(it->second, event);
+    if ((events_.size() + 1) * 2 > slots_.size()) {
+        grow();
+    }
+
+    const size_t mask = slots_.size() - 1;
+    for (size_t i = slotFor(event.pos, event.type);; i = (i + 1) & mask) {
+        uint64_t slot = slots_[i];
+        if (static_cast<uint32_t>(slot >> 32) != generation_) {
+            slots_[i] = (static_cast<uint64_t>(generation_) << 32) | events_.size();
+            events_.push_back(std::move(event));
+            return;
+        }
+        BlockEvent& existing = events_[static_cast<uint32_t>(slot)];
+        if (existing.type == event.type && existing.pos == event.pos) {
+            // Same event type at same position - merge them
+            existing = mergeEvents(existing, event);
+            return;
+        }
     }
 }
 
 void EventOutbox::swapTo(std::vector<BlockEvent>& inbox) {
-    inbox.reserve(inbox.size() + pending_.size());
+    inbox.insert(inbox.end(), std::make_move_iterator(events_.begin()),
+                 std::make_move_iterator(events_.end()));
+    clear();
+}
 
-    for (auto& [pos, event] : pending_) {
-        inbox.push_back(std::move(event));
+void EventOutbox::clear() {
+    events_.clear();
+    if (++generation_ == 0) {
+        // Wrapped: stale slots could now look current
+        std::fill(slots_.begin(), slots_.end(), 0);
+        generation_ = 1;
     }
+}
+
+size_t EventOutbox::slotFor(const BlockPos& pos, EventType type) const {
+    uint64_t h = static_cast<uint32_t>(pos.x) * 0x9E3779B97F4A7C15ULL;
+    h ^= static_cast<uint32_t>(pos.y) * 0xC2B2AE3D27D4EB4FULL;
+    h ^= static_cast<uint32_t>(pos.z) * 0x165667B19E3779F9ULL;
+    h ^= static_cast<uint64_t>(type) * 0x27D4EB2F165667C5ULL;
+    return static_cast<size_t>(h >> slotShift_);
+}
 
-    pending_.clear();
+void EventOutbox::grow() {
+    size_t capacity = std::max<size_t>(slots_.size() * 2, 64);
+    slots_.assign(capacity, 0);
+    slotShift_ = 64 - std::countr_zero(capacity);
+    generation_ = 1;
+
+    const size_t mask = capacity - 1;
+    for (size_t index = 0; index < events_.size(); ++index) {
+        size_t i = slotFor(events_[index].pos, events_[index].type);
+        while (static_cast<uint32_t>(slots_[i] >> 32) == generation_) {
+            i = (i + 1) & mask;
+        }
+        slots_[i] = (static_cast<uint64_t>(generation_) << 32) | index;
+    }
 }
 
 BlockEvent EventOutbox::mergeEvents(const BlockEvent& existing, const BlockEvent& incoming) {
@@ -74,7 +193,9 @@ UpdateScheduler::UpdateScheduler(World& world)
     }
 }
 
-UpdateScheduler::~UpdateScheduler() = default;
+UpdateScheduler::~UpdateScheduler() {
+    stopWorkers();
+}
 
 void UpdateScheduler::setTickConfig(const TickConfig& config) {
     config_ = config;
@@ -85,49 +206,29 @@ void UpdateScheduler::setTickConfig(const TickConfig& config) {
     }
 }
 
+void UpdateScheduler::setParallelConfig(const ParallelEventConfig& config) {
+    if (config.threads != parallel_.threads) {
+        stopWorkers();  // Restarted at the new size by the next batch
+    }
+    parallel_ = config;
+    parallel_.regionShift = std::clamp(parallel_.regionShift, 0, 8);
+    parallel_.margin = std::max(parallel_.margin, 0);
+}
+
 void UpdateScheduler::scheduleTick(BlockPos pos, int ticksFromNow, TickType type) {
     if (ticksFromNow <= 0) {
         ticksFromNow = 1;  // Minimum 1 tick in the future
     }
 
-    ScheduledTick tick;
-    tick.pos = pos;
-    tick.targetTick = currentTick_ + static_cast<uint64_t>(ticksFromNow);
-    tick.type = type;
-
-    scheduledTicks_.push(tick);
+    scheduledTicks_.schedule(pos, currentTick_ + static_cast<uint64_t>(ticksFromNow), type);
 }
 
 void UpdateScheduler::cancelScheduledTicks(BlockPos pos) {
-    // O(n) operation - rebuild queue without matching position
-    std::vector<ScheduledTick> remaining;
-    remaining.reserve(scheduledTicks_.size());
-
-    while (!scheduledTicks_.empty()) {
-        ScheduledTick tick = scheduledTicks_.top();
-        scheduledTicks_.pop();
-
-        if (tick.pos.x != pos.x || tick.pos.y != pos.y || tick.pos.z != pos.z) {
-            remaining.push_back(tick);
-        }
-    }
-
-    for (const auto& tick : remaining) {
-        scheduledTicks_.push(tick);
-    }
+    scheduledTicks_.cancel(pos);
 }
 
 bool UpdateScheduler::hasScheduledTick(BlockPos pos) const {
-    // Need non-const access to iterate - use a copy
-    auto copy = scheduledTicks_;
-    while (!copy.empty()) {
-        const auto& tick = copy.top();
-        if (tick.pos.x == pos.x && tick.pos.y == pos.y && tick.pos.z == pos.z) {
-            return true;
-        }
-        copy.pop();
-    }
-    return false;
+    return scheduledTicks_.contains(pos);
 }
 
 void UpdateScheduler::pushExternalEvent(BlockEvent event) {
@@ -174,6 +275,11 @@ size_t UpdateScheduler::processEvents() {
 
     // Process until stable
     while (!inbox_.empty() || !outbox_.empty()) {
+        // Large batches go region by region when parallel mode is on
+        if (parallel_.enabled && inbox_.size() >= parallel_.minBatch) {
+            processed += processInboxParallel();
+        }
+
         // Process all events in inbox
         while (!inbox_.empty()) {
             BlockEvent event = std::move(inbox_.back());
@@ -183,6 +289,9 @@ size_t UpdateScheduler::processEvents() {
             ++processed;
         }
 
+        // Ticks collected for batching handlers run after the round
+        flushTickBatches();
+
         // Swap outbox to inbox
         if (!outbox_.empty()) {
             outbox_.swapTo(inbox_);
@@ -196,18 +305,24 @@ void UpdateScheduler::advanceGameTick() {
     ++currentTick_;
 
     // Process deferred events whose chunks are now loaded
-    processDeferredEvents();
+    {
+        TickProfiler::Scope scope(profiler_, TickPhase::DeferredEvents);
+        processDeferredEvents();
+    }
 
     // Generate tick events
     if (config_.gameTicksEnabled) {
+        TickProfiler::Scope scope(profiler_, TickPhase::GameTicks);
         generateGameTickEvents();
     }
 
     if (config_.randomTicksEnabled && config_.randomTicksPerSubchunk > 0) {
+        TickProfiler::Scope scope(profiler_, TickPhase::RandomTicks);
         generateRandomTickEvents();
     }
 
     // Process scheduled ticks that are due
+    TickProfiler::Scope scope(profiler_, TickPhase::ScheduledTicks);
     processScheduledTicks();
 }
 
@@ -312,11 +427,8 @@ bool UpdateScheduler::processEvent(const BlockEvent& event) {
         // (Re-read block type in case handler changed it)
         BlockTypeId currentType = subchunk->getBlock(
             event.localPos.x, event.localPos.y, event.localPos.z);
-        if (!currentType.isAir()) {
-            const BlockType& typeInfo = BlockRegistry::global().getType(currentType);
-            if (typeInfo.wantsGameTicks()) {
-                subchunk->registerForGameTicks(localIndex);
-            }
+        if (!currentType.isAir() && BlockRegistry::global().wantsGameTicks(currentType)) {
+            subchunk->registerForGameTicks(localIndex);
         }
 
         // Enqueue lighting update with smart remesh deferral
@@ -334,60 +446,292 @@ bool UpdateScheduler::processEvent(const BlockEvent& event) {
     // Look up handler (may be null for simple blocks)
     BlockHandler* handler = BlockRegistry::global().getHandler(blockType);
 
+    if (handler && isTickEvent(event.type) && handler->wantsTickBatches()) {
+        queueTickBatch(event, blockType, handler);
+        return true;
+    }
+
     // Create context for handler calls
     BlockContext ctx(world_, *subchunk, event.pos, event.localPos);
     ctx.setScheduler(this);
 
-    switch (event.type) {
+    if (handler) {
+        dispatchToHandler(*handler, ctx, event);
+    }
 
-        case EventType::NeighborChanged:
-            if (handler) {
-                // Call for each changed face
-                event.forEachChangedNeighbor([&](Face face) {
-                    handler->onNeighborChanged(ctx, face);
-                });
-            }
-            break;
+    return true;  // Event was processed
+}
 
-        case EventType::BlockUpdate:
-            if (handler) {
-                handler->onBlockUpdate(ctx);
-            }
-            break;
+// ============================================================================
+// Batched ticks
+// ============================================================================
 
-        case EventType::TickGame:
-        case EventType::TickScheduled:
-        case EventType::TickRepeat:
-        case EventType::TickRandom:
-            if (handler) {
-                handler->onTick(ctx, event.tickType);
+void UpdateScheduler::queueTickBatch(const BlockEvent& event, BlockTypeId blockType, BlockHandler* handler) {
+    if (lastTickBatch_ < tickBatchCount_) {
+        TickBatch& last = tickBatches_[lastTickBatch_];
+        if (last.chunkPos == event.chunkPos && last.blockType == blockType && last.tickType == event.tickType) {
+            last.blocks.emplace_back(event.pos, event.localPos);
+            return;
+        }
+    }
+
+    TickBatchKey key{event.chunkPos, blockType, event.tickType};
+    auto [it, inserted] = tickBatchIndex_.try_emplace(key, tickBatchCount_);
+    if (inserted) {
+        if (tickBatchCount_ == tickBatches_.size()) {
+            tickBatches_.emplace_back();
+        }
+        TickBatch& batch = tickBatches_[tickBatchCount_++];
+        batch.chunkPos = event.chunkPos;
+        batch.blockType = blockType;
+        batch.tickType = event.tickType;
+        batch.handler = handler;
+    }
+    lastTickBatch_ = it->second;
+    tickBatches_[lastTickBatch_].blocks.emplace_back(event.pos, event.localPos);
+}
+
+void UpdateScheduler::flushTickBatches() {
+    BlockRegistry& registry = BlockRegistry::global();
+
+    for (size_t b = 0; b < tickBatchCount_; ++b) {
+        TickBatch& batch = tickBatches_[b];
+
+        // Held for the whole batch: a handler emptying the subchunk must not
+        // free it under the remaining contexts
+        std::shared_ptr<SubChunk> subchunk = world_.getSubChunkShared(batch.chunkPos);
+        if (!subchunk) {
+            batch.blocks.clear();  // Unloaded since queued: dropped like any tick
+            continue;
+        }
+
+        batchContexts_.clear();
+        for (const auto& [pos, localPos] : batch.blocks) {
+            BlockTypeId type = subchunk->getBlock(localPos.x, localPos.y, localPos.z);
+            if (type == batch.blockType) {
+                batchContexts_.emplace_back(world_, *subchunk, pos, localPos).setScheduler(this);
+                continue;
             }
-            break;
 
-        case EventType::PlayerUse:
+            // Replaced earlier this round: per-event path for the new type
+            BlockHandler* handler = type.isAir() ? nullptr : registry.getHandler(type);
             if (handler) {
-                handler->onUse(ctx, event.face);
+                BlockContext ctx(world_, *subchunk, pos, localPos);
+                ctx.setScheduler(this);
+                handler->onTick(ctx, batch.tickType);
             }
-            break;
+        }
+        batch.blocks.clear();
 
-        case EventType::PlayerHit:
-            if (handler) {
-                handler->onHit(ctx, event.face);
+        if (!batchContexts_.empty()) {
+            batchedTicks_ += batchContexts_.size();
+            batch.handler->onTickBatch(batchContexts_, batch.tickType);
+        }
+    }
+
+    tickBatchCount_ = 0;
+    lastTickBatch_ = 0;
+    tickBatchIndex_.clear();
+}
+
+// ============================================================================
+// Region-partitioned processing
+// ============================================================================
+
+size_t UpdateScheduler::processInboxParallel() {
+    std::vector<BlockEvent> batch;
+    batch.swap(inbox_);
+    const size_t count = batch.size();
+
+    struct Region {
+        BlockPos key;                 // Region coordinates
+        std::vector<size_t> events;   // Indices into batch, in batch order
+        std::vector<SubChunk*> subchunks;
+        std::vector<size_t> fallback; // Became unsafe mid-batch (block changed type)
+        DeferredBlockEffects effects;
+        size_t dispatched = 0;        // Events that reached a handler
+    };
+
+    const int32_t shift = 4 + parallel_.regionShift;
+    const int32_t size = 1 << shift;
+    const int32_t margin = parallel_.margin;
+    auto interior = [&](int32_t coord) {
+        int32_t local = coord & (size - 1);
+        return local >= margin && local < size - margin;
+    };
+
+    BlockRegistry& registry = BlockRegistry::global();
+    std::vector<Region> regions;
+    std::unordered_map<BlockPos, size_t> regionIndex;
+    std::vector<size_t> serial;
+
+    for (size_t i = 0; i < count; ++i) {
+        const BlockEvent& event = batch[i];
+        SubChunk* subchunk = nullptr;
+        bool eligible = isParallelEventType(event.type) &&
+                        interior(event.pos.x) && interior(event.pos.y) && interior(event.pos.z);
+        if (eligible) {
+            subchunk = world_.getSubChunk(event.chunkPos);
+            eligible = subchunk != nullptr;
+        }
+        if (eligible) {
+            BlockTypeId type = subchunk->getBlock(event.localPos.x, event.localPos.y, event.localPos.z);
+            BlockHandler* handler = type.isAir() ? nullptr : registry.getHandler(type);
+            eligible = handler && runsOnWorker(*handler, event);
+        }
+        if (!eligible) {
+            serial.push_back(i);
+            continue;
+        }
+
+        if (event.type == EventType::BlockUpdate) {
+            if (ChunkColumn* column = world_.getColumn(ColumnPos{event.chunkPos.x, event.chunkPos.z})) {
+                column->touchActivity();
             }
-            break;
+        }
 
-        case EventType::RepaintRequested:
-            if (handler) {
-                handler->onRepaint(ctx);
+        BlockPos key(event.pos.x >> shift, event.pos.y >> shift, event.pos.z >> shift);
+        auto [it, inserted] = regionIndex.try_emplace(key, regions.size());
+        if (inserted) {
+            regions.push_back(Region{key, {}, {}, {}, {}});
+        }
+        regions[it->second].events.push_back(i);
+        regions[it->second].subchunks.push_back(subchunk);
+    }
+
+    // Regions are independent: interior events only touch their own region,
+    // and nothing else runs until every worker is done
+    auto runRegion = [&](Region& region) {
+        for (size_t j = 0; j < region.events.size(); ++j) {
+            const BlockEvent& event = batch[region.events[j]];
+            SubChunk& subchunk = *region.subchunks[j];
+
+            // An earlier event in this region may have replaced the block
+            BlockTypeId type = subchunk.getBlock(event.localPos.x, event.localPos.y, event.localPos.z);
+            if (type.isAir()) {
+                continue;
+            }
+            BlockHandler* handler = registry.getHandler(type);
+            if (!handler) {
+                continue;
+            }
+            if (!runsOnWorker(*handler, event)) {
+                region.fallback.push_back(region.events[j]);
+                continue;
             }
-            break;
 
-        default:
-            // Ignore other event types for now
-            break;
+            BlockContext ctx(world_, subchunk, event.pos, event.localPos);
+            ctx.setScheduler(this);
+            ctx.setDeferredEffects(&region.effects);
+            dispatchToHandler(*handler, ctx, event);
+            ++region.dispatched;
+        }
+    };
+
+    std::atomic<size_t> next{0};
+    std::function<void()> worker = [&] {
+        for (size_t r = next.fetch_add(1); r < regions.size(); r = next.fetch_add(1)) {
+            runRegion(regions[r]);
+        }
+    };
+    size_t threads = parallel_.threads != 0 ? parallel_.threads
+                                            : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    if (regions.size() > 1) {
+        runOnWorkers(threads, worker);
+    } else {
+        worker();
     }
 
-    return true;  // Event was processed
+    // Merge on the game thread in region order, then run everything that had
+    // to stay serial in batch order
+    std::sort(regions.begin(), regions.end(), [](const Region& a, const Region& b) {
+        return a.key < b.key;
+    });
+    for (Region& region : regions) {
+        parallelEvents_ += region.dispatched;
+        applyDeferredEffects(region.effects);
+        serial.insert(serial.end(), region.fallback.begin(), region.fallback.end());
+    }
+    std::sort(serial.begin(), serial.end());
+    for (size_t i : serial) {
+        processEvent(batch[i]);
+    }
+
+    return count;
+}
+
+void UpdateScheduler::runOnWorkers(size_t threads, const std::function<void()>& job) {
+    {
+        std::lock_guard lock(workMutex_);
+        stopWorkers_ = false;
+    }
+    while (workers_.size() + 1 < threads) {
+        // Only this thread bumps jobGeneration_
+        workers_.emplace_back(&UpdateScheduler::workerLoop, this, jobGeneration_);
+    }
+    if (workers_.empty()) {
+        job();
+        return;
+    }
+
+    {
+        std::lock_guard lock(workMutex_);
+        job_ = &job;
+        workersRunning_ = workers_.size();
+        ++jobGeneration_;
+    }
+    workCv_.notify_all();
+    job();
+
+    std::unique_lock lock(workMutex_);
+    workDoneCv_.wait(lock, [this] { return workersRunning_ == 0; });
+    job_ = nullptr;
+}
+
+void UpdateScheduler::workerLoop(uint64_t seen) {
+    std::unique_lock lock(workMutex_);
+    while (true) {
+        workCv_.wait(lock, [&] { return stopWorkers_ || jobGeneration_ != seen; });
+        if (stopWorkers_) {
+            return;
+        }
+        seen = jobGeneration_;
+        const std::function<void()>* job = job_;
+        lock.unlock();
+        (*job)();
+        lock.lock();
+        if (--workersRunning_ == 0) {
+            workDoneCv_.notify_one();
+        }
+    }
+}
+
+void UpdateScheduler::stopWorkers() {
+    {
+        std::lock_guard lock(workMutex_);
+        stopWorkers_ = true;
+    }
+    workCv_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+}
+
+void UpdateScheduler::applyDeferredEffects(DeferredBlockEffects& effects) {
+    for (const auto& tick : effects.ticks) {
+        scheduleTick(tick.pos, tick.ticksFromNow, tick.type);
+    }
+    for (auto& event : effects.events) {
+        outbox_.push(std::move(event));
+    }
+    for (const BlockPos& pos : effects.neighborNotifies) {
+        if (SubChunk* subchunk = world_.getSubChunk(ChunkPos::fromBlock(pos))) {
+            BlockContext ctx(world_, *subchunk, pos, pos.local());
+            ctx.setScheduler(this);
+            ctx.notifyNeighbors();
+        }
+    }
 }
 
 void UpdateScheduler::generateGameTickEvents() {
@@ -407,34 +751,48 @@ void UpdateScheduler::generateGameTickEvents() {
 }
 
 void UpdateScheduler::generateRandomTickEvents() {
-    std::uniform_int_distribution<int32_t> dist(0, SubChunk::VOLUME - 1);
-
-    auto subchunkPositions = world_.getAllSubChunkPositions();
-
-    for (const ChunkPos& chunkPos : subchunkPositions) {
-        SubChunk* subchunk = world_.getSubChunk(chunkPos);
-        if (!subchunk) continue;
+    // One draw from the seeded generator per game tick; each subchunk derives
+    // its own stream from it, so results do not depend on iteration order
+    uint64_t tickSalt = static_cast<uint64_t>(rng_()) << 32;
+    tickSalt |= rng_();
+    const uint32_t attempts = config_.randomTicksPerSubchunk;
+
+    // Only subchunks holding a random-tickable type are visited
+    world_.forEachRandomTickSubChunk([&](ChunkPos chunkPos, SubChunk& subchunk) {
+        if (!subchunk.hasRandomTickBlocks()) {
+            return;
+        }
 
-        // Generate N random tick positions
-        for (uint32_t i = 0; i < config_.randomTicksPerSubchunk; ++i) {
-            int32_t localIndex = dist(rng_);
-            BlockPos worldPos = chunkPos.toWorld(localIndex);
+        // SplitMix64-style stream; each 64-bit draw yields five 12-bit indices
+        uint64_t state = tickSalt ^ (chunkPos.pack() * 0x9e3779b97f4a7c15ULL);
+        uint64_t bits = 0;
+        int available = 0;
+        for (uint32_t i = 0; i < attempts; ++i) {
+            if (available == 0) {
+                uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+                bits = z ^ (z >> 31);
+                available = 5;
+            }
+            auto localIndex = static_cast<int32_t>(bits & (SubChunk::VOLUME - 1));
+            bits >>= 12;
+            --available;
 
-            // Only generate tick if block is not air
-            BlockTypeId blockType = subchunk->getBlock(localIndex);
-            if (!blockType.isAir()) {
-                outbox_.push(BlockEvent::tick(worldPos, TickType::Random));
+            // Blocks whose type does not want random ticks never get one
+            if (subchunk.wantsRandomTick(localIndex)) {
+                outbox_.push(BlockEvent::tick(chunkPos.toWorld(localIndex), TickType::Random));
             }
         }
-    }
+    });
 }
 
 void UpdateScheduler::processScheduledTicks() {
-    while (!scheduledTicks_.empty() && scheduledTicks_.top().targetTick <= currentTick_) {
-        ScheduledTick tick = scheduledTicks_.top();
-        scheduledTicks_.pop();
+    dueTicks_.clear();
+    scheduledTicks_.advanceTo(currentTick_, dueTicks_);
 
-        // Generate event for this scheduled tick
+    // Generate events in target order, then scheduling order
+    for (const auto& tick : dueTicks_) {
         outbox_.push(BlockEvent::tick(tick.pos, tick.type));
     }
 }
@@ -8,6 +8,7 @@
 #include "finevox/core/graphics_event_queue.hpp"
 #include "finevox/core/block_type.hpp"
 #include "finevox/core/block_event.hpp"
+#include "finevox/core/tick_profiler.hpp"
 
 #include <thread>
 #include <atomic>
@@ -143,6 +144,10 @@ static void executeCommand(World& world, UpdateScheduler& scheduler,
 // ============================================================================
 
 struct GameSession::Impl {
+    // Tick phase timing (wired to subsystems when config.profileTicks);
+    // declared first so it outlives everything holding a pointer to it
+    TickProfiler profiler;
+
     // Owned subsystems (order matters for destruction)
     std::unique_ptr<World> world;
     std::unique_ptr<UpdateScheduler> scheduler;
@@ -170,12 +175,33 @@ struct GameSession::Impl {
         auto commands = commandQueue->drainAll();
         if (commands.empty()) return;
 
+        TickProfiler::Scope scope(activeProfiler(), TickPhase::Commands);
         for (const auto& cmd : commands) {
             executeCommand(*world, *scheduler, *entityManager, cmd);
         }
         scheduler->processEvents();
     }
 
+    TickProfiler* activeProfiler() {
+        return config.profileTicks ? &profiler : nullptr;
+    }
+
+    // One game tick: time, scheduler, events, entities
+    void runTick(float dt) {
+        TickProfiler* p = activeProfiler();
+        if (p) p->beginTick();
+
+        worldTime->advance(dt);
+        scheduler->advanceGameTick();
+        {
+            TickProfiler::Scope scope(p, TickPhase::EventProcessing);
+            scheduler->processEvents();
+        }
+        entityManager->tick(dt);
+
+        if (p) p->endTick();
+    }
+
     // Game thread main loop
     void gameThreadLoop() {
         using Clock = std::chrono::steady_clock;
@@ -195,10 +221,7 @@ struct GameSession::Impl {
             auto now = Clock::now();
             int catchup = 0;
             while (now >= nextTickTime && catchup < 10) {
-                worldTime->advance(tickDt);
-                scheduler->advanceGameTick();
-                scheduler->processEvents();
-                entityManager->tick(tickDt);
+                runTick(tickDt);
 
                 nextTickTime += tickInterval;
                 ++catchup;
@@ -206,7 +229,12 @@ struct GameSession::Impl {
 
             // If we fell behind too much, skip ahead
             if (catchup >= 10 && Clock::now() >= nextTickTime) {
-                nextTickTime = Clock::now() + tickInterval;
+                auto resumeAt = Clock::now();
+                if (TickProfiler* p = activeProfiler()) {
+                    // Every tick due up to now is dropped
+                    p->addSkippedTicks(static_cast<uint64_t>((resumeAt - nextTickTime) / tickInterval) + 1);
+                }
+                nextTickTime = resumeAt + tickInterval;
             }
 
             // 3. Set next tick alarm
@@ -264,6 +292,10 @@ std::unique_ptr<GameSession> GameSession::createLocal(const GameSessionConfig& c
     impl.actions = std::make_unique<LocalGameActions>(
         *impl.world, *impl.soundQueue, *impl.commandQueue);
 
+    // Tick profiling
+    impl.scheduler->setProfiler(impl.activeProfiler());
+    impl.entityManager->setProfiler(impl.activeProfiler());
+
     return session;
 }
 
@@ -312,6 +344,16 @@ bool GameSession::isGameThreadRunning() const {
     return impl_->gameThreadRunning.load(std::memory_order_acquire);
 }
 
+// ============================================================================
+// Tick Profiling
+// ============================================================================
+
+TickProfileSnapshot GameSession::tickProfile() const {
+    return impl_->profiler.snapshot();
+}
+
+TickProfiler& GameSession::tickProfiler() { return impl_->profiler; }
+
 // ============================================================================
 // Synchronous Tick (backwards compat, for tests)
 // ============================================================================
@@ -322,15 +364,9 @@ void GameSession::tick(float dt) {
     // Drain pending commands from the queue (actions pushed from calling thread)
     impl_->drainAndExecuteCommands();
 
-    // Advance world time
-    impl_->worldTime->advance(dt);
-
-    // Process scheduled ticks + external events
-    impl_->scheduler->advanceGameTick();
-    impl_->scheduler->processEvents();
-
-    // Tick entities (publishes snapshots to graphics queue)
-    impl_->entityManager->tick(dt);
+    // Advance world time, process scheduled ticks + external events, and
+    // tick entities (publishes snapshots to graphics queue)
+    impl_->runTick(dt);
 }
 
 }  // namespace finevox
@@ -2,6 +2,7 @@
 #include "finevox/core/resource_locator.hpp"
 #include "finevox/core/serialization.hpp"
 #include <algorithm>
+#include <array>
 
 namespace finevox {
 
@@ -71,7 +72,16 @@ void IOManager::queueSave(ColumnPos pos, const ChunkColumn& column, SaveCallback
     auto serialized = ColumnSerializer::toCBOR(column, pos.x, pos.z);
 
     std::lock_guard lock(saveMutex_);
-    saveQueue_.push_back({pos, std::move(serialized), std::move(callback)});
+    saveQueue_.push_back({pos, std::move(serialized), std::move(callback), std::nullopt});
+    saveCond_.notify_one();
+}
+
+void IOManager::queueSave(ColumnPos pos, const ChunkColumn& column, const CompressionPolicy& policy,
+                          SaveCallback callback) {
+    auto serialized = ColumnSerializer::toCBOR(column, pos.x, pos.z);
+
+    std::lock_guard lock(saveMutex_);
+    saveQueue_.push_back({pos, std::move(serialized), std::move(callback), policy});
     saveCond_.notify_one();
 }
 
@@ -110,12 +120,89 @@ size_t IOManager::regionFileCount() const {
     return regionFiles_.size();
 }
 
+size_t IOManager::cachedIndexCount() const {
+    std::lock_guard lock(regionMutex_);
+    return regionIndexes_.size();
+}
+
 void IOManager::setMaxOpenRegions(size_t count) {
     std::lock_guard lock(regionMutex_);
-    maxOpenRegions_ = count;
-    while (regionFiles_.size() > maxOpenRegions_) {
-        evictOldestRegion();
+    for (auto& [key, handle] : regionFiles_.setCapacity(std::max<size_t>(count, 1))) {
+        retireRegion(key, std::move(handle));
+    }
+}
+
+void IOManager::setMaxCachedIndexes(size_t count) {
+    std::lock_guard lock(regionMutex_);
+    indexCacheEnabled_ = count > 0;
+    if (!indexCacheEnabled_) {
+        regionIndexes_.clear();
+    }
+    (void)regionIndexes_.setCapacity(std::max<size_t>(count, 1));
+}
+
+void IOManager::setColdRegionRecompression(const CompressionPolicy& policy,
+                                           std::chrono::milliseconds idleTime) {
+    {
+        std::lock_guard lock(regionMutex_);
+        coldPolicy_ = policy;
+        coldIdleTime_ = idleTime;
+        archivedRegions_.clear();
+    }
+    // Let an idle save thread pick up the new check interval
+    std::lock_guard lock(saveMutex_);
+    saveCond_.notify_all();
+}
+
+void IOManager::disableColdRegionRecompression() {
+    std::lock_guard lock(regionMutex_);
+    coldPolicy_.reset();
+    archivedRegions_.clear();
+}
+
+size_t IOManager::recompressColdRegions(size_t maxRegions) {
+    // Pick candidates under regionMutex_, then rewrite each under its own
+    // handle lock so loads from other regions aren't held up
+    std::optional<CompressionPolicy> policy;
+    std::vector<std::pair<uint64_t, RegionHandlePtr>> candidates;
+    {
+        std::lock_guard lock(regionMutex_);
+        if (!coldPolicy_) {
+            return 0;
+        }
+        policy = coldPolicy_;
+
+        auto now = std::chrono::steady_clock::now();
+        regionFiles_.forEach([&](uint64_t key, const RegionHandlePtr& handle) {
+            if (candidates.size() >= maxRegions || archivedRegions_.contains(key)) {
+                return;
+            }
+            auto accessIt = regionLastAccess_.find(key);
+            if (accessIt != regionLastAccess_.end() && now - accessIt->second < coldIdleTime_) {
+                return;
+            }
+            candidates.emplace_back(key, handle);
+        });
+    }
+
+    size_t rewritten = 0;
+    for (auto& [key, handle] : candidates) {
+        {
+            std::lock_guard handleLock(handle->mutex);
+            rewritten += handle->file->recompress(*policy);
+        }
+        std::lock_guard lock(regionMutex_);
+        archivedRegions_.insert(key);
+    }
+    return rewritten;
+}
+
+std::optional<std::chrono::milliseconds> IOManager::coldCheckInterval() const {
+    std::lock_guard lock(regionMutex_);
+    if (!coldPolicy_) {
+        return std::nullopt;
     }
+    return std::max(coldIdleTime_, std::chrono::milliseconds(1));
 }
 
 // ============================================================================
@@ -148,17 +235,30 @@ void IOManager::loadThreadFunc() {
         // Perform load (outside lock)
         std::unique_ptr<ChunkColumn> column;
 
-        RegionPos regionPos = RegionPos::fromColumn(request.pos);
-        RegionFile* region = getOrOpenRegion(regionPos);
+        std::optional<std::vector<uint8_t>> prefetched;
+        {
+            std::lock_guard lock(readAheadMutex_);
+            prefetched = readAhead_.remove(request.pos.pack());
+        }
 
-        if (region) {
-            column = region->loadColumn(request.pos);
+        if (prefetched) {
+            stats_.readAheadHits.fetch_add(1, std::memory_order_relaxed);
+            int32_t x, z;
+            column = ColumnSerializer::fromCBOR(*prefetched, &x, &z);
+        } else {
+            auto handle = getOrOpenRegion(RegionPos::fromColumn(request.pos));
+            std::lock_guard handleLock(handle->mutex);
+            column = handle->file->loadColumn(request.pos);
         }
 
         // Invoke callback
         if (request.callback) {
             request.callback(request.pos, std::move(column));
         }
+
+        if (readAheadEnabled_) {
+            readAheadAcrossBorder(request.pos);
+        }
     }
 }
 
@@ -167,32 +267,52 @@ void IOManager::saveThreadFunc() {
         SaveRequest request;
 
         // Get next request
+        bool idle = false;
         {
+            auto checkInterval = coldCheckInterval();
             std::unique_lock lock(saveMutex_);
-            saveCond_.wait(lock, [this] {
+            auto ready = [this] {
                 return !saveQueue_.empty() || !running_;
-            });
+            };
+            if (checkInterval) {
+                saveCond_.wait_for(lock, *checkInterval, ready);
+            } else {
+                saveCond_.wait(lock, ready);
+            }
 
             if (!running_ && saveQueue_.empty()) {
                 break;
             }
 
             if (saveQueue_.empty()) {
-                continue;
+                idle = true;
+            } else {
+                request = std::move(saveQueue_.front());
+                saveQueue_.erase(saveQueue_.begin());
             }
+        }
 
-            request = std::move(saveQueue_.front());
-            saveQueue_.erase(saveQueue_.begin());
+        // Nothing to save: spend the idle time archiving one cold region
+        if (idle) {
+            recompressColdRegions(1);
+            continue;
         }
 
         // Perform save (outside lock)
         bool success = false;
 
-        RegionPos regionPos = RegionPos::fromColumn(request.pos);
-        RegionFile* region = getOrOpenRegion(regionPos);
-
-        if (region) {
-            success = region->saveColumnRaw(request.pos, request.serializedData);
+        auto handle = getOrOpenRegion(RegionPos::fromColumn(request.pos), true);
+        {
+            std::lock_guard handleLock(handle->mutex);
+            RegionFile& region = *handle->file;
+            success = request.policy
+                ? region.saveColumnRaw(request.pos, request.serializedData, *request.policy)
+                : region.saveColumnRaw(request.pos, request.serializedData);
+
+            // Drop any read-ahead copy while still holding the region, so a
+            // concurrent read-ahead can't reinsert the old data afterwards
+            std::lock_guard lock(readAheadMutex_);
+            (void)readAhead_.remove(request.pos.pack());
         }
 
         // Invoke callback
@@ -206,35 +326,106 @@ void IOManager::saveThreadFunc() {
 // Region file management
 // ============================================================================
 
-RegionFile* IOManager::getOrOpenRegion(RegionPos pos) {
-    uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(pos.rx)) << 32) |
-                   static_cast<uint64_t>(static_cast<uint32_t>(pos.rz));
+uint64_t IOManager::regionKey(RegionPos pos) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(pos.rx)) << 32) |
+           static_cast<uint64_t>(static_cast<uint32_t>(pos.rz));
+}
+
+IOManager::RegionHandlePtr IOManager::getOrOpenRegion(RegionPos pos, bool forWrite) {
+    uint64_t key = regionKey(pos);
 
     std::lock_guard lock(regionMutex_);
 
-    auto it = regionFiles_.find(key);
-    if (it != regionFiles_.end()) {
-        return it->second.get();
+    regionLastAccess_[key] = std::chrono::steady_clock::now();
+    if (forWrite) {
+        archivedRegions_.erase(key);  // New writes use the normal policy
+    }
+
+    if (auto handle = regionFiles_.get(key)) {
+        return *handle;
+    }
+
+    // Still held by a thread since its eviction: take it back
+    RegionHandlePtr handle;
+    if (auto it = retiredRegions_.find(key); it != retiredRegions_.end()) {
+        handle = it->second.lock();
+        retiredRegions_.erase(it);
+    }
+
+    if (!handle) {
+        handle = std::make_shared<RegionHandle>();
+        if (auto index = regionIndexes_.remove(key)) {
+            handle->file = std::make_unique<RegionFile>(worldPath_, pos, std::move(*index));
+        } else {
+            handle->file = std::make_unique<RegionFile>(worldPath_, pos);
+        }
+        stats_.regionOpens.fetch_add(1, std::memory_order_relaxed);
+        if (handle->file->indexReused()) {
+            stats_.indexCacheHits.fetch_add(1, std::memory_order_relaxed);
+        }
     }
 
-    // Evict if at capacity
-    while (regionFiles_.size() >= maxOpenRegions_) {
-        evictOldestRegion();
+    if (auto evicted = regionFiles_.put(key, handle)) {
+        retireRegion(evicted->first, std::move(evicted->second));
     }
+    return handle;
+}
 
-    // Open new region file
-    auto region = std::make_unique<RegionFile>(worldPath_, pos);
-    auto* ptr = region.get();
-    regionFiles_[key] = std::move(region);
+void IOManager::retireRegion(uint64_t key, RegionHandlePtr handle) {
+    regionLastAccess_.erase(key);
+    archivedRegions_.erase(key);
+    std::erase_if(retiredRegions_, [](const auto& entry) { return entry.second.expired(); });
 
-    return ptr;
+    if (handle.use_count() > 1) {
+        // In use by the other I/O thread; it closes when released
+        retiredRegions_[key] = handle;
+        return;
+    }
+
+    // Nobody else can reach the handle (copies are only made under
+    // regionMutex_), so the index can be captured without its lock
+    if (indexCacheEnabled_) {
+        (void)regionIndexes_.put(key, handle->file->captureIndex());
+    }
 }
 
-void IOManager::evictOldestRegion() {
-    // Simple eviction: just remove the first one
-    // A real implementation would track access time
-    if (!regionFiles_.empty()) {
-        regionFiles_.erase(regionFiles_.begin());
+void IOManager::readAheadAcrossBorder(ColumnPos pos) {
+    auto [lx, lz] = RegionPos::toLocal(pos);
+    int32_t dx = lx == 0 ? -1 : (lx == REGION_SIZE - 1 ? 1 : 0);
+    int32_t dz = lz == 0 ? -1 : (lz == REGION_SIZE - 1 ? 1 : 0);
+    if (dx == 0 && dz == 0) {
+        return;  // Not on a region edge
+    }
+
+    std::array<ColumnPos, 3> neighbors;
+    size_t count = 0;
+    if (dx != 0) neighbors[count++] = ColumnPos{pos.x + dx, pos.z};
+    if (dz != 0) neighbors[count++] = ColumnPos{pos.x, pos.z + dz};
+    if (dx != 0 && dz != 0) neighbors[count++] = ColumnPos{pos.x + dx, pos.z + dz};
+
+    for (size_t i = 0; i < count; ++i) {
+        ColumnPos neighbor = neighbors[i];
+        {
+            std::lock_guard lock(readAheadMutex_);
+            if (readAhead_.contains(neighbor.pack())) {
+                continue;
+            }
+        }
+
+        // Opening the region also warms its index for the loads to come
+        auto handle = getOrOpenRegion(RegionPos::fromColumn(neighbor));
+        std::lock_guard handleLock(handle->mutex);
+        if (!handle->file->hasColumn(neighbor)) {
+            continue;
+        }
+        auto data = handle->file->loadColumnRaw(neighbor);
+        if (data.empty()) {
+            continue;
+        }
+
+        std::lock_guard lock(readAheadMutex_);
+        (void)readAhead_.put(neighbor.pack(), std::move(data));
+        stats_.readAheadColumns.fetch_add(1, std::memory_order_relaxed);
     }
 }
 
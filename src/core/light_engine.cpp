@@ -184,24 +184,21 @@ uint8_t LightEngine::getAttenuation(BlockTypeId blockType) const {
         // For standard lookup, use the block type's base attenuation
     }
 
-    const BlockType& type = BlockRegistry::global().getType(blockType);
-    return type.lightAttenuation();
+    return BlockRegistry::global().lightAttenuation(blockType);
 }
 
 bool LightEngine::blocksSkyLight(BlockTypeId blockType) const {
     if (blockType.isAir()) {
         return false;
     }
-    const BlockType& type = BlockRegistry::global().getType(blockType);
-    return type.blocksSkyLight();
+    return BlockRegistry::global().blocksSkyLight(blockType);
 }
 
 uint8_t LightEngine::getLightEmission(BlockTypeId blockType) const {
     if (blockType.isAir()) {
         return 0;
     }
-    const BlockType& type = BlockRegistry::global().getType(blockType);
-    return type.lightEmission();
+    return BlockRegistry::global().lightEmission(blockType);
 }
 
 // ============================================================================
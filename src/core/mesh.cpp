@@ -1,6 +1,7 @@
 #include "finevox/core/mesh.hpp"
 #include "finevox/core/subchunk.hpp"
 #include "finevox/core/world.hpp"
+#include "finevox/core/block_type.hpp"
 
 namespace finevox {
 
@@ -191,9 +192,9 @@ SubChunkMeshData MeshBuilder::buildSubChunkMeshSplit(
     const BlockTextureProvider& textureProvider
 ) {
     // Create opaque provider that checks the world
-    BlockOpaqueProvider opaqueProvider = [&world](const BlockPos& pos) -> bool {
-        BlockTypeId type = world.getBlock(pos);
-        return type != AIR_BLOCK_TYPE;
+    const BlockRegistry& registry = BlockRegistry::global();
+    BlockOpaqueProvider opaqueProvider = [&world, &registry](const BlockPos& pos) -> bool {
+        return registry.isOpaque(world.getBlock(pos));
     };
 
     return buildSubChunkMeshSplit(subChunk, chunkPos, opaqueProvider, transparentProvider, textureProvider);
@@ -820,11 +821,9 @@ MeshData MeshBuilder::buildSubChunkMesh(
     const BlockTextureProvider& textureProvider
 ) {
     // Create opaque provider that checks the world
-    BlockOpaqueProvider opaqueProvider = [&world](const BlockPos& pos) -> bool {
-        BlockTypeId type = world.getBlock(pos);
-        // For now, any non-air block is considered opaque
-        // TODO: Add transparency support via block type registry
-        return type != AIR_BLOCK_TYPE;
+    const BlockRegistry& registry = BlockRegistry::global();
+    BlockOpaqueProvider opaqueProvider = [&world, &registry](const BlockPos& pos) -> bool {
+        return registry.isOpaque(world.getBlock(pos));
     };
 
     return buildSubChunkMesh(subChunk, chunkPos, opaqueProvider, textureProvider);
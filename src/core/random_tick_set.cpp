@@ -0,0 +1,47 @@
+/**
+ * @file random_tick_set.cpp
+ * @brief Set of subchunks that contain random-tickable block types
+ *
+ * Design: [24-event-system.md] §24.14 Random Ticks
+ */
+
+#include "finevox/core/random_tick_set.hpp"
+
+namespace finevox {
+
+void RandomTickSet::add(ChunkPos pos) {
+    std::lock_guard lock(mutex_);
+    auto [it, inserted] = slots_.try_emplace(pos, static_cast<uint32_t>(positions_.size()));
+    if (inserted) {
+        positions_.push_back(pos);
+    }
+}
+
+void RandomTickSet::remove(ChunkPos pos) {
+    std::lock_guard lock(mutex_);
+    auto it = slots_.find(pos);
+    if (it == slots_.end()) {
+        return;
+    }
+
+    // Move the last position into the freed slot
+    uint32_t slot = it->second;
+    slots_.erase(it);
+    if (slot + 1 != positions_.size()) {
+        positions_[slot] = positions_.back();
+        slots_[positions_[slot]] = slot;
+    }
+    positions_.pop_back();
+}
+
+bool RandomTickSet::contains(ChunkPos pos) const {
+    std::lock_guard lock(mutex_);
+    return slots_.contains(pos);
+}
+
+size_t RandomTickSet::size() const {
+    std::lock_guard lock(mutex_);
+    return positions_.size();
+}
+
+}  // namespace finevox
@@ -1,10 +1,14 @@
 #include "finevox/core/region_file.hpp"
 #include "finevox/core/config.hpp"
 #include "finevox/core/serialization.hpp"
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstring>
+#include <string_view>
+#include <unordered_set>
 #include <lz4.h>
+#include <lz4hc.h>
 
 namespace finevox {
 
@@ -83,6 +87,145 @@ std::optional<TocEntry> TocEntry::fromBytes(const uint8_t* data, size_t len) {
     return entry;
 }
 
+// ============================================================================
+// Compression policy
+// ============================================================================
+
+std::string_view compressionCodecName(CompressionCodec codec) {
+    switch (codec) {
+        case CompressionCodec::None: return "none";
+        case CompressionCodec::LZ4: return "lz4";
+        case CompressionCodec::LZ4HC: return "lz4hc";
+    }
+    return "lz4";
+}
+
+std::optional<CompressionCodec> compressionCodecFromName(std::string_view name) {
+    if (name == "none") return CompressionCodec::None;
+    if (name == "lz4") return CompressionCodec::LZ4;
+    if (name == "lz4hc") return CompressionCodec::LZ4HC;
+    return std::nullopt;
+}
+
+CompressionPolicy CompressionPolicy::fromConfig() {
+    CompressionPolicy policy;  // Default to LZ4 if not initialized
+    const ConfigManager& config = ConfigManager::instance();
+    if (!config.isInitialized()) {
+        return policy;
+    }
+
+    if (!config.compressionEnabled()) {
+        policy.codec = CompressionCodec::None;
+        return policy;
+    }
+    policy.codec = compressionCodecFromName(config.compressionCodec()).value_or(CompressionCodec::LZ4);
+    policy.hcLevel = config.compressionHCLevel();
+    policy.useDictionary = config.compressionDictionaryEnabled();
+    return policy;
+}
+
+bool CompressionPolicy::matches(uint32_t flags) const {
+    if (chunkCodec(flags) != codec) {
+        return false;
+    }
+    // Dictionary use only matters for compressed data; a policy without a
+    // dictionary accepts either (no reason to rewrite a smaller chunk)
+    return !useDictionary || codec == CompressionCodec::None ||
+           (flags & ChunkFlags::LZ4_DICTIONARY);
+}
+
+// ============================================================================
+// Dictionary training
+// ============================================================================
+
+std::vector<uint8_t> trainCompressionDictionary(
+    const std::vector<std::vector<uint8_t>>& samples, size_t maxSize) {
+    // k-grams are the unit of "sharedness", segments the unit of selection.
+    // 8-byte k-grams are long enough to skip coincidental matches; 64-byte
+    // segments keep CBOR keys together with the values that follow them.
+    constexpr size_t KGRAM = 8;
+    constexpr size_t SEGMENT = 64;
+
+    auto kgramHash = [](const uint8_t* p) {
+        uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        v ^= v >> 33;
+        v *= 0xff51afd7ed558ccdULL;
+        v ^= v >> 33;
+        return v;
+    };
+
+    // Count how many distinct samples contain each k-gram
+    struct KgramStats {
+        uint32_t sampleCount = 0;
+        uint32_t lastSample = 0;  // 1-based, 0 = never seen
+    };
+    std::unordered_map<uint64_t, KgramStats> stats;
+    for (size_t i = 0; i < samples.size(); ++i) {
+        const auto& sample = samples[i];
+        if (sample.size() < KGRAM) continue;
+        for (size_t p = 0; p + KGRAM <= sample.size(); ++p) {
+            KgramStats& st = stats[kgramHash(sample.data() + p)];
+            if (st.lastSample != i + 1) {
+                st.lastSample = static_cast<uint32_t>(i + 1);
+                ++st.sampleCount;
+            }
+        }
+    }
+
+    // Score each segment by how many other samples share its k-grams
+    struct Candidate {
+        uint64_t score;
+        size_t sample;
+        size_t offset;
+        size_t length;
+    };
+    std::vector<Candidate> candidates;
+    for (size_t i = 0; i < samples.size(); ++i) {
+        const auto& sample = samples[i];
+        for (size_t off = 0; off + KGRAM <= sample.size(); off += SEGMENT) {
+            size_t len = std::min(SEGMENT, sample.size() - off);
+            uint64_t score = 0;
+            for (size_t p = off; p + KGRAM <= off + len; ++p) {
+                score += stats[kgramHash(sample.data() + p)].sampleCount - 1;
+            }
+            if (score > 0) {
+                candidates.push_back({score, i, off, len});
+            }
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        if (a.score != b.score) return a.score > b.score;
+        if (a.sample != b.sample) return a.sample < b.sample;
+        return a.offset < b.offset;
+    });
+
+    // Take the best segments, skipping exact duplicates
+    std::vector<const Candidate*> selected;
+    std::unordered_set<std::string_view> seen;
+    size_t total = 0;
+    for (const auto& c : candidates) {
+        if (total + c.length > maxSize) continue;
+        std::string_view bytes(reinterpret_cast<const char*>(samples[c.sample].data() + c.offset), c.length);
+        if (!seen.insert(bytes).second) continue;
+        selected.push_back(&c);
+        total += c.length;
+        if (total + KGRAM > maxSize) break;
+    }
+
+    // Most valuable segments go last (closest to the data being compressed)
+    std::vector<uint8_t> dictionary;
+    dictionary.reserve(total);
+    for (auto it = selected.rbegin(); it != selected.rend(); ++it) {
+        const auto& sample = samples[(*it)->sample];
+        dictionary.insert(dictionary.end(),
+                          sample.begin() + static_cast<std::ptrdiff_t>((*it)->offset),
+                          sample.begin() + static_cast<std::ptrdiff_t>((*it)->offset + (*it)->length));
+    }
+    return dictionary;
+}
+
 // ============================================================================
 // RegionFile implementation
 // ============================================================================
@@ -91,13 +234,47 @@ RegionFile::RegionFile(const std::filesystem::path& basePath, RegionPos pos)
     : pos_(pos)
     , basePath_(basePath)
 {
+    open(std::nullopt);
+}
+
+RegionFile::RegionFile(const std::filesystem::path& basePath, RegionPos pos, RegionIndex index)
+    : pos_(pos)
+    , basePath_(basePath)
+{
+    open(std::move(index));
+}
+
+void RegionFile::open(std::optional<RegionIndex> cached) {
     // Construct file paths
-    std::string filename = "r." + std::to_string(pos.rx) + "." + std::to_string(pos.rz);
+    std::string filename = "r." + std::to_string(pos_.rx) + "." + std::to_string(pos_.rz);
     datPath_ = basePath_ / (filename + ".dat");
     tocPath_ = basePath_ / (filename + ".toc");
+    dictPath_ = basePath_ / (filename + ".dict");
 
     openFiles();
-    loadToc();
+
+    std::error_code ec;
+    uint64_t tocSize = std::filesystem::file_size(tocPath_, ec);
+    if (cached && !ec && cached->datFileSize == dataFileEnd_ && cached->tocFileSize == tocSize) {
+        index_ = std::move(cached->entries);
+        freeSpans_ = std::move(cached->freeSpans);
+        indexReused_ = true;
+    } else {
+        loadToc();
+    }
+    loadDictionaries();
+}
+
+RegionIndex RegionFile::captureIndex() {
+    flush();
+
+    RegionIndex snapshot;
+    snapshot.entries = index_;
+    snapshot.freeSpans = freeSpans_;
+    snapshot.datFileSize = dataFileEnd_;
+    std::error_code ec;
+    snapshot.tocFileSize = std::filesystem::file_size(tocPath_, ec);
+    return snapshot;
 }
 
 RegionFile::~RegionFile() {
@@ -216,6 +393,183 @@ bool RegionFile::appendTocEntry(const TocEntry& entry) {
     return tocFile_.good();
 }
 
+bool RegionFile::loadDictionaries() {
+    std::ifstream in(dictPath_, std::ios::binary);
+    if (!in.is_open()) {
+        return true;  // No dictionaries yet
+    }
+
+    uint8_t header[8];
+    if (!in.read(reinterpret_cast<char*>(header), 8)) {
+        return false;
+    }
+    uint32_t magic = 0;
+    for (int i = 0; i < 4; ++i) {
+        magic |= static_cast<uint32_t>(header[i]) << (i * 8);
+    }
+    if (magic != DICT_MAGIC) {
+        return false;
+    }
+    dictValidSize_ = 8;
+
+    // Entries: id (4 bytes) + size (4 bytes) + dictionary bytes
+    uint8_t entryHeader[8];
+    while (in.read(reinterpret_cast<char*>(entryHeader), 8)) {
+        uint32_t id = 0;
+        uint32_t size = 0;
+        for (int i = 0; i < 4; ++i) {
+            id |= static_cast<uint32_t>(entryHeader[i]) << (i * 8);
+            size |= static_cast<uint32_t>(entryHeader[4 + i]) << (i * 8);
+        }
+        if (id == 0 || id > 0xFF || size > LZ4_DICTIONARY_MAX_SIZE) {
+            return false;  // Corrupt entry; keep what we have
+        }
+        lastDictionaryId_ = std::max(lastDictionaryId_, static_cast<uint8_t>(id));
+
+        std::vector<uint8_t> dict(size);
+        if (!in.read(reinterpret_cast<char*>(dict.data()), size)) {
+            return false;  // Truncated entry (interrupted append)
+        }
+        dictionaries_[static_cast<uint8_t>(id)] = std::move(dict);
+        activeDictionary_ = std::max(activeDictionary_, static_cast<uint8_t>(id));
+        dictValidSize_ += 8 + size;
+    }
+
+    // A partial entry header also ends the loop
+    return in.gcount() == 0;
+}
+
+std::optional<uint8_t> RegionFile::addDictionary(std::vector<uint8_t> dictionary) {
+    if (dictionary.empty() || lastDictionaryId_ == 0xFF) {
+        return std::nullopt;
+    }
+    if (dictionary.size() > LZ4_DICTIONARY_MAX_SIZE) {
+        // Only the tail is ever referenced by LZ4
+        dictionary.erase(dictionary.begin(),
+                         dictionary.end() - static_cast<std::ptrdiff_t>(LZ4_DICTIONARY_MAX_SIZE));
+    }
+
+    // Cut off whatever an interrupted append left behind, or the next load
+    // would parse the new entry as the rest of the broken one
+    std::error_code ec;
+    if (std::filesystem::exists(dictPath_, ec) &&
+        std::filesystem::file_size(dictPath_, ec) != dictValidSize_) {
+        std::filesystem::resize_file(dictPath_, dictValidSize_, ec);
+        if (ec) {
+            return std::nullopt;
+        }
+    }
+
+    bool needsHeader = dictValidSize_ == 0;
+    std::ofstream out(dictPath_, std::ios::binary | std::ios::app);
+    if (!out.is_open()) {
+        return std::nullopt;
+    }
+
+    if (needsHeader) {
+        uint8_t header[8];
+        for (int i = 0; i < 4; ++i) {
+            header[i] = static_cast<uint8_t>((DICT_MAGIC >> (i * 8)) & 0xFF);
+            header[4 + i] = static_cast<uint8_t>((DICT_VERSION >> (i * 8)) & 0xFF);
+        }
+        out.write(reinterpret_cast<const char*>(header), 8);
+    }
+
+    uint8_t id = static_cast<uint8_t>(lastDictionaryId_ + 1);
+    uint32_t size = static_cast<uint32_t>(dictionary.size());
+    uint8_t entryHeader[8];
+    for (int i = 0; i < 4; ++i) {
+        entryHeader[i] = static_cast<uint8_t>((static_cast<uint32_t>(id) >> (i * 8)) & 0xFF);
+        entryHeader[4 + i] = static_cast<uint8_t>((size >> (i * 8)) & 0xFF);
+    }
+    out.write(reinterpret_cast<const char*>(entryHeader), 8);
+    out.write(reinterpret_cast<const char*>(dictionary.data()), size);
+    out.flush();
+    if (!out.good()) {
+        return std::nullopt;
+    }
+
+    dictValidSize_ += (needsHeader ? 8 : 0) + 8 + size;
+    dictionaries_[id] = std::move(dictionary);
+    activeDictionary_ = id;
+    lastDictionaryId_ = id;
+    return id;
+}
+
+void RegionFile::collectTrainingSample(std::span<const uint8_t> cborData) {
+    trainingSamples_.emplace_back(cborData.begin(), cborData.end());
+    if (trainingSamples_.size() < DICTIONARY_TRAINING_SAMPLES) {
+        return;
+    }
+
+    auto dictionary = trainCompressionDictionary(trainingSamples_);
+    trainingSamples_.clear();
+    trainingSamples_.shrink_to_fit();
+    (void)addDictionary(std::move(dictionary));
+}
+
+std::vector<uint8_t> RegionFile::compressLz4(std::span<const uint8_t> src,
+                                             const std::vector<uint8_t>* dictionary,
+                                             int hcLevel) {
+    int maxCompressedSize = LZ4_compressBound(static_cast<int>(src.size()));
+    std::vector<uint8_t> compressed(maxCompressedSize + 4);  // +4 for uncompressed size
+
+    // Store original size first (4 bytes, little-endian)
+    uint32_t originalSize = static_cast<uint32_t>(src.size());
+    compressed[0] = static_cast<uint8_t>(originalSize & 0xFF);
+    compressed[1] = static_cast<uint8_t>((originalSize >> 8) & 0xFF);
+    compressed[2] = static_cast<uint8_t>((originalSize >> 16) & 0xFF);
+    compressed[3] = static_cast<uint8_t>((originalSize >> 24) & 0xFF);
+
+    int compressedSize = 0;
+    if (hcLevel > 0) {
+        // LZ4_streamHC_t is ~256KB, keep it off the stack
+        std::unique_ptr<LZ4_streamHC_t, int (*)(LZ4_streamHC_t*)> stream(
+            LZ4_createStreamHC(), &LZ4_freeStreamHC);
+        if (!stream) {
+            return {};
+        }
+        LZ4_resetStreamHC_fast(stream.get(), hcLevel);
+        if (dictionary) {
+            LZ4_loadDictHC(stream.get(), reinterpret_cast<const char*>(dictionary->data()),
+                           static_cast<int>(dictionary->size()));
+        }
+        compressedSize = LZ4_compress_HC_continue(
+            stream.get(),
+            reinterpret_cast<const char*>(src.data()),
+            reinterpret_cast<char*>(compressed.data() + 4),
+            static_cast<int>(src.size()),
+            maxCompressedSize
+        );
+    } else if (dictionary) {
+        LZ4_stream_t stream;
+        LZ4_initStream(&stream, sizeof(stream));
+        LZ4_loadDict(&stream, reinterpret_cast<const char*>(dictionary->data()),
+                     static_cast<int>(dictionary->size()));
+        compressedSize = LZ4_compress_fast_continue(
+            &stream,
+            reinterpret_cast<const char*>(src.data()),
+            reinterpret_cast<char*>(compressed.data() + 4),
+            static_cast<int>(src.size()),
+            maxCompressedSize,
+            1
+        );
+    } else {
+        compressedSize = LZ4_compress_default(
+            reinterpret_cast<const char*>(src.data()),
+            reinterpret_cast<char*>(compressed.data() + 4),
+            static_cast<int>(src.size()),
+            maxCompressedSize
+        );
+    }
+
+    if (compressedSize <= 0) {
+        return {};
+    }
+    compressed.resize(4 + static_cast<size_t>(compressedSize));
+    return compressed;
+}
+
 bool RegionFile::writeChunkData(uint64_t offset, const std::vector<uint8_t>& data, uint32_t flags) {
     if (!datFile_.is_open()) {
         return false;
@@ -353,6 +707,11 @@ bool RegionFile::saveColumn(const ChunkColumn& column, ColumnPos pos) {
 }
 
 bool RegionFile::saveColumnRaw(ColumnPos pos, std::span<const uint8_t> cborData) {
+    return saveColumnRaw(pos, cborData, CompressionPolicy::fromConfig());
+}
+
+bool RegionFile::saveColumnRaw(ColumnPos pos, std::span<const uint8_t> cborData,
+                               const CompressionPolicy& policy) {
     // Verify this column belongs to our region
     if (RegionPos::fromColumn(pos) != pos_) {
         return false;
@@ -360,40 +719,38 @@ bool RegionFile::saveColumnRaw(ColumnPos pos, std::span<const uint8_t> cborData)
 
     auto [lx, lz] = RegionPos::toLocal(pos);
 
-    // Determine whether to compress
-    bool shouldCompress = ConfigManager::instance().isInitialized()
-                        ? ConfigManager::instance().compressionEnabled()
-                        : true;  // Default to compression if not initialized
+    bool shouldCompress = policy.codec != CompressionCodec::None;
+    bool useDictionary = shouldCompress && policy.useDictionary;
+
+    if (useDictionary && activeDictionary_ == 0 && !cborData.empty()) {
+        collectTrainingSample(cborData);
+    }
 
     std::vector<uint8_t> dataToWrite;
     uint32_t flags = ChunkFlags::NONE;
 
     if (shouldCompress && !cborData.empty()) {
-        // LZ4 compress the data
-        int maxCompressedSize = LZ4_compressBound(static_cast<int>(cborData.size()));
-        std::vector<uint8_t> compressed(maxCompressedSize + 4);  // +4 for uncompressed size
-
-        // Store original size first (4 bytes, little-endian)
-        uint32_t originalSize = static_cast<uint32_t>(cborData.size());
-        compressed[0] = static_cast<uint8_t>(originalSize & 0xFF);
-        compressed[1] = static_cast<uint8_t>((originalSize >> 8) & 0xFF);
-        compressed[2] = static_cast<uint8_t>((originalSize >> 16) & 0xFF);
-        compressed[3] = static_cast<uint8_t>((originalSize >> 24) & 0xFF);
-
-        int compressedSize = LZ4_compress_default(
-            reinterpret_cast<const char*>(cborData.data()),
-            reinterpret_cast<char*>(compressed.data() + 4),
-            static_cast<int>(cborData.size()),
-            maxCompressedSize
-        );
+        const std::vector<uint8_t>* dictionary = nullptr;
+        if (useDictionary && activeDictionary_ != 0) {
+            dictionary = &dictionaries_.at(activeDictionary_);
+        }
 
-        if (compressedSize > 0) {
-            // Compression succeeded - use compressed data if smaller
-            size_t totalCompressed = 4 + static_cast<size_t>(compressedSize);
-            if (totalCompressed < cborData.size()) {
-                compressed.resize(totalCompressed);
-                dataToWrite = std::move(compressed);
-                flags = ChunkFlags::COMPRESSED_LZ4;
+        bool highCompression = policy.codec == CompressionCodec::LZ4HC;
+        auto compressed = compressLz4(cborData, dictionary,
+            highCompression ? std::clamp(policy.hcLevel, CompressionPolicy::HC_LEVEL_MIN,
+                                         CompressionPolicy::HC_LEVEL_MAX)
+                            : 0);
+
+        // Use compressed data only if it is smaller
+        if (!compressed.empty() && compressed.size() < cborData.size()) {
+            dataToWrite = std::move(compressed);
+            flags = ChunkFlags::COMPRESSED_LZ4;
+            if (highCompression) {
+                flags |= ChunkFlags::COMPRESSED_LZ4HC;
+            }
+            if (dictionary) {
+                flags = ChunkFlags::withDictionaryId(flags | ChunkFlags::LZ4_DICTIONARY,
+                                                     activeDictionary_);
             }
         }
     }
@@ -453,9 +810,20 @@ bool RegionFile::saveColumnRaw(ColumnPos pos, std::span<const uint8_t> cborData)
 }
 
 std::unique_ptr<ChunkColumn> RegionFile::loadColumn(ColumnPos pos) {
+    auto cborData = loadColumnRaw(pos);
+    if (cborData.empty()) {
+        return nullptr;
+    }
+
+    // Deserialize
+    int32_t x, z;
+    return ColumnSerializer::fromCBOR(cborData, &x, &z);
+}
+
+std::vector<uint8_t> RegionFile::loadColumnRaw(ColumnPos pos) {
     // Verify this column belongs to our region
     if (RegionPos::fromColumn(pos) != pos_) {
-        return nullptr;
+        return {};
     }
 
     auto [lx, lz] = RegionPos::toLocal(pos);
@@ -463,7 +831,7 @@ std::unique_ptr<ChunkColumn> RegionFile::loadColumn(ColumnPos pos) {
 
     auto it = index_.find(key);
     if (it == index_.end()) {
-        return nullptr;  // Column doesn't exist
+        return {};  // Column doesn't exist
     }
 
     const TocEntry& entry = it->second;
@@ -472,41 +840,112 @@ std::unique_ptr<ChunkColumn> RegionFile::loadColumn(ColumnPos pos) {
     uint32_t flags = 0;
     auto data = readChunkData(entry.offset, entry.size, &flags);
     if (data.empty()) {
-        return nullptr;
+        return {};
     }
 
-    // Decompress if necessary
-    std::vector<uint8_t> cborData;
-    if (flags & ChunkFlags::COMPRESSED_LZ4) {
-        // LZ4 compressed - first 4 bytes are original size
-        if (data.size() < 4) {
-            return nullptr;  // Invalid compressed data
-        }
+    auto cborData = decodeChunk(std::move(data), flags);
+    return cborData ? std::move(*cborData) : std::vector<uint8_t>{};
+}
 
-        uint32_t originalSize = static_cast<uint32_t>(data[0]) |
-                               (static_cast<uint32_t>(data[1]) << 8) |
-                               (static_cast<uint32_t>(data[2]) << 16) |
-                               (static_cast<uint32_t>(data[3]) << 24);
+std::optional<std::vector<uint8_t>> RegionFile::decodeChunk(std::vector<uint8_t> data,
+                                                            uint32_t flags) const {
+    if (!(flags & ChunkFlags::COMPRESSED_LZ4)) {
+        return data;  // Uncompressed
+    }
 
-        cborData.resize(originalSize);
-        int decompressedSize = LZ4_decompress_safe(
+    // LZ4 compressed (fast or HC, same format) - first 4 bytes are original size
+    if (data.size() < 4) {
+        return std::nullopt;  // Invalid compressed data
+    }
+
+    uint32_t originalSize = static_cast<uint32_t>(data[0]) |
+                           (static_cast<uint32_t>(data[1]) << 8) |
+                           (static_cast<uint32_t>(data[2]) << 16) |
+                           (static_cast<uint32_t>(data[3]) << 24);
+
+    std::vector<uint8_t> cborData(originalSize);
+    int decompressedSize = -1;
+    if (flags & ChunkFlags::LZ4_DICTIONARY) {
+        auto dictIt = dictionaries_.find(ChunkFlags::dictionaryId(flags));
+        if (dictIt == dictionaries_.end()) {
+            return std::nullopt;  // Dictionary missing
+        }
+        decompressedSize = LZ4_decompress_safe_usingDict(
+            reinterpret_cast<const char*>(data.data() + 4),
+            reinterpret_cast<char*>(cborData.data()),
+            static_cast<int>(data.size() - 4),
+            static_cast<int>(originalSize),
+            reinterpret_cast<const char*>(dictIt->second.data()),
+            static_cast<int>(dictIt->second.size())
+        );
+    } else {
+        decompressedSize = LZ4_decompress_safe(
             reinterpret_cast<const char*>(data.data() + 4),
             reinterpret_cast<char*>(cborData.data()),
             static_cast<int>(data.size() - 4),
             static_cast<int>(originalSize)
         );
+    }
+
+    if (decompressedSize < 0 || static_cast<uint32_t>(decompressedSize) != originalSize) {
+        return std::nullopt;  // Decompression failed
+    }
+    return cborData;
+}
+
+std::optional<uint32_t> RegionFile::columnFlags(ColumnPos pos) {
+    if (RegionPos::fromColumn(pos) != pos_) {
+        return std::nullopt;
+    }
+
+    auto [lx, lz] = RegionPos::toLocal(pos);
+    auto it = index_.find(localKey(lx, lz));
+    if (it == index_.end()) {
+        return std::nullopt;
+    }
 
-        if (decompressedSize < 0 || static_cast<uint32_t>(decompressedSize) != originalSize) {
-            return nullptr;  // Decompression failed
+    uint32_t flags = 0;
+    if (readChunkData(it->second.offset, it->second.size, &flags).empty()) {
+        return std::nullopt;
+    }
+    return flags;
+}
+
+size_t RegionFile::recompress(const CompressionPolicy& policy) {
+    size_t rewritten = 0;
+
+    // Snapshot positions first; saveColumnRaw updates index_
+    for (ColumnPos pos : getExistingColumns()) {
+        auto [lx, lz] = RegionPos::toLocal(pos);
+        auto it = index_.find(localKey(lx, lz));
+        if (it == index_.end()) {
+            continue;
+        }
+
+        uint32_t flags = 0;
+        auto data = readChunkData(it->second.offset, it->second.size, &flags);
+        if (data.empty()) {
+            continue;  // Unreadable; leave it alone rather than lose it
+        }
+
+        // Stored raw means compression didn't shrink it last time either
+        if (chunkCodec(flags) == CompressionCodec::None || policy.matches(flags)) {
+            continue;
+        }
+
+        auto cborData = decodeChunk(std::move(data), flags);
+        if (!cborData) {
+            continue;
+        }
+        if (saveColumnRaw(pos, *cborData, policy)) {
+            ++rewritten;
         }
-    } else {
-        // Uncompressed
-        cborData = std::move(data);
     }
 
-    // Deserialize
-    int32_t x, z;
-    return ColumnSerializer::fromCBOR(cborData, &x, &z);
+    if (rewritten > 0) {
+        compactToc();
+    }
+    return rewritten;
 }
 
 bool RegionFile::hasColumn(ColumnPos pos) const {
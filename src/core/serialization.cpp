@@ -350,6 +350,10 @@ std::vector<uint8_t> ColumnSerializer::toCBOR(const ChunkColumn& column, int32_t
     int fieldCount = 3;  // x, z, subchunks
     bool hasColumnData = column.hasData() && !column.data()->empty();
     if (hasColumnData) fieldCount++;
+    bool partiallyGenerated = !column.isGenerationComplete();
+    if (partiallyGenerated) fieldCount++;
+    bool hasStageRank = partiallyGenerated && column.generationStageRank() > 0;
+    if (hasStageRank) fieldCount++;
 
     cbor::encodeMapHeader(out, fieldCount);
 
@@ -377,6 +381,18 @@ std::vector<uint8_t> ColumnSerializer::toCBOR(const ChunkColumn& column, int32_t
         out.insert(out.end(), containerBytes.begin(), containerBytes.end());
     }
 
+    // "gen": generation stage (optional, absent = complete)
+    if (partiallyGenerated) {
+        cbor::encodeString(out, "gen");
+        cbor::encodeInt(out, column.generationStage());
+    }
+
+    // "genrank": passes applied at that stage (optional, absent = all)
+    if (hasStageRank) {
+        cbor::encodeString(out, "genrank");
+        cbor::encodeInt(out, column.generationStageRank());
+    }
+
     return out;
 }
 
@@ -395,6 +411,8 @@ std::unique_ptr<ChunkColumn> ColumnSerializer::fromCBOR(std::span<const uint8_t>
     }
 
     int32_t x = 0, z = 0;
+    int32_t generationStage = ChunkColumn::GENERATION_COMPLETE;
+    int32_t generationStageRank = 0;
     std::vector<std::pair<int32_t, std::unique_ptr<SubChunk>>> subchunks;
     std::unique_ptr<DataContainer> columnData;
 
@@ -411,6 +429,10 @@ std::unique_ptr<ChunkColumn> ColumnSerializer::fromCBOR(std::span<const uint8_t>
             x = static_cast<int32_t>(decoder.readInt());
         } else if (key == "z") {
             z = static_cast<int32_t>(decoder.readInt());
+        } else if (key == "gen") {
+            generationStage = static_cast<int32_t>(decoder.readInt());
+        } else if (key == "genrank") {
+            generationStageRank = static_cast<int32_t>(decoder.readInt());
         } else if (key == "data") {
             // Column-level extra data
             size_t startPos = decoder.position();
@@ -524,6 +546,7 @@ std::unique_ptr<ChunkColumn> ColumnSerializer::fromCBOR(std::span<const uint8_t>
     // Create the column and populate it
     ColumnPos colPos{x, z};
     auto column = std::make_unique<ChunkColumn>(colPos);
+    column->setGenerationStage(generationStage, generationStageRank);
 
     for (auto& [y, sc] : subchunks) {
         // We need to copy blocks from sc into the column
@@ -1,75 +1,161 @@
 #include "finevox/core/string_interner.hpp"
 
+#include <stdexcept>
+
 namespace finevox {
 
+namespace {
+thread_local int hotPathDepth = 0;
+}  // namespace
+
 StringInterner& StringInterner::global() {
     static StringInterner instance;
     return instance;
 }
 
 StringInterner::StringInterner() {
-    // Reserve IDs 0, 1, 2 for special block types
-    strings_.emplace_back("finevox:air");       // ID 0: Air (proper name for printing)
-    strings_.emplace_back("finevox:invalid");   // ID 1: Invalid
-    strings_.emplace_back("finevox:unknown");   // ID 2: Unknown
+    tables_.push_back(std::make_unique<HashTable>(1024));
+    table_.store(tables_.back().get(), std::memory_order_release);
+
+    // Reserve IDs 0, 1, 2 for special block types. The empty string also
+    // maps to AIR_INTERNED_ID (handled in intern() and find()).
+    std::lock_guard lock(writeMutex_);
+    for (std::string_view name : {"finevox:air", "finevox:invalid", "finevox:unknown"}) {
+        append(name, static_cast<uint32_t>(std::hash<std::string_view>{}(name)));
+    }
+}
 
-    // Add to lookup for reverse mapping
-    // Both empty string and "finevox:air" map to AIR_INTERNED_ID
-    lookup_[""] = AIR_INTERNED_ID;
-    lookup_["finevox:air"] = AIR_INTERNED_ID;
-    lookup_["finevox:invalid"] = INVALID_INTERNED_ID;
-    lookup_["finevox:unknown"] = UNKNOWN_INTERNED_ID;
+StringInterner::HashTable::HashTable(size_t capacity)
+    : mask(capacity - 1)
+    , slots(std::make_unique<std::atomic<uint64_t>[]>(capacity))
+{
 }
 
 InternedId StringInterner::intern(std::string_view str) {
-    std::string key(str);  // Convert to string for map operations
-
-    // Fast path: check if already interned (read lock)
-    {
-        std::shared_lock readLock(mutex_);
-        auto it = lookup_.find(key);
-        if (it != lookup_.end()) {
-            return it->second;
-        }
+    noteLookup();
+    if (str.empty()) {
+        return AIR_INTERNED_ID;
     }
 
-    // Slow path: need to intern (write lock)
-    std::unique_lock writeLock(mutex_);
-
-    // Double-check after acquiring write lock
-    auto it = lookup_.find(key);
-    if (it != lookup_.end()) {
-        return it->second;
+    // Fast path: already interned (no lock)
+    auto hash = static_cast<uint32_t>(std::hash<std::string_view>{}(str));
+    if (auto id = probe(str, hash)) {
+        return *id;
     }
 
-    // Add new string
-    InternedId id = static_cast<InternedId>(strings_.size());
-    strings_.emplace_back(str);
-    lookup_[std::move(key)] = id;
-
-    return id;
+    // Slow path: double-check under the writer lock, then append
+    std::lock_guard lock(writeMutex_);
+    if (auto id = probe(str, hash)) {
+        return *id;
+    }
+    return append(str, hash);
 }
 
 std::string_view StringInterner::lookup(InternedId id) const {
-    std::shared_lock lock(mutex_);
-    if (id >= strings_.size()) {
+    if (id >= size_.load(std::memory_order_acquire)) {
         return {};
     }
-    return strings_[id];
+    return stringAt(id);
 }
 
 std::optional<InternedId> StringInterner::find(std::string_view str) const {
-    std::shared_lock lock(mutex_);
-    auto it = lookup_.find(std::string(str));
-    if (it != lookup_.end()) {
-        return it->second;
+    noteLookup();
+    if (str.empty()) {
+        return AIR_INTERNED_ID;
     }
-    return std::nullopt;
+    return probe(str, static_cast<uint32_t>(std::hash<std::string_view>{}(str)));
 }
 
 size_t StringInterner::size() const {
-    std::shared_lock lock(mutex_);
-    return strings_.size();
+    return size_.load(std::memory_order_acquire);
+}
+
+std::string_view StringInterner::stringAt(InternedId id) const {
+    const Chunk* chunk = chunks_[id >> CHUNK_BITS].load(std::memory_order_acquire);
+    return chunk->strings[id & (CHUNK_SIZE - 1)];
+}
+
+std::optional<InternedId> StringInterner::probe(std::string_view str, uint32_t hash) const {
+    const HashTable* table = table_.load(std::memory_order_acquire);
+    for (size_t i = hash & table->mask;; i = (i + 1) & table->mask) {
+        uint64_t entry = table->slots[i].load(std::memory_order_acquire);
+        if (entry == 0) {
+            // Not in this table. A concurrent append may have published a
+            // newer one; intern() re-probes under the lock to catch that.
+            return std::nullopt;
+        }
+        if (static_cast<uint32_t>(entry >> 32) == hash) {
+            auto id = static_cast<InternedId>(entry) - 1;
+            if (stringAt(id) == str) {
+                return id;
+            }
+        }
+    }
+}
+
+InternedId StringInterner::append(std::string_view str, uint32_t hash) {
+    uint32_t id = size_.load(std::memory_order_relaxed);
+    if (id >= CHUNK_COUNT * CHUNK_SIZE) {
+        throw std::length_error("StringInterner capacity exceeded");
+    }
+
+    auto& slot = chunks_[id >> CHUNK_BITS];
+    Chunk* chunk = slot.load(std::memory_order_relaxed);
+    if (!chunk) {
+        ownedChunks_.push_back(std::make_unique<Chunk>());
+        chunk = ownedChunks_.back().get();
+        slot.store(chunk, std::memory_order_release);
+    }
+    chunk->strings[id & (CHUNK_SIZE - 1)] = std::string(str);
+
+    // String before count and hash entry: readers that see either see the string
+    size_.store(id + 1, std::memory_order_release);
+    insertEntry((uint64_t{hash} << 32) | (uint64_t{id} + 1));
+    return id;
+}
+
+void StringInterner::insertEntry(uint64_t entry) {
+    HashTable* table = table_.load(std::memory_order_relaxed);
+
+    // Keep the load factor at or below 1/2 so probes stay short
+    if ((tableEntries_ + 1) * 2 > table->mask + 1) {
+        auto grown = std::make_unique<HashTable>((table->mask + 1) * 2);
+        for (size_t i = 0; i <= table->mask; ++i) {
+            uint64_t old = table->slots[i].load(std::memory_order_relaxed);
+            if (old == 0) {
+                continue;
+            }
+            size_t j = static_cast<uint32_t>(old >> 32) & grown->mask;
+            while (grown->slots[j].load(std::memory_order_relaxed) != 0) {
+                j = (j + 1) & grown->mask;
+            }
+            grown->slots[j].store(old, std::memory_order_relaxed);
+        }
+        table = grown.get();
+        tables_.push_back(std::move(grown));
+        table_.store(table, std::memory_order_release);
+    }
+
+    size_t i = static_cast<uint32_t>(entry >> 32) & table->mask;
+    while (table->slots[i].load(std::memory_order_relaxed) != 0) {
+        i = (i + 1) & table->mask;
+    }
+    table->slots[i].store(entry, std::memory_order_release);
+    ++tableEntries_;
+}
+
+void StringInterner::noteLookup() const {
+    if (hotPathDepth > 0) {
+        hotPathLookups_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+StringInterner::HotPathScope::HotPathScope() {
+    ++hotPathDepth;
+}
+
+StringInterner::HotPathScope::~HotPathScope() {
+    --hotPathDepth;
 }
 
 // BlockTypeId implementation
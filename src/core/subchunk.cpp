@@ -1,6 +1,7 @@
 #include "finevox/core/subchunk.hpp"
 #include "finevox/core/data_container.hpp"
 #include "finevox/core/block_type.hpp"
+#include "finevox/core/random_tick_set.hpp"
 
 namespace finevox {
 
@@ -96,6 +97,7 @@ void SubChunk::decrementUsage(LocalIndex index) {
         --usageCounts_[index];
         // If usage drops to zero and it's not air, remove from palette
         if (usageCounts_[index] == 0 && index != 0) {
+            onPaletteEntryUnused(index);
             BlockTypeId type = palette_.getGlobalId(index);
             if (!type.isAir()) {
                 palette_.removeType(type);
@@ -108,7 +110,9 @@ void SubChunk::incrementUsage(LocalIndex index) {
     if (index >= usageCounts_.size()) {
         usageCounts_.resize(index + 1, 0);
     }
-    ++usageCounts_[index];
+    if (++usageCounts_[index] == 1 && index != 0) {
+        onPaletteEntryUsed(index);
+    }
 }
 
 void SubChunk::clear() {
@@ -121,6 +125,7 @@ void SubChunk::clear() {
     usageCounts_.push_back(VOLUME);  // Air has all blocks
     nonAirCount_ = 0;
     rotations_.fill(0);  // Reset all rotations to identity
+    rebuildRandomTickTypes();
 
     // Increment block version if there was any content or rotations
     if (wasNotEmpty || hadRotations) {
@@ -158,11 +163,78 @@ void SubChunk::fill(BlockTypeId type) {
 
     nonAirCount_ = VOLUME;
     rotations_.fill(0);  // Reset all rotations to identity
+    rebuildRandomTickTypes();
 
     // Increment block version
     blockVersion_.fetch_add(1, std::memory_order_release);
 }
 
+void SubChunk::bulkSetRun(int32_t x, int32_t z, int32_t y0, int32_t y1, LocalIndex localIndex) {
+    for (int32_t y = y0; y < y1; ++y) {
+        blocks_[toIndex(x, y, z)] = localIndex;
+    }
+}
+
+void SubChunk::bulkSetLayers(int32_t y0, int32_t y1, LocalIndex localIndex) {
+    std::fill(blocks_.begin() + toIndex(0, y0, 0), blocks_.begin() + toIndex(0, y1, 0), localIndex);
+}
+
+void SubChunk::endBulkWrite() {
+    usageCounts_.assign(palette_.entries().size(), 0);
+    for (LocalIndex blockIndex : blocks_) {
+        ++usageCounts_[blockIndex];
+    }
+
+    nonAirCount_ = 0;
+    for (size_t i = 0; i < usageCounts_.size(); ++i) {
+        BlockTypeId type = palette_.getGlobalId(static_cast<LocalIndex>(i));
+        if (type.isAir()) {
+            continue;
+        }
+        if (usageCounts_[i] == 0) {
+            // Overwritten during the bulk write, same as decrementUsage()
+            palette_.removeType(type);
+        } else {
+            nonAirCount_ += static_cast<int32_t>(usageCounts_[i]);
+        }
+    }
+    rebuildRandomTickTypes();
+
+    blockVersion_.fetch_add(1, std::memory_order_release);
+}
+
+void SubChunk::bulkSetCounted(int32_t index, LocalIndex localIndex) {
+    LocalIndex oldIndex = blocks_[index];
+    if (oldIndex == localIndex) {
+        return;
+    }
+    if (localIndex >= usageCounts_.size()) {
+        usageCounts_.resize(localIndex + 1, 0);
+    }
+    --usageCounts_[oldIndex];
+    ++usageCounts_[localIndex];
+    // Air is always index 0
+    if (oldIndex == 0) {
+        ++nonAirCount_;
+    } else if (localIndex == 0) {
+        --nonAirCount_;
+    }
+    blocks_[index] = localIndex;
+}
+
+void SubChunk::endSparseWrite() {
+    for (size_t i = 1; i < usageCounts_.size(); ++i) {
+        if (usageCounts_[i] == 0) {
+            BlockTypeId type = palette_.getGlobalId(static_cast<LocalIndex>(i));
+            if (!type.isAir()) {
+                palette_.removeType(type);
+            }
+        }
+    }
+    rebuildRandomTickTypes();
+    blockVersion_.fetch_add(1, std::memory_order_release);
+}
+
 std::vector<SubChunk::LocalIndex> SubChunk::compactPalette() {
     auto mapping = palette_.compact(usageCounts_);
 
@@ -183,6 +255,7 @@ std::vector<SubChunk::LocalIndex> SubChunk::compactPalette() {
     for (auto blockIndex : blocks_) {
         ++usageCounts_[blockIndex];
     }
+    rebuildRandomTickTypes();
 
     return mapping;
 }
@@ -563,11 +636,76 @@ void SubChunk::rebuildGameTickRegistry() {
         BlockTypeId typeId = getBlock(i);
         if (typeId.isAir()) continue;
 
-        const BlockType& type = registry.getType(typeId);
-        if (type.wantsGameTicks()) {
+        if (registry.wantsGameTicks(typeId)) {
             gameTickBlocks_.insert(static_cast<uint16_t>(i));
         }
     }
 }
 
+// ============================================================================
+// Random Tick Tracking Implementation
+// ============================================================================
+
+void SubChunk::onPaletteEntryUsed(LocalIndex index) {
+    BlockTypeId type = palette_.getGlobalId(index);
+    if (type.isAir() || !BlockRegistry::global().wantsRandomTicks(type)) {
+        return;
+    }
+    if (index >= randomTickFlags_.size()) {
+        randomTickFlags_.resize(index + 1, 0);
+    }
+    if (randomTickFlags_[index] == 0) {
+        randomTickFlags_[index] = 1;
+        setRandomTickTypes(randomTickTypes_ + 1);
+    }
+}
+
+void SubChunk::onPaletteEntryUnused(LocalIndex index) {
+    if (index < randomTickFlags_.size() && randomTickFlags_[index] != 0) {
+        randomTickFlags_[index] = 0;
+        setRandomTickTypes(randomTickTypes_ - 1);
+    }
+}
+
+void SubChunk::rebuildRandomTickTypes() {
+    const BlockRegistry& registry = BlockRegistry::global();
+    const auto& entries = palette_.entries();
+
+    randomTickFlags_.assign(entries.size(), 0);
+    uint32_t count = 0;
+    for (size_t i = 1; i < entries.size(); ++i) {
+        if (i < usageCounts_.size() && usageCounts_[i] > 0 && !entries[i].isAir() &&
+            registry.wantsRandomTicks(entries[i])) {
+            randomTickFlags_[i] = 1;
+            ++count;
+        }
+    }
+    setRandomTickTypes(count);
+}
+
+void SubChunk::setRandomTickTypes(uint32_t count) {
+    bool had = randomTickTypes_ > 0;
+    randomTickTypes_ = count;
+    if (randomTickSet_ && had != (count > 0)) {
+        if (had) {
+            randomTickSet_->remove(position_);
+        } else {
+            randomTickSet_->add(position_);
+        }
+    }
+}
+
+void SubChunk::setRandomTickSet(RandomTickSet* set) {
+    if (set == randomTickSet_) {
+        return;
+    }
+    if (randomTickSet_ && hasRandomTickBlocks()) {
+        randomTickSet_->remove(position_);
+    }
+    randomTickSet_ = set;
+    if (randomTickSet_ && hasRandomTickBlocks()) {
+        randomTickSet_->add(position_);
+    }
+}
+
 }  // namespace finevox
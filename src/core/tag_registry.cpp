@@ -41,7 +41,6 @@ bool TagRegistry::rebuild() {
     std::unique_lock lock(mutex_);
 
     resolvedTags_.clear();
-    memberToTags_.clear();
 
     std::unordered_set<TagId> visiting;
     std::unordered_set<TagId> resolved;
@@ -55,15 +54,60 @@ bool TagRegistry::rebuild() {
         }
     }
 
-    // Build reverse index: member → set of tags
+    compile();
+
+    resolved_ = true;
+    return noCycles;
+}
+
+void TagRegistry::compile() {
+    tagSlots_.clear();
+    tagBits_.clear();
+    memberTagOffsets_.clear();
+    memberTags_.clear();
+
+    // Tags in id order, so each member's tag list comes out sorted
+    std::vector<TagId> tags;
+    tags.reserve(resolvedTags_.size());
+    InternedId maxMember = 0;
     for (auto& [tag, data] : resolvedTags_) {
+        tags.push_back(tag);
         for (auto member : data.members) {
-            memberToTags_[member].insert(tag);
+            maxMember = std::max(maxMember, member);
+        }
+    }
+    if (tags.empty()) {
+        return;
+    }
+    std::sort(tags.begin(), tags.end());
+
+    // Member bitsets, each sized to its own largest member
+    tagSlots_.assign(tags.back().id + 1, NO_TAG_SLOT);
+    std::vector<uint32_t> counts(maxMember + 1, 0);
+    for (TagId tag : tags) {
+        tagSlots_[tag.id] = static_cast<uint32_t>(tagBits_.size());
+        auto& bits = tagBits_.emplace_back();
+        for (auto member : resolvedTags_[tag].members) {
+            if ((member >> 6) >= bits.size()) {
+                bits.resize((member >> 6) + 1, 0);
+            }
+            bits[member >> 6] |= uint64_t{1} << (member & 63);
+            ++counts[member];
         }
     }
 
-    resolved_ = true;
-    return noCycles;
+    // Reverse index: prefix sums of per-member tag counts, then fill
+    memberTagOffsets_.assign(maxMember + 2, 0);
+    for (InternedId member = 0; member <= maxMember; ++member) {
+        memberTagOffsets_[member + 1] = memberTagOffsets_[member] + counts[member];
+    }
+    memberTags_.resize(memberTagOffsets_.back());
+    std::vector<uint32_t> next(memberTagOffsets_.begin(), memberTagOffsets_.end() - 1);
+    for (TagId tag : tags) {
+        for (auto member : resolvedTags_[tag].members) {
+            memberTags_[next[member]++] = tag;
+        }
+    }
 }
 
 bool TagRegistry::resolveTag(TagId tag,
@@ -124,16 +168,17 @@ bool TagRegistry::isResolved() const {
 
 bool TagRegistry::hasTag(InternedId member, TagId tag) const {
     std::shared_lock lock(mutex_);
-    auto it = memberToTags_.find(member);
-    if (it == memberToTags_.end()) return false;
-    return it->second.contains(tag);
+    if (tag.id >= tagSlots_.size() || tagSlots_[tag.id] == NO_TAG_SLOT) return false;
+    const auto& bits = tagBits_[tagSlots_[tag.id]];
+    if ((member >> 6) >= bits.size()) return false;
+    return (bits[member >> 6] >> (member & 63)) & 1;
 }
 
 std::vector<TagId> TagRegistry::getTagsFor(InternedId member) const {
     std::shared_lock lock(mutex_);
-    auto it = memberToTags_.find(member);
-    if (it == memberToTags_.end()) return {};
-    return {it->second.begin(), it->second.end()};
+    if (memberTagOffsets_.empty() || member >= memberTagOffsets_.size() - 1) return {};
+    return {memberTags_.begin() + memberTagOffsets_[member],
+            memberTags_.begin() + memberTagOffsets_[member + 1]};
 }
 
 std::vector<InternedId> TagRegistry::getMembersOf(TagId tag) const {
@@ -166,8 +211,8 @@ void TagRegistry::clear() {
     std::unique_lock lock(mutex_);
     rawTags_.clear();
     resolvedTags_.clear();
-    memberToTags_.clear();
     resolved_ = false;
+    compile();
 }
 
 // ============================================================================
@@ -0,0 +1,229 @@
+/**
+ * @file tick_profiler.cpp
+ * @brief Per-phase timing of the game thread's tick loop
+ *
+ * Design: [14-threading.md] §14.7 Game Thread Tick Profiling
+ */
+
+#include "finevox/core/tick_profiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <ostream>
+
+namespace finevox {
+
+const char* tickPhaseName(TickPhase phase) {
+    switch (phase) {
+        case TickPhase::Commands:        return "commands";
+        case TickPhase::DeferredEvents:  return "deferred_events";
+        case TickPhase::GameTicks:       return "game_ticks";
+        case TickPhase::RandomTicks:     return "random_ticks";
+        case TickPhase::ScheduledTicks:  return "scheduled_ticks";
+        case TickPhase::EventProcessing: return "event_processing";
+        case TickPhase::EntityPhysics:   return "entity_physics";
+        case TickPhase::SnapshotPublish: return "snapshot_publish";
+        default:                         return "unknown";
+    }
+}
+
+// ============================================================================
+// Window
+// ============================================================================
+
+void TickProfiler::Window::add(uint64_t ns, size_t capacity) {
+    if (samples.size() < capacity) {
+        samples.push_back(ns);
+    } else {
+        samples[next] = ns;
+    }
+    next = (next + 1) % capacity;
+    ++count;
+}
+
+TickPhaseStats TickProfiler::Window::summarize() {
+    TickPhaseStats stats;
+    stats.samples = count;
+    if (samples.empty()) {
+        return stats;
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    // Nearest-rank percentile
+    auto percentile = [&](double p) {
+        auto rank = static_cast<size_t>(std::ceil(p * static_cast<double>(samples.size())));
+        return static_cast<double>(samples[std::max<size_t>(rank, 1) - 1]) / 1e6;
+    };
+
+    uint64_t total = 0;
+    for (uint64_t ns : samples) {
+        total += ns;
+    }
+    stats.meanMs = static_cast<double>(total) / static_cast<double>(samples.size()) / 1e6;
+    stats.p50Ms = percentile(0.50);
+    stats.p95Ms = percentile(0.95);
+    stats.p99Ms = percentile(0.99);
+    stats.maxMs = static_cast<double>(samples.back()) / 1e6;
+    return stats;
+}
+
+// ============================================================================
+// TickProfiler
+// ============================================================================
+
+TickProfiler::TickProfiler(size_t window)
+    : window_(std::max<size_t>(window, 1))
+    , epoch_(Clock::now())
+{
+}
+
+void TickProfiler::record(TickPhase phase, Clock::time_point start, Clock::time_point end) {
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    std::lock_guard lock(mutex_);
+    phases_[static_cast<size_t>(phase)].add(static_cast<uint64_t>(std::max<int64_t>(ns, 0)), window_);
+    addTraceEvent(static_cast<uint8_t>(phase), start, end, 0);
+}
+
+void TickProfiler::beginTick() {
+    std::lock_guard lock(mutex_);
+    tickStart_ = Clock::now();
+    inTick_ = true;
+}
+
+void TickProfiler::endTick() {
+    auto end = Clock::now();
+
+    std::lock_guard lock(mutex_);
+    if (!inTick_) {
+        return;
+    }
+    inTick_ = false;
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - tickStart_).count();
+    tick_.add(static_cast<uint64_t>(ns), window_);
+    addTraceEvent(TRACE_TICK, tickStart_, end, 0);
+    ++ticks_;
+}
+
+void TickProfiler::addSkippedTicks(uint64_t count) {
+    if (count == 0) {
+        return;
+    }
+    auto now = Clock::now();
+
+    std::lock_guard lock(mutex_);
+    skippedTicks_ += count;
+    addTraceEvent(TRACE_SKIPPED, now, now, count);
+}
+
+TickProfileSnapshot TickProfiler::snapshot() const {
+    // Only the copy holds the lock; the sorting runs without blocking record()
+    std::array<Window, TICK_PHASE_COUNT> phases;
+    Window tick;
+    TickProfileSnapshot snapshot;
+    {
+        std::lock_guard lock(mutex_);
+        phases = phases_;
+        tick = tick_;
+        snapshot.ticks = ticks_;
+        snapshot.skippedTicks = skippedTicks_;
+    }
+
+    for (size_t i = 0; i < TICK_PHASE_COUNT; ++i) {
+        snapshot.phases[i] = phases[i].summarize();
+    }
+    snapshot.tick = tick.summarize();
+    return snapshot;
+}
+
+void TickProfiler::reset() {
+    std::lock_guard lock(mutex_);
+    phases_ = {};
+    tick_ = Window{};
+    inTick_ = false;
+    ticks_ = 0;
+    skippedTicks_ = 0;
+    trace_.clear();
+    traceNext_ = 0;
+}
+
+// ============================================================================
+// Chrome trace
+// ============================================================================
+
+void TickProfiler::setTraceCapacity(size_t events) {
+    std::lock_guard lock(mutex_);
+    traceCapacity_ = events;
+    trace_.clear();
+    trace_.reserve(events);
+    traceNext_ = 0;
+}
+
+size_t TickProfiler::traceCapacity() const {
+    std::lock_guard lock(mutex_);
+    return traceCapacity_;
+}
+
+size_t TickProfiler::traceEventCount() const {
+    std::lock_guard lock(mutex_);
+    return trace_.size();
+}
+
+void TickProfiler::addTraceEvent(uint8_t kind, Clock::time_point start, Clock::time_point end,
+                                 uint64_t value) {
+    if (traceCapacity_ == 0) {
+        return;
+    }
+
+    using std::chrono::microseconds;
+    TraceEvent event{
+        std::chrono::duration_cast<microseconds>(start - epoch_).count(),
+        std::chrono::duration_cast<microseconds>(end - start).count(),
+        ticks_ + (inTick_ || kind == TRACE_TICK ? 1 : 0),
+        value,
+        kind};
+
+    if (trace_.size() < traceCapacity_) {
+        trace_.push_back(event);
+    } else {
+        trace_[traceNext_] = event;
+    }
+    traceNext_ = (traceNext_ + 1) % traceCapacity_;
+}
+
+void TickProfiler::writeChromeTrace(std::ostream& out) const {
+    std::lock_guard lock(mutex_);
+
+    // Oldest first: once the ring has wrapped, it starts at traceNext_
+    size_t start = trace_.size() == traceCapacity_ ? traceNext_ : 0;
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (size_t i = 0; i < trace_.size(); ++i) {
+        const TraceEvent& event = trace_[(start + i) % trace_.size()];
+        out << (i == 0 ? "\n" : ",\n");
+        if (event.kind == TRACE_SKIPPED) {
+            out << "{\"name\":\"skipped_ticks\",\"cat\":\"tick\",\"ph\":\"i\",\"s\":\"t\""
+                << ",\"ts\":" << event.startUs << ",\"pid\":1,\"tid\":1"
+                << ",\"args\":{\"count\":" << event.value << "}}";
+            continue;
+        }
+        const char* name = event.kind == TRACE_TICK ? "tick" : tickPhaseName(static_cast<TickPhase>(event.kind));
+        out << "{\"name\":\"" << name << "\",\"cat\":\"tick\",\"ph\":\"X\""
+            << ",\"ts\":" << event.startUs << ",\"dur\":" << event.durUs
+            << ",\"pid\":1,\"tid\":1,\"args\":{\"tick\":" << event.tick << "}}";
+    }
+    out << "\n]}\n";
+}
+
+bool TickProfiler::writeChromeTrace(const std::string& path) const {
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+    writeChromeTrace(out);
+    return static_cast<bool>(out);
+}
+
+}  // namespace finevox
@@ -0,0 +1,201 @@
+/**
+ * @file tick_wheel.cpp
+ * @brief Hierarchical timing wheel for scheduled block ticks
+ *
+ * Design: [24-event-system.md] §24.14 Scheduled Ticks
+ */
+
+#include "finevox/core/tick_wheel.hpp"
+
+#include <algorithm>
+
+namespace finevox {
+
+void TickWheel::schedule(BlockPos pos, uint64_t targetTick, TickType type) {
+    targetTick = std::max(targetTick, now_ + 1);
+
+    uint32_t node;
+    if (freeHead_ != NIL) {
+        node = freeHead_;
+        freeHead_ = nodes_[node].next;
+    } else {
+        node = static_cast<uint32_t>(nodes_.size());
+        nodes_.emplace_back();
+    }
+
+    Node& n = nodes_[node];
+    n.tick = ScheduledTick{pos, targetTick, type};
+    n.sequence = nextSequence_++;
+    n.posPrev = NIL;
+
+    // Push onto the front of the position's chain
+    auto [it, inserted] = byPos_.try_emplace(pos, node);
+    if (inserted) {
+        n.posNext = NIL;
+    } else {
+        n.posNext = it->second;
+        nodes_[it->second].posPrev = node;
+        it->second = node;
+    }
+
+    link(listFor(targetTick), node);
+    ++count_;
+}
+
+size_t TickWheel::cancel(BlockPos pos) {
+    auto it = byPos_.find(pos);
+    if (it == byPos_.end()) {
+        return 0;
+    }
+
+    size_t removed = 0;
+    for (uint32_t node = it->second; node != NIL;) {
+        uint32_t next = nodes_[node].posNext;
+        unlink(node);
+        nodes_[node].next = freeHead_;
+        freeHead_ = node;
+        node = next;
+        ++removed;
+    }
+    byPos_.erase(it);
+    count_ -= removed;
+    return removed;
+}
+
+void TickWheel::advanceTo(uint64_t tick, std::vector<ScheduledTick>& due) {
+    while (now_ < tick) {
+        if (count_ == 0) {
+            // Nothing to refile or fire: jump, keeping the wheel aligned
+            now_ = tick;
+            return;
+        }
+        step(due);
+    }
+}
+
+void TickWheel::clear() {
+    nodes_.clear();
+    freeHead_ = NIL;
+    lists_.fill(List{});
+    byPos_.clear();
+    count_ = 0;
+}
+
+// ============================================================================
+// Slots
+// ============================================================================
+
+uint32_t TickWheel::listFor(uint64_t targetTick) const {
+    uint64_t delta = targetTick - now_;
+    if (delta < LEVEL0_SLOTS) {
+        return static_cast<uint32_t>(targetTick & (LEVEL0_SLOTS - 1));
+    }
+    for (int level = 0; level < UPPER_LEVELS; ++level) {
+        int shift = LEVEL0_BITS + LEVEL_BITS * level;
+        if (delta < (uint64_t{1} << (shift + LEVEL_BITS))) {
+            auto slot = static_cast<uint32_t>((targetTick >> shift) & (LEVEL_SLOTS - 1));
+            return LEVEL0_SLOTS + static_cast<uint32_t>(level) * LEVEL_SLOTS + slot;
+        }
+    }
+    return OVERFLOW_LIST;
+}
+
+void TickWheel::link(uint32_t list, uint32_t node) {
+    Node& n = nodes_[node];
+    List& l = lists_[list];
+    n.list = list;
+    n.next = NIL;
+    n.prev = l.tail;
+    if (l.tail != NIL) {
+        nodes_[l.tail].next = node;
+    } else {
+        l.head = node;
+    }
+    l.tail = node;
+}
+
+void TickWheel::unlink(uint32_t node) {
+    Node& n = nodes_[node];
+    List& l = lists_[n.list];
+    if (n.prev != NIL) {
+        nodes_[n.prev].next = n.next;
+    } else {
+        l.head = n.next;
+    }
+    if (n.next != NIL) {
+        nodes_[n.next].prev = n.prev;
+    } else {
+        l.tail = n.prev;
+    }
+}
+
+void TickWheel::release(uint32_t node) {
+    Node& n = nodes_[node];
+    if (n.posPrev != NIL) {
+        nodes_[n.posPrev].posNext = n.posNext;
+    } else if (n.posNext != NIL) {
+        byPos_[n.tick.pos] = n.posNext;
+    } else {
+        byPos_.erase(n.tick.pos);
+    }
+    if (n.posNext != NIL) {
+        nodes_[n.posNext].posPrev = n.posPrev;
+    }
+
+    n.next = freeHead_;
+    freeHead_ = node;
+    --count_;
+}
+
+void TickWheel::drain(uint32_t list) {
+    scratch_.clear();
+    for (uint32_t node = lists_[list].head; node != NIL; node = nodes_[node].next) {
+        scratch_.push_back(node);
+    }
+    lists_[list] = List{};
+}
+
+void TickWheel::cascade(uint32_t list) {
+    drain(list);
+    for (uint32_t node : scratch_) {
+        link(listFor(nodes_[node].tick.targetTick), node);
+    }
+}
+
+void TickWheel::step(std::vector<ScheduledTick>& due) {
+    ++now_;
+
+    // At the start of a wider slot, refile it (and the levels above when
+    // they wrap too) so its ticks move closer to the one-tick level
+    uint64_t position = now_;
+    if ((position & (LEVEL0_SLOTS - 1)) == 0) {
+        position >>= LEVEL0_BITS;
+        int level = 0;
+        for (; level < UPPER_LEVELS; ++level) {
+            auto slot = static_cast<uint32_t>(position & (LEVEL_SLOTS - 1));
+            cascade(LEVEL0_SLOTS + static_cast<uint32_t>(level) * LEVEL_SLOTS + slot);
+            if (slot != 0) {
+                break;
+            }
+            position >>= LEVEL_BITS;
+        }
+        if (level == UPPER_LEVELS) {
+            cascade(OVERFLOW_LIST);
+        }
+    }
+
+    // Refiling may have appended older ticks after newer ones
+    drain(static_cast<uint32_t>(now_ & (LEVEL0_SLOTS - 1)));
+    auto bySequence = [this](uint32_t a, uint32_t b) {
+        return nodes_[a].sequence < nodes_[b].sequence;
+    };
+    if (!std::is_sorted(scratch_.begin(), scratch_.end(), bySequence)) {
+        std::sort(scratch_.begin(), scratch_.end(), bySequence);
+    }
+    for (uint32_t node : scratch_) {
+        due.push_back(nodes_[node].tick);
+        release(node);
+    }
+}
+
+}  // namespace finevox
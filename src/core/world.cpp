@@ -45,6 +45,7 @@ void World::setBlock(int32_t x, int32_t y, int32_t z, BlockTypeId type) {
     if (it == columns_.end()) {
         // Create new column
         auto column = std::make_unique<ChunkColumn>(colPos);
+        column->setRandomTickSet(&randomTickSet_);
         if (columnGenerator_) {
             columnGenerator_(*column);
         }
@@ -75,6 +76,7 @@ ChunkColumn& World::getOrCreateColumn(ColumnPos pos) {
     }
 
     auto column = std::make_unique<ChunkColumn>(pos);
+    column->setRandomTickSet(&randomTickSet_);
     if (columnGenerator_) {
         columnGenerator_(*column);
     }
@@ -176,6 +178,19 @@ std::vector<ChunkPos> World::getAllSubChunkPositions() const {
     return positions;
 }
 
+void World::forEachRandomTickSubChunk(const std::function<void(ChunkPos, SubChunk&)>& callback) {
+    std::shared_lock lock(columnMutex_);
+    randomTickSet_.forEach([&](ChunkPos pos) {
+        auto it = columns_.find(ColumnPos::fromChunk(pos).pack());
+        if (it == columns_.end()) {
+            return;
+        }
+        if (SubChunk* subChunk = it->second->getSubChunk(pos.y)) {
+            callback(pos, *subChunk);
+        }
+    });
+}
+
 void World::clear() {
     std::unique_lock lock(columnMutex_);
     columns_.clear();
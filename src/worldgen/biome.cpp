@@ -24,6 +24,17 @@ std::string_view BiomeId::name() const {
     return StringInterner::global().lookup(id);
 }
 
+// ============================================================================
+// BiomeProperties
+// ============================================================================
+
+void BiomeProperties::resolveBlockIds() {
+    surfaceBlockId = BlockTypeId::fromName(surfaceBlock);
+    fillerBlockId = BlockTypeId::fromName(fillerBlock);
+    stoneBlockId = BlockTypeId::fromName(stoneBlock);
+    underwaterBlockId = BlockTypeId::fromName(underwaterBlock);
+}
+
 // ============================================================================
 // BiomeRegistry
 // ============================================================================
@@ -37,7 +48,9 @@ void BiomeRegistry::registerBiome(std::string_view name, BiomeProperties propert
     std::unique_lock lock(mutex_);
     BiomeId biomeId = BiomeId::fromName(name);
     properties.id = biomeId;
+    properties.resolveBlockIds();
     biomes_[biomeId] = std::move(properties);
+    generation_.fetch_add(1, std::memory_order_release);
 }
 
 const BiomeProperties* BiomeRegistry::getBiome(BiomeId id) const {
@@ -70,6 +83,7 @@ size_t BiomeRegistry::size() const {
 void BiomeRegistry::clear() {
     std::unique_lock lock(mutex_);
     biomes_.clear();
+    generation_.fetch_add(1, std::memory_order_release);
 }
 
 BiomeId BiomeRegistry::selectBiome(float temperature, float humidity) const {
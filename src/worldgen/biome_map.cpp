@@ -8,12 +8,29 @@
 #include "finevox/worldgen/biome_map.hpp"
 #include "finevox/worldgen/noise.hpp"
 #include "finevox/worldgen/noise_ops.hpp"
+#include "finevox/worldgen/pass_counters.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
 
 namespace finevox::worldgen {
 
-BiomeMap::BiomeMap(uint64_t worldSeed, const BiomeRegistry& registry, float cellSize)
+namespace {
+
+uint64_t cellKey(int32_t cellX, int32_t cellZ) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) |
+           static_cast<uint32_t>(cellZ);
+}
+
+}  // namespace
+
+BiomeMap::BiomeMap(uint64_t worldSeed, const BiomeRegistry& registry, float cellSize,
+                   size_t cachedCells)
     : registry_(registry),
-      voronoi_(worldSeed, cellSize) {
+      voronoi_(worldSeed, cellSize),
+      cells_(std::max<size_t>(cachedCells, 1)) {
     // Temperature noise: very low frequency, covers large regions
     temperatureNoise_ = NoiseFactory::simplexFBM(
         NoiseHash::deriveSeed(worldSeed, 1000), 4, 0.0005f);
@@ -25,6 +42,7 @@ BiomeMap::BiomeMap(uint64_t worldSeed, const BiomeRegistry& registry, float cell
 
 std::pair<float, float> BiomeMap::cellClimate(float cellCenterX, float cellCenterZ) const {
     // Evaluate climate noise at the cell center
+    PassCounters::current().noiseSamples += 2;
     float temp = temperatureNoise_->evaluate(cellCenterX, cellCenterZ);
     float hum = humidityNoise_->evaluate(cellCenterX, cellCenterZ);
 
@@ -35,42 +53,110 @@ std::pair<float, float> BiomeMap::cellClimate(float cellCenterX, float cellCente
     return {temp, hum};
 }
 
-BiomeId BiomeMap::getBiome(float x, float z) const {
-    auto result = voronoi_.evaluate(x, z);
-    auto [temp, hum] = cellClimate(result.cellCenter.x, result.cellCenter.y);
-    return registry_.selectBiome(temp, hum);
+// ============================================================================
+// Cell cache
+// ============================================================================
+
+BiomeMap::CellInfo BiomeMap::evaluateCell(const VoronoiResult& voronoi) const {
+    CellInfo info;
+
+    // Primary biome from the cell's climate
+    auto [temp, hum] = cellClimate(voronoi.cellCenter.x, voronoi.cellCenter.y);
+    info.primary = registry_.selectBiome(temp, hum);
+
+    // For secondary biome, we'd need the second cell's center
+    // Approximation: use slightly different climate for secondary
+    // (This is acceptable since exact second cell center isn't stored in VoronoiResult)
+    float temp2 = temp + 0.1f;
+    float hum2 = hum + 0.1f;
+    if (temp2 > 1.0f) temp2 -= 0.2f;
+    if (hum2 > 1.0f) hum2 -= 0.2f;
+    info.secondary = registry_.selectBiome(temp2, hum2);
+
+    if (const BiomeProperties* props = registry_.getBiome(info.primary)) {
+        info.hasPrimaryProps = true;
+        info.primaryBase = props->baseHeight;
+        info.primaryVariation = props->heightVariation;
+    }
+    if (const BiomeProperties* props = registry_.getBiome(info.secondary)) {
+        info.hasSecondaryProps = true;
+        info.secondaryBase = props->baseHeight;
+        info.secondaryVariation = props->heightVariation;
+    }
+    return info;
 }
 
-BiomeBlend BiomeMap::getBlendedBiome(float x, float z) const {
-    auto result = voronoi_.evaluate(x, z);
+BiomeMap::CellInfo BiomeMap::cellInfo(const VoronoiResult& voronoi) const {
+    uint64_t key = cellKey(voronoi.cellX, voronoi.cellZ);
+    uint64_t generation = registry_.generation();
+    {
+        std::lock_guard lock(cellMutex_);
+        if (generation != cellsGeneration_) {
+            // Biomes were registered, reloaded or cleared since these were cached
+            cells_.clear();
+            cellsGeneration_ = generation;
+        }
+        if (const CellInfo* cached = cells_.peek(key)) {
+            stats_.cellHits.fetch_add(1, std::memory_order_relaxed);
+            return *cached;
+        }
+    }
 
-    // Primary biome from nearest cell
-    auto [temp1, hum1] = cellClimate(result.cellCenter.x, result.cellCenter.y);
-    BiomeId primary = registry_.selectBiome(temp1, hum1);
+    // Evaluate outside the lock; a concurrent miss on the same cell computes
+    // the same values, so whichever put lands last is equally valid
+    CellInfo info = evaluateCell(voronoi);
+    stats_.cellMisses.fetch_add(1, std::memory_order_relaxed);
 
+    std::lock_guard lock(cellMutex_);
+    if (cellsGeneration_ == generation) {
+        cells_.put(key, info);
+    }
+    return info;
+}
+
+float BiomeMap::blendWeight(const VoronoiResult& voronoi) const {
     // Blend weight from F2-F1 relative to cell size
     // Small F2-F1 = near border = more blending
-    float edgeDistance = result.distance2 - result.distance1;
+    float edgeDistance = voronoi.distance2 - voronoi.distance1;
     float blendZone = voronoi_.cellSize() * 0.1f;  // Blend within 10% of cell size
-    float blendWeight = 1.0f - std::min(edgeDistance / blendZone, 1.0f);
+    return 1.0f - std::min(edgeDistance / blendZone, 1.0f);
+}
 
-    // For secondary biome, we'd need the second cell's center
-    // Approximation: use slightly different climate for secondary
-    // (This is acceptable since exact second cell center isn't stored in VoronoiResult)
-    BiomeId secondary = primary;
-    if (blendWeight > 0.0f) {
-        // Perturb climate slightly toward a different biome
-        float temp2 = temp1 + 0.1f;
-        float hum2 = hum1 + 0.1f;
-        if (temp2 > 1.0f) temp2 -= 0.2f;
-        if (hum2 > 1.0f) hum2 -= 0.2f;
-        secondary = registry_.selectBiome(temp2, hum2);
-        if (secondary == primary) {
-            blendWeight = 0.0f;
-        }
+BiomeMap::Sample BiomeMap::sample(float x, float z) const {
+    auto voronoi = voronoi_.evaluate(x, z);
+    return {cellInfo(voronoi), blendWeight(voronoi)};
+}
+
+std::pair<float, float> BiomeMap::terrainParams(const Sample& sample) {
+    const CellInfo& cell = sample.cell;
+    if (!cell.hasPrimaryProps) {
+        return {64.0f, 16.0f};  // Fallback defaults
     }
 
-    return {primary, secondary, blendWeight};
+    float w = sample.blendWeight;
+    if (w <= 0.0f || cell.primary == cell.secondary || !cell.hasSecondaryProps) {
+        return {cell.primaryBase, cell.primaryVariation};
+    }
+
+    float baseHeight = cell.primaryBase * (1.0f - w) + cell.secondaryBase * w;
+    float heightVar = cell.primaryVariation * (1.0f - w) + cell.secondaryVariation * w;
+    return {baseHeight, heightVar};
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+BiomeId BiomeMap::getBiome(float x, float z) const {
+    return cellInfo(voronoi_.evaluate(x, z)).primary;
+}
+
+BiomeBlend BiomeMap::getBlendedBiome(float x, float z) const {
+    Sample s = sample(x, z);
+    if (s.blendWeight <= 0.0f || s.cell.secondary == s.cell.primary) {
+        return {s.cell.primary, s.cell.primary, 0.0f};
+    }
+    return {s.cell.primary, s.cell.secondary, s.blendWeight};
 }
 
 float BiomeMap::getTemperature(float x, float z) const {
@@ -84,27 +170,97 @@ float BiomeMap::getHumidity(float x, float z) const {
 }
 
 std::pair<float, float> BiomeMap::getTerrainParams(float x, float z) const {
-    auto blend = getBlendedBiome(x, z);
+    return terrainParams(sample(x, z));
+}
 
-    const BiomeProperties* primaryProps = registry_.getBiome(blend.primary);
-    if (!primaryProps) {
-        return {64.0f, 16.0f};  // Fallback defaults
+void BiomeMap::sampleColumn(ColumnPos pos, ColumnBiomeGrid& out, int32_t paramStep) const {
+    if (paramStep <= 0 || 16 % paramStep != 0) {
+        throw std::invalid_argument("BiomeMap: paramStep must divide 16");
     }
+    int32_t worldX = pos.x * 16;
+    int32_t worldZ = pos.z * 16;
 
-    if (blend.blendWeight <= 0.0f || blend.primary == blend.secondary) {
-        return {primaryProps->baseHeight, primaryProps->heightVariation};
+    // A column touches only a few cells; keep them locally so the shared
+    // cache is consulted once per cell rather than once per block
+    std::vector<std::pair<uint64_t, CellInfo>> local;
+    uint64_t sampledCell = 0;  // Cell of the last sampleAt()
+    auto sampleAt = [&](int32_t lx, int32_t lz) {
+        ++PassCounters::current().noiseSamples;
+        auto voronoi = voronoi_.evaluate(static_cast<float>(worldX + lx),
+                                         static_cast<float>(worldZ + lz));
+        uint64_t key = cellKey(voronoi.cellX, voronoi.cellZ);
+        sampledCell = key;
+        auto it = std::find_if(local.begin(), local.end(),
+            [&](const auto& entry) { return entry.first == key; });
+        if (it == local.end()) {
+            local.emplace_back(key, cellInfo(voronoi));
+            it = local.end() - 1;
+        }
+        return Sample{it->second, blendWeight(voronoi)};
+    };
+
+    if (paramStep == 1) {
+        for (int32_t lx = 0; lx < 16; ++lx) {
+            for (int32_t lz = 0; lz < 16; ++lz) {
+                Sample s = sampleAt(lx, lz);
+                size_t idx = static_cast<size_t>(lx * 16 + lz);
+                out.biomes[idx] = s.cell.primary;
+                std::tie(out.baseHeight[idx], out.heightVariation[idx]) = terrainParams(s);
+            }
+        }
+        return;
     }
 
-    const BiomeProperties* secondaryProps = registry_.getBiome(blend.secondary);
-    if (!secondaryProps) {
-        return {primaryProps->baseHeight, primaryProps->heightVariation};
+    // Terrain parameters and Voronoi cells on the (16 / paramStep + 1)^2
+    // corner lattice
+    struct Post {
+        uint64_t cell;
+        BiomeId primary;
+        std::pair<float, float> params;
+    };
+    int32_t cells = 16 / paramStep;
+    int32_t posts = cells + 1;
+    std::vector<Post> lattice(static_cast<size_t>(posts * posts));
+    for (int32_t gx = 0; gx < posts; ++gx) {
+        for (int32_t gz = 0; gz < posts; ++gz) {
+            Sample s = sampleAt(gx * paramStep, gz * paramStep);
+            lattice[static_cast<size_t>(gx * posts + gz)] =
+                Post{sampledCell, s.cell.primary, terrainParams(s)};
+        }
     }
 
-    float w = blend.blendWeight;
-    float baseHeight = primaryProps->baseHeight * (1.0f - w) + secondaryProps->baseHeight * w;
-    float heightVar = primaryProps->heightVariation * (1.0f - w) + secondaryProps->heightVariation * w;
+    float inv = 1.0f / static_cast<float>(paramStep);
+    for (int32_t gx = 0; gx < cells; ++gx) {
+        for (int32_t gz = 0; gz < cells; ++gz) {
+            const Post& p00 = lattice[static_cast<size_t>(gx * posts + gz)];
+            const Post& p01 = lattice[static_cast<size_t>(gx * posts + gz + 1)];
+            const Post& p10 = lattice[static_cast<size_t>((gx + 1) * posts + gz)];
+            const Post& p11 = lattice[static_cast<size_t>((gx + 1) * posts + gz + 1)];
 
-    return {baseHeight, heightVar};
+            // Voronoi cells are convex, so a square whose corners share a
+            // cell lies inside it; only squares on a border search per block
+            bool oneCell = p00.cell == p01.cell && p00.cell == p10.cell && p00.cell == p11.cell;
+
+            for (int32_t lx = gx * paramStep; lx < (gx + 1) * paramStep; ++lx) {
+                float fx = static_cast<float>(lx - gx * paramStep) * inv;
+                for (int32_t lz = gz * paramStep; lz < (gz + 1) * paramStep; ++lz) {
+                    float fz = static_cast<float>(lz - gz * paramStep) * inv;
+                    auto bilerp = [&](float a, float b, float c, float d) {
+                        float near = a + (b - a) * fz;
+                        float far = c + (d - c) * fz;
+                        return near + (far - near) * fx;
+                    };
+
+                    size_t idx = static_cast<size_t>(lx * 16 + lz);
+                    out.biomes[idx] = oneCell ? p00.primary : sampleAt(lx, lz).cell.primary;
+                    out.baseHeight[idx] = bilerp(p00.params.first, p01.params.first,
+                                                 p10.params.first, p11.params.first);
+                    out.heightVariation[idx] = bilerp(p00.params.second, p01.params.second,
+                                                      p10.params.second, p11.params.second);
+                }
+            }
+        }
+    }
 }
 
 }  // namespace finevox::worldgen
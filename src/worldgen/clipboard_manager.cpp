@@ -17,6 +17,7 @@ ClipboardManager& ClipboardManager::instance() {
 }
 
 void ClipboardManager::setClipboard(Schematic schematic) {
+    schematic.compact();
     std::lock_guard<std::mutex> lock(mutex_);
     clipboard_ = std::make_unique<Schematic>(std::move(schematic));
 }
@@ -32,6 +33,7 @@ void ClipboardManager::clearClipboard() {
 }
 
 void ClipboardManager::setNamed(std::string_view name, Schematic schematic) {
+    schematic.compact();
     std::lock_guard<std::mutex> lock(mutex_);
     namedClipboards_.insert_or_assign(std::string(name), std::move(schematic));
 }
@@ -55,14 +57,16 @@ void ClipboardManager::clearAll() {
     clipboard_.reset();
     namedClipboards_.clear();
     history_.clear();
+    historyBytes_ = 0;
 }
 
 void ClipboardManager::pushHistory(Schematic schematic) {
+    schematic.compact();
+    size_t bytes = schematic.memoryUsage();
     std::lock_guard<std::mutex> lock(mutex_);
     history_.push_front(std::move(schematic));
-    while (history_.size() > maxHistorySize_) {
-        history_.pop_back();
-    }
+    historyBytes_ += bytes;
+    trimHistory();
 }
 
 const Schematic* ClipboardManager::historyAt(size_t index) const {
@@ -78,15 +82,34 @@ size_t ClipboardManager::historySize() const {
     return history_.size();
 }
 
+size_t ClipboardManager::historyMemoryUsage() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return historyBytes_;
+}
+
 void ClipboardManager::clearHistory() {
     std::lock_guard<std::mutex> lock(mutex_);
     history_.clear();
+    historyBytes_ = 0;
 }
 
 void ClipboardManager::setMaxHistorySize(size_t max) {
     std::lock_guard<std::mutex> lock(mutex_);
     maxHistorySize_ = max;
-    while (history_.size() > maxHistorySize_) {
+    trimHistory();
+}
+
+void ClipboardManager::setMaxHistoryMemory(size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    maxHistoryBytes_ = bytes;
+    trimHistory();
+}
+
+void ClipboardManager::trimHistory() {
+    // The newest entry stays even if it alone exceeds the memory budget
+    while (history_.size() > maxHistorySize_ ||
+           (history_.size() > 1 && historyBytes_ > maxHistoryBytes_)) {
+        historyBytes_ -= history_.back().memoryUsage();
         history_.pop_back();
     }
 }
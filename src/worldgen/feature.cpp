@@ -0,0 +1,70 @@
+/**
+ * @file feature.cpp
+ * @brief FeaturePlacementContext block access
+ *
+ * Design: [27-world-generation.md] Section 27.6.3
+ */
+
+#include "finevox/worldgen/feature.hpp"
+#include "finevox/worldgen/feature_write_buffer.hpp"
+#include "finevox/worldgen/pass_counters.hpp"
+#include "finevox/worldgen/world_generator.hpp"
+#include "finevox/core/chunk_column.hpp"
+#include "finevox/core/world.hpp"
+
+namespace finevox::worldgen {
+
+ChunkColumn* FeaturePlacementContext::ownColumn(BlockPos pos) const {
+    if (genCtx && ColumnPos::fromBlock(pos) == genCtx->pos) {
+        return &genCtx->column;
+    }
+    return nullptr;
+}
+
+bool FeaturePlacementContext::defer(BlockPos pos, BlockTypeId type, BlockTypeId expected,
+                                    bool conditional) {
+    if (!genCtx || !genCtx->pendingWrites) {
+        return false;
+    }
+    return genCtx->pendingWrites->add(FeatureWriteBuffer::Write{
+        genCtx->pos, genCtx->pendingWriteSequence++, pos, type, expected, conditional});
+}
+
+BlockTypeId FeaturePlacementContext::getBlock(BlockPos pos) const {
+    if (ChunkColumn* column = ownColumn(pos)) {
+        return column->getBlock(pos);
+    }
+    return world.getBlock(pos);
+}
+
+void FeaturePlacementContext::setBlock(BlockPos pos, BlockTypeId type) {
+    ++PassCounters::current().blocksWritten;
+    if (ChunkColumn* column = ownColumn(pos)) {
+        column->setBlock(pos, type);
+    } else if (!defer(pos, type, BlockTypeId{}, false)) {
+        world.setBlock(pos, type);
+    }
+}
+
+bool FeaturePlacementContext::replaceBlock(BlockPos pos, BlockTypeId expected, BlockTypeId type) {
+    if (ChunkColumn* column = ownColumn(pos)) {
+        if (column->getBlock(pos) != expected) {
+            return false;
+        }
+        column->setBlock(pos, type);
+        ++PassCounters::current().blocksWritten;
+        return true;
+    }
+    if (defer(pos, type, expected, true)) {
+        ++PassCounters::current().blocksWritten;
+        return true;
+    }
+    if (world.getBlock(pos) != expected) {
+        return false;
+    }
+    world.setBlock(pos, type);
+    ++PassCounters::current().blocksWritten;
+    return true;
+}
+
+}  // namespace finevox::worldgen
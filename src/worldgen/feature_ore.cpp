@@ -6,8 +6,12 @@
  */
 
 #include "finevox/worldgen/feature_ore.hpp"
-#include "finevox/worldgen/noise.hpp"
-#include "finevox/core/world.hpp"
+#include "finevox/worldgen/pass_counters.hpp"
+#include "finevox/worldgen/world_generator.hpp"
+#include "finevox/core/chunk_column.hpp"
+#include "finevox/core/column_bulk_writer.hpp"
+
+#include <algorithm>
 
 namespace finevox::worldgen {
 
@@ -18,26 +22,20 @@ std::string_view OreFeature::name() const {
     return name_;
 }
 
-FeatureResult OreFeature::place(FeaturePlacementContext& ctx) {
-    int32_t placed = 0;
-    int32_t cx = ctx.origin.x;
-    int32_t cy = ctx.origin.y;
-    int32_t cz = ctx.origin.z;
+void OreFeature::veinPositions(BlockPos origin, uint64_t seed, std::vector<BlockPos>& out) const {
+    int32_t cx = origin.x;
+    int32_t cy = origin.y;
+    int32_t cz = origin.z;
 
     // Check height range
     if (cy < config_.minHeight || cy > config_.maxHeight) {
-        return FeatureResult::Skipped;
+        return;
     }
 
-    uint64_t rng = ctx.seed;
+    uint64_t rng = seed;
 
     for (int32_t i = 0; i < config_.veinSize; ++i) {
-        // Place ore if current position has the replaceable block
-        BlockTypeId current = ctx.world.getBlock(cx, cy, cz);
-        if (current == config_.replaceBlock) {
-            ctx.world.setBlock(cx, cy, cz, config_.oreBlock);
-            ++placed;
-        }
+        out.push_back(BlockPos(cx, cy, cz));
 
         // Random walk to next position
         // SplitMix64-style step for the RNG
@@ -57,6 +55,19 @@ FeatureResult OreFeature::place(FeaturePlacementContext& ctx) {
             case 5: --cz; break;
         }
     }
+}
+
+FeatureResult OreFeature::place(FeaturePlacementContext& ctx) {
+    std::vector<BlockPos> positions;
+    veinPositions(ctx.origin, ctx.seed, positions);
+
+    int32_t placed = 0;
+    for (BlockPos pos : positions) {
+        // Place ore if current position has the replaceable block
+        if (ctx.replaceBlock(pos, config_.replaceBlock, config_.oreBlock)) {
+            ++placed;
+        }
+    }
 
     return placed > 0 ? FeatureResult::Placed : FeatureResult::Skipped;
 }
@@ -67,4 +78,75 @@ BlockPos OreFeature::maxExtent() const {
     return BlockPos(r, r, r);
 }
 
+// ============================================================================
+// OreVeinBatch
+// ============================================================================
+
+void OreVeinBatch::addVein(const OreFeature& feature, BlockPos origin, uint64_t seed) {
+    size_t begin = positions_.size();
+    feature.veinPositions(origin, seed, positions_);
+    if (positions_.size() > begin) {
+        veins_.push_back({feature.config().replaceBlock, feature.config().oreBlock,
+                          static_cast<uint32_t>(begin), static_cast<uint32_t>(positions_.size())});
+    }
+}
+
+size_t OreVeinBatch::apply(FeaturePlacementContext& ctx) {
+    size_t placed = 0;
+    GenerationContext* genCtx = ctx.genCtx;
+
+    // Blocks outside the column, in vein order. Their relative order is all
+    // that matters: nothing below writes into another column.
+    inColumn_.clear();
+    int32_t minChunkY = 0;
+    int32_t maxChunkY = -1;
+    for (uint32_t v = 0; v < veins_.size(); ++v) {
+        const Vein& vein = veins_[v];
+        for (uint32_t p = vein.begin; p < vein.end; ++p) {
+            BlockPos pos = positions_[p];
+            if (genCtx && ColumnPos::fromBlock(pos) == genCtx->pos) {
+                int32_t chunkY = ChunkColumn::worldYToChunkY(pos.y);
+                minChunkY = inColumn_.empty() ? chunkY : std::min(minChunkY, chunkY);
+                maxChunkY = inColumn_.empty() ? chunkY : std::max(maxChunkY, chunkY);
+                inColumn_.push_back({p, v});
+            } else if (ctx.replaceBlock(pos, vein.replace, vein.ore)) {
+                ++placed;
+            }
+        }
+    }
+    if (inColumn_.empty()) {
+        return placed;
+    }
+
+    // Own column grouped by subchunk (counting sort). The grouping is stable,
+    // so writes to the same block keep their vein order and each sees the
+    // earlier ones.
+    auto bucket = [&](const Pending& e) {
+        return static_cast<size_t>(ChunkColumn::worldYToChunkY(positions_[e.position].y) - minChunkY);
+    };
+    bucketStart_.assign(static_cast<size_t>(maxChunkY - minChunkY + 2), 0);
+    for (const Pending& e : inColumn_) {
+        ++bucketStart_[bucket(e) + 1];
+    }
+    for (size_t b = 1; b < bucketStart_.size(); ++b) {
+        bucketStart_[b] += bucketStart_[b - 1];
+    }
+    sorted_.resize(inColumn_.size());
+    for (const Pending& e : inColumn_) {
+        sorted_[bucketStart_[bucket(e)]++] = e;
+    }
+
+    ColumnBulkWriter writer(genCtx->column);
+    for (const Pending& e : sorted_) {
+        BlockPos pos = positions_[e.position];
+        const Vein& vein = veins_[e.vein];
+        if (writer.replaceBlock(pos.x & 15, pos.y, pos.z & 15, vein.replace, vein.ore)) {
+            ++placed;
+        }
+    }
+    writer.finish();
+    PassCounters::current().blocksWritten += writer.blocksWritten();
+    return placed;
+}
+
 }  // namespace finevox::worldgen
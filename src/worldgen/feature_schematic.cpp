@@ -6,7 +6,8 @@
  */
 
 #include "finevox/worldgen/feature_schematic.hpp"
-#include "finevox/core/world.hpp"
+
+#include <vector>
 
 namespace finevox::worldgen {
 
@@ -24,17 +25,24 @@ std::string_view SchematicFeature::name() const {
 FeatureResult SchematicFeature::place(FeaturePlacementContext& ctx) {
     if (!schematic_) return FeatureResult::Failed;
 
+    // Resolve each palette entry once; side-table cells carry their own name
+    const auto& palette = schematic_->palette();
+    std::vector<BlockTypeId> paletteIds(palette.size());
+    for (size_t i = 1; i < palette.size(); ++i) {
+        paletteIds[i] = BlockTypeId::fromName(palette[i].typeName);
+    }
+
     int32_t placed = 0;
 
-    schematic_->forEachBlock([&](glm::ivec3 pos, const BlockSnapshot& snap) {
+    schematic_->forEachBlockIndexed([&](glm::ivec3 pos, uint32_t paletteIndex,
+                                        const BlockSnapshot& snap) {
         if (ignoreAir_ && snap.isAir()) return;
 
-        int32_t wx = ctx.origin.x + pos.x;
-        int32_t wy = ctx.origin.y + pos.y;
-        int32_t wz = ctx.origin.z + pos.z;
-
-        BlockTypeId blockType = BlockTypeId::fromName(snap.typeName);
-        ctx.world.setBlock(wx, wy, wz, blockType);
+        BlockTypeId blockType = paletteIndex != Schematic::NO_PALETTE_INDEX
+                                    ? paletteIds[paletteIndex]
+                                    : BlockTypeId::fromName(snap.typeName);
+        ctx.setBlock(BlockPos(ctx.origin.x + pos.x, ctx.origin.y + pos.y, ctx.origin.z + pos.z),
+                     blockType);
         ++placed;
     });
 
@@ -7,7 +7,9 @@
 
 #include "finevox/worldgen/feature_tree.hpp"
 #include "finevox/worldgen/noise.hpp"
-#include "finevox/core/world.hpp"
+
+#include <algorithm>
+#include <cstdlib>
 
 namespace finevox::worldgen {
 
@@ -19,21 +21,20 @@ std::string_view TreeFeature::name() const {
 }
 
 FeatureResult TreeFeature::place(FeaturePlacementContext& ctx) {
-    if (config_.requiresSoil && !checkSoil(ctx.world, ctx.origin)) {
+    if (config_.requiresSoil && !checkSoil(ctx)) {
         return FeatureResult::Skipped;
     }
 
     int32_t height = trunkHeight(ctx.seed);
 
-    if (!checkClearance(ctx.world, ctx.origin, height)) {
+    if (!checkClearance(ctx, height)) {
         return FeatureResult::Skipped;
     }
 
     // Place trunk
     for (int32_t y = 0; y < height; ++y) {
-        ctx.world.setBlock(
-            ctx.origin.x, ctx.origin.y + y, ctx.origin.z,
-            config_.trunkBlock);
+        ctx.setBlock(BlockPos(ctx.origin.x, ctx.origin.y + y, ctx.origin.z),
+                     config_.trunkBlock);
     }
 
     // Place leaf canopy
@@ -63,14 +64,9 @@ FeatureResult TreeFeature::place(FeaturePlacementContext& ctx) {
                 // Don't replace trunk
                 if (dx == 0 && dz == 0 && dy < height) continue;
 
-                int32_t wx = ctx.origin.x + dx;
-                int32_t wy = ctx.origin.y + dy;
-                int32_t wz = ctx.origin.z + dz;
-
                 // Only place leaves in air
-                if (ctx.world.getBlock(wx, wy, wz).isAir()) {
-                    ctx.world.setBlock(wx, wy, wz, config_.leavesBlock);
-                }
+                BlockPos leaf(ctx.origin.x + dx, ctx.origin.y + dy, ctx.origin.z + dz);
+                (void)ctx.replaceBlock(leaf, AIR_BLOCK_TYPE, config_.leavesBlock);
             }
         }
     }
@@ -90,16 +86,16 @@ int32_t TreeFeature::trunkHeight(uint64_t seed) const {
            static_cast<int32_t>(seed % static_cast<uint64_t>(range + 1));
 }
 
-bool TreeFeature::checkSoil(World& world, BlockPos origin) const {
+bool TreeFeature::checkSoil(const FeaturePlacementContext& ctx) const {
     // Check that the block below origin is a solid (non-air) block
-    BlockTypeId below = world.getBlock(origin.x, origin.y - 1, origin.z);
+    BlockTypeId below = ctx.getBlock(BlockPos(ctx.origin.x, ctx.origin.y - 1, ctx.origin.z));
     return !below.isAir();
 }
 
-bool TreeFeature::checkClearance(World& world, BlockPos origin, int32_t height) const {
+bool TreeFeature::checkClearance(const FeaturePlacementContext& ctx, int32_t height) const {
     // Check trunk column is clear
     for (int32_t y = 0; y < height; ++y) {
-        BlockTypeId block = world.getBlock(origin.x, origin.y + y, origin.z);
+        BlockTypeId block = ctx.getBlock(BlockPos(ctx.origin.x, ctx.origin.y + y, ctx.origin.z));
         if (!block.isAir()) return false;
     }
     return true;
@@ -0,0 +1,99 @@
+/**
+ * @file feature_write_buffer.cpp
+ * @brief Deferred cross-column block writes from feature placement
+ *
+ * Design: [27-world-generation.md] Section 27.6.3
+ */
+
+#include "finevox/worldgen/feature_write_buffer.hpp"
+#include "finevox/core/chunk_column.hpp"
+
+#include <algorithm>
+
+namespace finevox::worldgen {
+
+bool FeatureWriteBuffer::add(const Write& write) {
+    if (router_ && router_(write)) {
+        return true;
+    }
+    ColumnPos target = ColumnPos::fromBlock(write.pos);
+    std::lock_guard lock(mutex_);
+    if (flushed_.contains(target)) {
+        return false;
+    }
+    pending_[target].push_back(write);
+    ++pendingCount_;
+    stats_.buffered.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+size_t FeatureWriteBuffer::flush(ColumnPos pos, ChunkColumn& column) {
+    std::vector<Write> writes;
+    {
+        std::lock_guard lock(mutex_);
+        flushed_.insert(pos);
+        auto it = pending_.find(pos);
+        if (it != pending_.end()) {
+            writes = std::move(it->second);
+            pending_.erase(it);
+            pendingCount_ -= writes.size();
+        }
+    }
+    stats_.columnsFlushed.fetch_add(1, std::memory_order_relaxed);
+
+    // Arrival order interleaves sources by thread timing; this order does not
+    std::sort(writes.begin(), writes.end(), [](const Write& a, const Write& b) {
+        return a.source != b.source ? a.source < b.source : a.sequence < b.sequence;
+    });
+
+    size_t applied = 0;
+    uint64_t rejected = 0;
+    for (const Write& w : writes) {
+        if (w.conditional && column.getBlock(w.pos) != w.expected) {
+            ++rejected;
+            continue;
+        }
+        column.setBlock(w.pos, w.type);
+        ++applied;
+    }
+    stats_.applied.fetch_add(applied, std::memory_order_relaxed);
+    stats_.rejected.fetch_add(rejected, std::memory_order_relaxed);
+    return applied;
+}
+
+std::vector<FeatureWriteBuffer::Write> FeatureWriteBuffer::takePending() {
+    std::vector<Write> writes;
+    std::lock_guard lock(mutex_);
+    writes.reserve(pendingCount_);
+    for (auto& [pos, queued] : pending_) {
+        writes.insert(writes.end(), queued.begin(), queued.end());
+    }
+    pending_.clear();
+    pendingCount_ = 0;
+    return writes;
+}
+
+size_t FeatureWriteBuffer::discard(ColumnPos pos) {
+    std::lock_guard lock(mutex_);
+    flushed_.erase(pos);
+    auto it = pending_.find(pos);
+    if (it == pending_.end()) {
+        return 0;
+    }
+    size_t dropped = it->second.size();
+    pendingCount_ -= dropped;
+    pending_.erase(it);
+    return dropped;
+}
+
+bool FeatureWriteBuffer::isFlushed(ColumnPos pos) const {
+    std::lock_guard lock(mutex_);
+    return flushed_.contains(pos);
+}
+
+size_t FeatureWriteBuffer::pendingWrites() const {
+    std::lock_guard lock(mutex_);
+    return pendingCount_;
+}
+
+}  // namespace finevox::worldgen
@@ -7,13 +7,18 @@
 
 #include "finevox/worldgen/generation_passes.hpp"
 #include "finevox/core/chunk_column.hpp"
+#include "finevox/core/column_bulk_writer.hpp"
 #include "finevox/worldgen/noise_ops.hpp"
 #include "finevox/core/world.hpp"
 #include "finevox/worldgen/feature.hpp"
 #include "finevox/worldgen/feature_ore.hpp"
 #include "finevox/worldgen/feature_tree.hpp"
+#include "finevox/worldgen/pass_counters.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <stdexcept>
+#include <vector>
 
 namespace finevox::worldgen {
 
@@ -21,7 +26,13 @@ namespace finevox::worldgen {
 // TerrainPass
 // ============================================================================
 
-TerrainPass::TerrainPass(uint64_t worldSeed) {
+TerrainPass::TerrainPass(uint64_t worldSeed, int32_t biomeParamStep)
+    : biomeParamStep_(biomeParamStep)
+{
+    if (biomeParamStep <= 0 || 16 % biomeParamStep != 0) {
+        throw std::invalid_argument("TerrainPass: biomeParamStep must divide 16");
+    }
+
     // Continental shape: low-frequency noise
     continentNoise_ = NoiseFactory::simplexFBM(
         NoiseHash::deriveSeed(worldSeed, 100), 6, 0.002f);
@@ -33,24 +44,38 @@ TerrainPass::TerrainPass(uint64_t worldSeed) {
     // 3D density for overhangs (optional enrichment)
     densityNoise_ = NoiseFactory::simplexFBM3D(
         NoiseHash::deriveSeed(worldSeed, 300), 4, 0.02f);
+
+    stoneId_ = BlockTypeId::fromName("stone");
 }
 
 void TerrainPass::generate(GenerationContext& ctx) {
-    BlockTypeId stoneId = BlockTypeId::fromName("stone");
     int32_t worldX = ctx.pos.x * 16;
     int32_t worldZ = ctx.pos.z * 16;
 
+    // Sample both height noises for the whole column in one batch each
+    NoiseGrid2D grid;
+    grid.x0 = static_cast<float>(worldX);
+    grid.z0 = static_cast<float>(worldZ);
+    std::array<float, 256> continentGrid;
+    std::array<float, 256> detailGrid;
+    continentNoise_->evaluateGrid(grid, continentGrid);
+    detailNoise_->evaluateGrid(grid, detailGrid);
+
+    // Biomes and biome-blended terrain parameters for the whole column
+    ColumnBiomeGrid biomeGrid;
+    ctx.biomeMap.sampleColumn(ctx.pos, biomeGrid, biomeParamStep_);
+    ctx.biomes = biomeGrid.biomes;
+
+    int32_t minSurface = 255;
     for (int32_t lx = 0; lx < 16; ++lx) {
         for (int32_t lz = 0; lz < 16; ++lz) {
-            float wx = static_cast<float>(worldX + lx);
-            float wz = static_cast<float>(worldZ + lz);
-
-            // Get biome-blended terrain parameters
-            auto [baseHeight, heightVar] = ctx.biomeMap.getTerrainParams(wx, wz);
+            int32_t idx = GenerationContext::hmIndex(lx, lz);
+            float baseHeight = biomeGrid.baseHeight[static_cast<size_t>(idx)];
+            float heightVar = biomeGrid.heightVariation[static_cast<size_t>(idx)];
 
             // Sample noise for height
-            float continent = continentNoise_->evaluate(wx, wz);
-            float detail = detailNoise_->evaluate(wx, wz);
+            float continent = continentGrid[static_cast<size_t>(idx)];
+            float detail = detailGrid[static_cast<size_t>(idx)];
 
             int32_t surfaceY = static_cast<int32_t>(
                 baseHeight + continent * heightVar + detail * 4.0f);
@@ -59,61 +84,90 @@ void TerrainPass::generate(GenerationContext& ctx) {
             if (surfaceY < 1) surfaceY = 1;
             if (surfaceY > 255) surfaceY = 255;
 
-            int32_t idx = GenerationContext::hmIndex(lx, lz);
             ctx.heightmap[idx] = surfaceY;
-            ctx.biomes[idx] = ctx.biomeMap.getBiome(wx, wz);
+            minSurface = std::min(minSurface, surfaceY);
+        }
+    }
 
-            // Fill stone from y=0 up to surface
-            for (int32_t y = 0; y <= surfaceY; ++y) {
-                ctx.column.setBlock(lx, y, lz, stoneId);
-            }
+    // Fill stone from y=0 up to surface: whole layers up to the lowest
+    // surface in the column, then the remaining run per (x, z)
+    ColumnBulkWriter writer(ctx.column);
+    writer.fillLayers(0, minSurface + 1, stoneId_);
+    for (int32_t lx = 0; lx < 16; ++lx) {
+        for (int32_t lz = 0; lz < 16; ++lz) {
+            int32_t surfaceY = ctx.heightmap[GenerationContext::hmIndex(lx, lz)];
+            writer.fillRun(lx, lz, minSurface + 1, surfaceY + 1, stoneId_);
         }
     }
+    PassCounters::current().blocksWritten += writer.blocksWritten();
 }
 
 // ============================================================================
 // SurfacePass
 // ============================================================================
 
-void SurfacePass::generate(GenerationContext& ctx) {
+SurfacePass::SurfacePass()
+    : stoneId_(BlockTypeId::fromName("stone"))
+{
+}
+
+std::shared_ptr<const SurfacePass::BlockTable> SurfacePass::blockTable() {
     const BiomeRegistry& registry = BiomeRegistry::global();
+    uint64_t generation = registry.generation();
+
+    std::lock_guard lock(tableMutex_);
+    if (table_ && tableGeneration_ == generation) {
+        return table_;
+    }
+
+    // A reload racing this rebuild bumps the generation again, so the next
+    // column rebuilds; columns already holding the old table finish with it
+    auto table = std::make_shared<BlockTable>();
+    for (BiomeId id : registry.allBiomes()) {
+        if (const BiomeProperties* props = registry.getBiome(id)) {
+            table->emplace(id, BiomeBlocks{props->surfaceBlockId, props->fillerBlockId,
+                                           props->stoneBlockId, props->fillerDepth});
+        }
+    }
+    table_ = std::move(table);
+    tableGeneration_ = generation;
+    return table_;
+}
+
+void SurfacePass::generate(GenerationContext& ctx) {
+    std::shared_ptr<const BlockTable> table = blockTable();
+    ColumnBulkWriter writer(ctx.column);
 
     for (int32_t lx = 0; lx < 16; ++lx) {
         for (int32_t lz = 0; lz < 16; ++lz) {
             int32_t idx = GenerationContext::hmIndex(lx, lz);
             int32_t surfaceY = ctx.heightmap[idx];
-            BiomeId biome = ctx.biomes[idx];
-
-            const BiomeProperties* props = registry.getBiome(biome);
-            if (!props) continue;
 
-            BlockTypeId surfaceBlock = BlockTypeId::fromName(props->surfaceBlock);
-            BlockTypeId fillerBlock = BlockTypeId::fromName(props->fillerBlock);
-            BlockTypeId stoneBlock = BlockTypeId::fromName(props->stoneBlock);
+            auto it = table->find(ctx.biomes[idx]);
+            if (it == table->end()) continue;
+            const BiomeBlocks& blocks = it->second;
 
             // Surface block at top
-            ctx.column.setBlock(lx, surfaceY, lz, surfaceBlock);
+            writer.setBlock(lx, surfaceY, lz, blocks.surface);
 
             // Filler layers below surface
-            for (int32_t d = 1; d <= props->fillerDepth && surfaceY - d >= 0; ++d) {
-                ctx.column.setBlock(lx, surfaceY - d, lz, fillerBlock);
-            }
+            int32_t fillerBottom = std::max(surfaceY - blocks.fillerDepth, 0);
+            writer.fillRun(lx, lz, fillerBottom, surfaceY, blocks.filler);
 
             // Stone layer below filler (if different from default stone)
-            if (stoneBlock != BlockTypeId::fromName("stone")) {
-                for (int32_t y = 0; y < surfaceY - props->fillerDepth; ++y) {
-                    ctx.column.setBlock(lx, y, lz, stoneBlock);
-                }
+            if (blocks.stone != stoneId_) {
+                writer.fillRun(lx, lz, 0, surfaceY - blocks.fillerDepth, blocks.stone);
             }
         }
     }
+    PassCounters::current().blocksWritten += writer.blocksWritten();
 }
 
 // ============================================================================
 // CavePass
 // ============================================================================
 
-CavePass::CavePass(uint64_t worldSeed) {
+CavePass::CavePass(uint64_t worldSeed, bool coarseSampling) {
     // Cheese caves: large, blobby open areas
     cheeseNoise_ = NoiseFactory::simplexFBM3D(
         NoiseHash::deriveSeed(worldSeed, 400), 3, 0.015f);
@@ -121,38 +175,82 @@ CavePass::CavePass(uint64_t worldSeed) {
     // Spaghetti caves: winding tunnels
     spaghettiNoise_ = NoiseFactory::simplexFBM3D(
         NoiseHash::deriveSeed(worldSeed, 500), 3, 0.025f);
+
+    if (coarseSampling) {
+        // Only the cheese field is smooth enough for the lattice. Spaghetti
+        // tunnels are a thin |noise| < 0.08 band whose top octave repeats
+        // every ~10 blocks; interpolating it moves ~20% of carved blocks.
+        cheeseSampler_ = std::make_unique<CoarseDensitySampler>(*cheeseNoise_);
+    }
 }
 
 void CavePass::generate(GenerationContext& ctx) {
     int32_t worldX = ctx.pos.x * 16;
     int32_t worldZ = ctx.pos.z * 16;
 
+    // Carving covers y = 1 .. surface - 3 (nothing within 2 blocks of the
+    // surface); sample both noises for the tallest run in the column
+    int32_t carveTop = 1;
+    for (int32_t surfaceY : ctx.heightmap) {
+        carveTop = std::max(carveTop, surfaceY - 2);
+    }
+    if (carveTop <= 1) {
+        return;
+    }
+    size_t height = static_cast<size_t>(carveTop - 1);
+
+    // Both noises in NoiseGrid3D column layout: [(lx * 16 + lz) * height + y - 1]
+    std::vector<float> cheese(256 * height);
+    std::vector<float> spaghetti(256 * height);
+    if (cheeseSampler_) {
+        cheeseSampler_->sampleColumn(ctx.pos, 1, carveTop, cheese);
+    }
+    for (int32_t lx = 0; lx < 16; ++lx) {
+        for (int32_t lz = 0; lz < 16; ++lz) {
+            int32_t maxCarveY = ctx.heightmap[GenerationContext::hmIndex(lx, lz)] - 2;
+            if (maxCarveY <= 1) continue;
+
+            // Only this block column's own run
+            NoiseGrid3D run;
+            run.x0 = static_cast<float>(worldX + lx);
+            run.y0 = 1.0f;
+            run.z0 = static_cast<float>(worldZ + lz);
+            run.countX = 1;
+            run.countY = maxCarveY - 1;
+            run.countZ = 1;
+            size_t offset = static_cast<size_t>(lx * 16 + lz) * height;
+            if (!cheeseSampler_) {
+                cheeseNoise_->evaluateGrid(run, std::span(cheese).subspan(offset, run.size()));
+            }
+            spaghettiNoise_->evaluateGrid(run, std::span(spaghetti).subspan(offset, run.size()));
+        }
+    }
+
+    ColumnBulkWriter writer(ctx.column);
     for (int32_t lx = 0; lx < 16; ++lx) {
         for (int32_t lz = 0; lz < 16; ++lz) {
             int32_t idx = GenerationContext::hmIndex(lx, lz);
             int32_t surfaceY = ctx.heightmap[idx];
 
-            float wx = static_cast<float>(worldX + lx);
-            float wz = static_cast<float>(worldZ + lz);
-
             // Don't carve above surface - 2
             int32_t maxCarveY = surfaceY - 2;
             if (maxCarveY < 1) continue;
 
-            for (int32_t y = 1; y < maxCarveY; ++y) {
-                float wy = static_cast<float>(y);
+            const float* cheeseRun = cheese.data() + static_cast<size_t>(lx * 16 + lz) * height;
+            const float* spaghettiRun = spaghetti.data() + static_cast<size_t>(lx * 16 + lz) * height;
+            int32_t carveStart = -1;
+            for (int32_t y = 1; y <= maxCarveY; ++y) {
+                size_t i = static_cast<size_t>(y - 1);
 
                 // Cheese caves: open when noise > threshold
-                float cheese = cheeseNoise_->evaluate(wx, wy, wz);
-                if (cheese > 0.5f) {
-                    ctx.column.setBlock(lx, y, lz, AIR_BLOCK_TYPE);
-                    continue;
-                }
-
                 // Spaghetti caves: open when |noise| is near zero
-                float spaghetti = spaghettiNoise_->evaluate(wx, wy, wz);
-                if (std::abs(spaghetti) < 0.08f) {
-                    ctx.column.setBlock(lx, y, lz, AIR_BLOCK_TYPE);
+                bool open = y < maxCarveY &&
+                            (cheeseRun[i] > 0.5f || std::abs(spaghettiRun[i]) < 0.08f);
+                if (open && carveStart < 0) {
+                    carveStart = y;
+                } else if (!open && carveStart >= 0) {
+                    writer.fillRun(lx, lz, carveStart, y, AIR_BLOCK_TYPE);
+                    carveStart = -1;
                 }
             }
 
@@ -166,6 +264,7 @@ void CavePass::generate(GenerationContext& ctx) {
             ctx.heightmap[idx] = newSurface;
         }
     }
+    PassCounters::current().blocksWritten += writer.blocksWritten();
 }
 
 // ============================================================================
@@ -184,6 +283,9 @@ void OrePass::generate(GenerationContext& ctx) {
         static_cast<uint64_t>(ctx.pos.x) * 341873128712ULL +
         static_cast<uint64_t>(ctx.pos.z) * 132897987541ULL + 4000);
 
+    BiomeId centerBiome = ctx.biomes[GenerationContext::hmIndex(8, 8)];
+    OreVeinBatch batch;
+
     for (const auto& placement : allPlacements) {
         Feature* feature = featureReg.getFeature(placement.featureName);
         if (!feature) continue;
@@ -195,7 +297,6 @@ void OrePass::generate(GenerationContext& ctx) {
         // Check biome filter
         if (!placement.biomes.empty()) {
             // Use center column biome for simplicity
-            BiomeId centerBiome = ctx.biomes[GenerationContext::hmIndex(8, 8)];
             bool matched = false;
             for (const auto& b : placement.biomes) {
                 if (b == centerBiome) { matched = true; break; }
@@ -205,7 +306,6 @@ void OrePass::generate(GenerationContext& ctx) {
 
         // Determine how many veins for this chunk
         // Use the OreConfig's veinsPerChunk as base, modulated by biome ore density
-        BiomeId centerBiome = ctx.biomes[GenerationContext::hmIndex(8, 8)];
         const BiomeProperties* biomeProps = BiomeRegistry::global().getBiome(centerBiome);
         float densityMul = biomeProps ? biomeProps->oreDensity : 1.0f;
 
@@ -233,9 +333,15 @@ void OrePass::generate(GenerationContext& ctx) {
                 static_cast<int32_t>((z >> 16) %
                     static_cast<uint64_t>(placement.maxHeight - placement.minHeight + 1));
 
+            BlockPos origin(worldX + lx, ly, worldZ + lz);
+            if (bulk_) {
+                batch.addVein(*oreFeature, origin, z);
+                continue;
+            }
+
             FeaturePlacementContext fctx{
                 ctx.world,
-                BlockPos(worldX + lx, ly, worldZ + lz),
+                origin,
                 centerBiome,
                 z,  // per-vein seed
                 &ctx
@@ -244,6 +350,11 @@ void OrePass::generate(GenerationContext& ctx) {
             (void)feature->place(fctx);
         }
     }
+
+    if (batch.size() > 0) {
+        FeaturePlacementContext fctx{ctx.world, BlockPos(worldX, 0, worldZ), centerBiome, oreSeed, &ctx};
+        (void)batch.apply(fctx);
+    }
 }
 
 // ============================================================================
@@ -0,0 +1,408 @@
+/**
+ * @file generation_scheduler.cpp
+ * @brief Multi-threaded column generation with neighbor dependencies
+ *
+ * Design: [27-world-generation.md] Section 27.7.1
+ */
+
+#include "finevox/worldgen/generation_scheduler.hpp"
+#include "finevox/core/chunk_column.hpp"
+#include "finevox/core/world.hpp"
+
+#include <algorithm>
+
+namespace finevox::worldgen {
+
+GenerationScheduler::GenerationScheduler(GenerationPipeline& pipeline, World& world,
+                                         const BiomeMap& biomeMap, size_t threads)
+    : pipeline_(pipeline)
+    , world_(world)
+    , biomeMap_(biomeMap)
+    , threadCount_(std::max<size_t>(threads, 1))
+{
+    for (size_t i = pipeline_.passCount(); i > 0; --i) {
+        if (pipeline_.pass(i - 1).needsNeighbors()) {
+            settledStage_ = i;
+            break;
+        }
+    }
+
+    pendingWrites_.setRouter([this](const FeatureWriteBuffer::Write& write) {
+        std::lock_guard lock(mutex_);
+        if (states_.contains(ColumnPos::fromBlock(write.pos).pack())) {
+            return false;
+        }
+        stats_.writesDropped.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    });
+}
+
+GenerationScheduler::~GenerationScheduler() {
+    stop();
+}
+
+void GenerationScheduler::start() {
+    if (running_.exchange(true)) {
+        return;
+    }
+    workers_.reserve(threadCount_);
+    for (size_t i = 0; i < threadCount_; ++i) {
+        workers_.emplace_back(&GenerationScheduler::workerLoop, this);
+    }
+}
+
+void GenerationScheduler::stop() {
+    {
+        std::lock_guard lock(mutex_);
+        if (!running_.exchange(false)) {
+            return;
+        }
+    }
+    workCv_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+}
+
+void GenerationScheduler::request(ColumnPos pos, ReadyCallback callback) {
+    std::vector<Notification> notify;
+    {
+        std::lock_guard lock(mutex_);
+        raiseTarget(pos, pipeline_.passCount());
+        if (settledStage_ > 0) {
+            for (int32_t dz = -1; dz <= 1; ++dz) {
+                for (int32_t dx = -1; dx <= 1; ++dx) {
+                    if (dx != 0 || dz != 0) {
+                        raiseTarget(ColumnPos{pos.x + dx, pos.z + dz}, settledStage_);
+                    }
+                }
+            }
+        }
+
+        auto& state = states_.at(pos.pack());
+        state.requested = true;
+        if (callback) {
+            if (state.ready) {
+                ++state.delivering;
+                notify.push_back({pos, state.column, std::move(callback)});
+            } else {
+                state.callbacks.push_back(std::move(callback));
+            }
+        }
+        checkReady(pos, notify);
+    }
+    workCv_.notify_all();
+    if (!notify.empty()) {
+        deliver(notify);
+        std::lock_guard lock(mutex_);
+        delivered(notify);
+    }
+}
+
+bool GenerationScheduler::forget(ColumnPos pos) {
+    std::lock_guard lock(mutex_);
+    return tryForget(pos);
+}
+
+void GenerationScheduler::deliver(std::vector<Notification>& notify) {
+    for (auto& n : notify) {
+        if (n.callback) {
+            n.callback(n.pos, *n.column);
+        } else {
+            pendingWrites_.flush(n.pos, *n.column);
+        }
+    }
+}
+
+void GenerationScheduler::waitIdle() {
+    std::unique_lock lock(mutex_);
+    idleCv_.wait(lock, [this] { return queue_.empty() && runningPasses_ == 0; });
+}
+
+bool GenerationScheduler::isReady(ColumnPos pos) const {
+    std::lock_guard lock(mutex_);
+    auto it = states_.find(pos.pack());
+    return it != states_.end() && it->second.ready;
+}
+
+size_t GenerationScheduler::completedPasses(ColumnPos pos) const {
+    std::lock_guard lock(mutex_);
+    auto it = states_.find(pos.pack());
+    return it != states_.end() ? it->second.stage : 0;
+}
+
+// ============================================================================
+// Worker
+// ============================================================================
+
+void GenerationScheduler::workerLoop() {
+    std::unique_lock lock(mutex_);
+    while (true) {
+        workCv_.wait(lock, [this] { return !running_ || !queue_.empty(); });
+        if (!running_) {
+            return;
+        }
+
+        ColumnPos pos = queue_.front();
+        queue_.pop_front();
+        auto it = states_.find(pos.pack());
+        if (it == states_.end()) {
+            // Forgotten while queued
+            if (queue_.empty() && runningPasses_ == 0) {
+                idleCv_.notify_all();
+            }
+            continue;
+        }
+        auto& state = it->second;
+        state.queued = false;
+
+        size_t passIndex = state.stage;
+        bool runnable = !state.busy && passIndex < state.target;
+        if (runnable && !neighborsAllow(pos, passIndex)) {
+            stats_.neighborWaits.fetch_add(1, std::memory_order_relaxed);
+            runnable = false;
+        }
+        if (!runnable) {
+            // Re-enqueued when a neighbor advances or releases its claim
+            if (queue_.empty() && runningPasses_ == 0) {
+                idleCv_.notify_all();
+            }
+            continue;
+        }
+
+        bool withNeighbors = pipeline_.pass(passIndex).needsNeighbors();
+        if (withNeighbors) {
+            setNeighborhoodBusy(pos, true);
+        } else {
+            state.busy = true;
+        }
+        ++runningPasses_;
+        GenerationContext* ctx = state.ctx.get();
+
+        lock.unlock();
+        pipeline_.runPass(passIndex, *ctx);
+        lock.lock();
+
+        stats_.passesRun.fetch_add(1, std::memory_order_relaxed);
+        ++state.stage;
+        if (withNeighbors) {
+            setNeighborhoodBusy(pos, false);
+        } else {
+            state.busy = false;
+        }
+        if (state.stage == pipeline_.passCount()) {
+            state.ctx.reset();
+        }
+
+        // Our progress or released claim can unblock neighbor passes up to
+        // two columns away (their 3x3 overlaps ours)
+        enqueueAround(pos, 2);
+        if (!queue_.empty()) {
+            workCv_.notify_all();
+        }
+
+        std::vector<Notification> notify;
+        for (int32_t dz = -1; dz <= 1; ++dz) {
+            for (int32_t dx = -1; dx <= 1; ++dx) {
+                checkReady(ColumnPos{pos.x + dx, pos.z + dz}, notify);
+            }
+        }
+        if (!notify.empty()) {
+            lock.unlock();
+            deliver(notify);
+            lock.lock();
+            delivered(notify);
+        }
+
+        // Still counted as running until the callbacks are done, so
+        // waitIdle() returns only after every ready callback fired
+        --runningPasses_;
+        if (queue_.empty() && runningPasses_ == 0) {
+            idleCv_.notify_all();
+        }
+    }
+}
+
+// ============================================================================
+// State (mutex_ held)
+// ============================================================================
+
+GenerationScheduler::ColumnState& GenerationScheduler::ensure(ColumnPos pos) {
+    ChunkColumn* column = world_.getColumn(pos);
+    auto existing = states_.find(pos.pack());
+    if (existing != states_.end()) {
+        // Removed from World without forget(): start over on what is there now
+        if (existing->second.column == column || !tryForget(pos)) {
+            return existing->second;
+        }
+    }
+
+    auto& state = states_[pos.pack()];
+    if (column) {
+        state.stage = pipeline_.nextPassIndex(column->generationStage(), column->generationStageRank());
+    } else {
+        column = &world_.getOrCreateColumn(pos);
+        column->setGenerationStage(ChunkColumn::GENERATION_NOT_STARTED);
+        state.stage = 0;
+    }
+    state.column = column;
+    state.target = state.stage;
+
+    if (state.stage < pipeline_.passCount()) {
+        state.ctx = std::make_unique<GenerationContext>(GenerationContext{
+            *column,
+            pos,
+            world_,
+            biomeMap_,
+            pipeline_.worldSeed(),
+            {},  // heightmap
+            {},  // biomes
+            &pendingWrites_,
+        });
+        if (state.stage > 0) {
+            pipeline_.restoreContext(*state.ctx);
+        }
+    }
+    return state;
+}
+
+bool GenerationScheduler::tryForget(ColumnPos pos) {
+    auto it = states_.find(pos.pack());
+    if (it == states_.end()) {
+        return true;
+    }
+    if (it->second.busy || it->second.delivering > 0) {
+        return false;
+    }
+    for (int32_t dz = -1; dz <= 1; ++dz) {
+        for (int32_t dx = -1; dx <= 1; ++dx) {
+            if (dx == 0 && dz == 0) {
+                continue;
+            }
+            auto nb = states_.find(ColumnPos{pos.x + dx, pos.z + dz}.pack());
+            if (nb != states_.end() &&
+                (nb->second.stage < nb->second.target || (nb->second.requested && !nb->second.ready))) {
+                return false;
+            }
+        }
+    }
+
+    // A queued entry left in queue_ is skipped by the worker
+    states_.erase(it);
+    pendingWrites_.discard(pos);
+    return true;
+}
+
+void GenerationScheduler::delivered(const std::vector<Notification>& notify) {
+    for (const auto& n : notify) {
+        auto it = states_.find(n.pos.pack());
+        if (it != states_.end()) {
+            --it->second.delivering;
+        }
+    }
+}
+
+void GenerationScheduler::raiseTarget(ColumnPos pos, size_t target) {
+    auto& state = ensure(pos);
+    if (target <= state.target) {
+        return;
+    }
+    state.target = target;
+
+    // The last pending neighbor pass below target needs the 3x3 to have
+    // finished everything before it; earlier neighbor passes need less
+    for (size_t i = target; i > state.stage; --i) {
+        size_t passIndex = i - 1;
+        if (pipeline_.pass(passIndex).needsNeighbors()) {
+            for (int32_t dz = -1; dz <= 1; ++dz) {
+                for (int32_t dx = -1; dx <= 1; ++dx) {
+                    if (dx != 0 || dz != 0) {
+                        raiseTarget(ColumnPos{pos.x + dx, pos.z + dz}, passIndex);
+                    }
+                }
+            }
+            break;
+        }
+    }
+    enqueue(pos);
+}
+
+void GenerationScheduler::enqueue(ColumnPos pos) {
+    auto it = states_.find(pos.pack());
+    if (it == states_.end()) {
+        return;
+    }
+    auto& state = it->second;
+    if (state.queued || state.stage >= state.target) {
+        return;
+    }
+    state.queued = true;
+    queue_.push_back(pos);
+}
+
+void GenerationScheduler::enqueueAround(ColumnPos pos, int32_t radius) {
+    for (int32_t dz = -radius; dz <= radius; ++dz) {
+        for (int32_t dx = -radius; dx <= radius; ++dx) {
+            enqueue(ColumnPos{pos.x + dx, pos.z + dz});
+        }
+    }
+}
+
+bool GenerationScheduler::neighborsAllow(ColumnPos pos, size_t passIndex) const {
+    if (!pipeline_.pass(passIndex).needsNeighbors()) {
+        return true;
+    }
+    for (int32_t dz = -1; dz <= 1; ++dz) {
+        for (int32_t dx = -1; dx <= 1; ++dx) {
+            if (dx == 0 && dz == 0) {
+                continue;
+            }
+            auto it = states_.find(ColumnPos{pos.x + dx, pos.z + dz}.pack());
+            if (it == states_.end() || it->second.busy || it->second.stage < passIndex) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void GenerationScheduler::setNeighborhoodBusy(ColumnPos pos, bool busy) {
+    for (int32_t dz = -1; dz <= 1; ++dz) {
+        for (int32_t dx = -1; dx <= 1; ++dx) {
+            states_.at(ColumnPos{pos.x + dx, pos.z + dz}.pack()).busy = busy;
+        }
+    }
+}
+
+void GenerationScheduler::checkReady(ColumnPos pos, std::vector<Notification>& notify) {
+    auto it = states_.find(pos.pack());
+    if (it == states_.end()) {
+        return;
+    }
+    auto& state = it->second;
+    if (!state.requested || state.ready || state.stage < pipeline_.passCount()) {
+        return;
+    }
+    if (settledStage_ > 0) {
+        for (int32_t dz = -1; dz <= 1; ++dz) {
+            for (int32_t dx = -1; dx <= 1; ++dx) {
+                auto nb = states_.find(ColumnPos{pos.x + dx, pos.z + dz}.pack());
+                if (nb == states_.end() || nb->second.stage < settledStage_) {
+                    return;
+                }
+            }
+        }
+    }
+
+    state.ready = true;
+    state.delivering += 1 + state.callbacks.size();
+    stats_.columnsReady.fetch_add(1, std::memory_order_relaxed);
+    notify.push_back({pos, state.column, nullptr});  // Flush before the callbacks
+    for (auto& callback : state.callbacks) {
+        notify.push_back({pos, state.column, std::move(callback)});
+    }
+    state.callbacks.clear();
+}
+
+}  // namespace finevox::worldgen
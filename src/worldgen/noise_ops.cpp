@@ -2,17 +2,39 @@
  * @file noise_ops.cpp
  * @brief Composable noise operations and convenience factories
  *
- * Design: [27-world-generation.md] Section 27.2.4, 27.2.5
+ * Design: [27-world-generation.md] Section 27.2.4, 27.2.5, 27.2.8
  */
 
 #include "finevox/worldgen/noise_ops.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <stdexcept>
 #include <utility>
 
 namespace finevox::worldgen {
 
+namespace {
+
+using Chunk = std::array<float, NOISE_BATCH_CHUNK>;
+
+/// Split a batch into NOISE_BATCH_CHUNK pieces so wrappers can keep their
+/// per-octave scratch on the stack: fn(offset, count)
+template <typename Fn>
+void forEachChunk(size_t total, Fn&& fn) {
+    for (size_t start = 0; start < total; start += NOISE_BATCH_CHUNK) {
+        fn(start, std::min(NOISE_BATCH_CHUNK, total - start));
+    }
+}
+
+/// First n elements of a scratch buffer
+std::span<float> head(Chunk& chunk, size_t n) {
+    return std::span(chunk.data(), n);
+}
+
+}  // namespace
+
 // ============================================================================
 // FBM (Fractal Brownian Motion)
 // ============================================================================
@@ -39,6 +61,36 @@ float FBMNoise2D::evaluate(float x, float z) const {
     return value / maxAmplitude;
 }
 
+void FBMNoise2D::evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                               std::span<float> out) const {
+    forEachChunk(out.size(), [&](size_t start, size_t n) {
+        Chunk sx, sz, octave;
+        std::span<float> value = out.subspan(start, n);
+        std::fill(value.begin(), value.end(), 0.0f);
+        float amplitude = 1.0f;
+        float frequency = 1.0f;
+        float maxAmplitude = 0.0f;
+
+        for (int o = 0; o < octaves_; ++o) {
+            for (size_t i = 0; i < n; ++i) {
+                sx[i] = xs[start + i] * frequency;
+                sz[i] = zs[start + i] * frequency;
+            }
+            base_->evaluateBatch(head(sx, n), head(sz, n), head(octave, n));
+            for (size_t i = 0; i < n; ++i) {
+                value[i] += octave[i] * amplitude;
+            }
+            maxAmplitude += amplitude;
+            amplitude *= persistence_;
+            frequency *= lacunarity_;
+        }
+
+        for (float& v : value) {
+            v /= maxAmplitude;
+        }
+    });
+}
+
 FBMNoise3D::FBMNoise3D(std::unique_ptr<Noise3D> base, int octaves,
                          float lacunarity, float persistence)
     : base_(std::move(base)), octaves_(octaves),
@@ -61,6 +113,37 @@ float FBMNoise3D::evaluate(float x, float y, float z) const {
     return value / maxAmplitude;
 }
 
+void FBMNoise3D::evaluateBatch(std::span<const float> xs, std::span<const float> ys,
+                               std::span<const float> zs, std::span<float> out) const {
+    forEachChunk(out.size(), [&](size_t start, size_t n) {
+        Chunk sx, sy, sz, octave;
+        std::span<float> value = out.subspan(start, n);
+        std::fill(value.begin(), value.end(), 0.0f);
+        float amplitude = 1.0f;
+        float frequency = 1.0f;
+        float maxAmplitude = 0.0f;
+
+        for (int o = 0; o < octaves_; ++o) {
+            for (size_t i = 0; i < n; ++i) {
+                sx[i] = xs[start + i] * frequency;
+                sy[i] = ys[start + i] * frequency;
+                sz[i] = zs[start + i] * frequency;
+            }
+            base_->evaluateBatch(head(sx, n), head(sy, n), head(sz, n), head(octave, n));
+            for (size_t i = 0; i < n; ++i) {
+                value[i] += octave[i] * amplitude;
+            }
+            maxAmplitude += amplitude;
+            amplitude *= persistence_;
+            frequency *= lacunarity_;
+        }
+
+        for (float& v : value) {
+            v /= maxAmplitude;
+        }
+    });
+}
+
 // ============================================================================
 // Ridged multi-fractal
 // ============================================================================
@@ -98,6 +181,37 @@ float RidgedNoise2D::evaluate(float x, float z) const {
     return value * 2.0f / maxValue_ - 1.0f;
 }
 
+void RidgedNoise2D::evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                                  std::span<float> out) const {
+    forEachChunk(out.size(), [&](size_t start, size_t n) {
+        Chunk sx, sz, signal, weight;
+        std::span<float> value = out.subspan(start, n);
+        std::fill(value.begin(), value.end(), 0.0f);
+        std::fill_n(weight.begin(), n, 1.0f);
+        float frequency = 1.0f;
+
+        for (int o = 0; o < octaves_; ++o) {
+            for (size_t i = 0; i < n; ++i) {
+                sx[i] = xs[start + i] * frequency;
+                sz[i] = zs[start + i] * frequency;
+            }
+            base_->evaluateBatch(head(sx, n), head(sz, n), head(signal, n));
+            for (size_t i = 0; i < n; ++i) {
+                float sig = 1.0f - std::abs(signal[i]);
+                sig *= sig;
+                sig *= weight[i];
+                weight[i] = std::clamp(sig * gain_, 0.0f, 1.0f);
+                value[i] += sig;
+            }
+            frequency *= lacunarity_;
+        }
+
+        for (float& v : value) {
+            v = v * 2.0f / maxValue_ - 1.0f;
+        }
+    });
+}
+
 RidgedNoise3D::RidgedNoise3D(std::unique_ptr<Noise3D> base, int octaves,
                                float lacunarity, float gain)
     : base_(std::move(base)), octaves_(octaves),
@@ -129,6 +243,38 @@ float RidgedNoise3D::evaluate(float x, float y, float z) const {
     return value * 2.0f / maxValue_ - 1.0f;
 }
 
+void RidgedNoise3D::evaluateBatch(std::span<const float> xs, std::span<const float> ys,
+                                  std::span<const float> zs, std::span<float> out) const {
+    forEachChunk(out.size(), [&](size_t start, size_t n) {
+        Chunk sx, sy, sz, signal, weight;
+        std::span<float> value = out.subspan(start, n);
+        std::fill(value.begin(), value.end(), 0.0f);
+        std::fill_n(weight.begin(), n, 1.0f);
+        float frequency = 1.0f;
+
+        for (int o = 0; o < octaves_; ++o) {
+            for (size_t i = 0; i < n; ++i) {
+                sx[i] = xs[start + i] * frequency;
+                sy[i] = ys[start + i] * frequency;
+                sz[i] = zs[start + i] * frequency;
+            }
+            base_->evaluateBatch(head(sx, n), head(sy, n), head(sz, n), head(signal, n));
+            for (size_t i = 0; i < n; ++i) {
+                float sig = 1.0f - std::abs(signal[i]);
+                sig *= sig;
+                sig *= weight[i];
+                weight[i] = std::clamp(sig * gain_, 0.0f, 1.0f);
+                value[i] += sig;
+            }
+            frequency *= lacunarity_;
+        }
+
+        for (float& v : value) {
+            v = v * 2.0f / maxValue_ - 1.0f;
+        }
+    });
+}
+
 // ============================================================================
 // Billow noise
 // ============================================================================
@@ -157,6 +303,36 @@ float BillowNoise2D::evaluate(float x, float z) const {
     return (value / maxAmplitude) * 2.0f - 1.0f;
 }
 
+void BillowNoise2D::evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                                  std::span<float> out) const {
+    forEachChunk(out.size(), [&](size_t start, size_t n) {
+        Chunk sx, sz, octave;
+        std::span<float> value = out.subspan(start, n);
+        std::fill(value.begin(), value.end(), 0.0f);
+        float amplitude = 1.0f;
+        float frequency = 1.0f;
+        float maxAmplitude = 0.0f;
+
+        for (int o = 0; o < octaves_; ++o) {
+            for (size_t i = 0; i < n; ++i) {
+                sx[i] = xs[start + i] * frequency;
+                sz[i] = zs[start + i] * frequency;
+            }
+            base_->evaluateBatch(head(sx, n), head(sz, n), head(octave, n));
+            for (size_t i = 0; i < n; ++i) {
+                value[i] += std::abs(octave[i]) * amplitude;
+            }
+            maxAmplitude += amplitude;
+            amplitude *= persistence_;
+            frequency *= lacunarity_;
+        }
+
+        for (float& v : value) {
+            v = (v / maxAmplitude) * 2.0f - 1.0f;
+        }
+    });
+}
+
 BillowNoise3D::BillowNoise3D(std::unique_ptr<Noise3D> base, int octaves,
                                float lacunarity, float persistence)
     : base_(std::move(base)), octaves_(octaves),
@@ -180,6 +356,37 @@ float BillowNoise3D::evaluate(float x, float y, float z) const {
     return (value / maxAmplitude) * 2.0f - 1.0f;
 }
 
+void BillowNoise3D::evaluateBatch(std::span<const float> xs, std::span<const float> ys,
+                                  std::span<const float> zs, std::span<float> out) const {
+    forEachChunk(out.size(), [&](size_t start, size_t n) {
+        Chunk sx, sy, sz, octave;
+        std::span<float> value = out.subspan(start, n);
+        std::fill(value.begin(), value.end(), 0.0f);
+        float amplitude = 1.0f;
+        float frequency = 1.0f;
+        float maxAmplitude = 0.0f;
+
+        for (int o = 0; o < octaves_; ++o) {
+            for (size_t i = 0; i < n; ++i) {
+                sx[i] = xs[start + i] * frequency;
+                sy[i] = ys[start + i] * frequency;
+                sz[i] = zs[start + i] * frequency;
+            }
+            base_->evaluateBatch(head(sx, n), head(sy, n), head(sz, n), head(octave, n));
+            for (size_t i = 0; i < n; ++i) {
+                value[i] += std::abs(octave[i]) * amplitude;
+            }
+            maxAmplitude += amplitude;
+            amplitude *= persistence_;
+            frequency *= lacunarity_;
+        }
+
+        for (float& v : value) {
+            v = (v / maxAmplitude) * 2.0f - 1.0f;
+        }
+    });
+}
+
 // ============================================================================
 // Domain warping
 // ============================================================================
@@ -198,6 +405,22 @@ float DomainWarp2D::evaluate(float x, float z) const {
     return source_->evaluate(x + wx, z + wz);
 }
 
+void DomainWarp2D::evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                                 std::span<float> out) const {
+    forEachChunk(out.size(), [&](size_t start, size_t n) {
+        Chunk wx, wz;
+        auto px = xs.subspan(start, n);
+        auto pz = zs.subspan(start, n);
+        warpX_->evaluateBatch(px, pz, head(wx, n));
+        warpZ_->evaluateBatch(px, pz, head(wz, n));
+        for (size_t i = 0; i < n; ++i) {
+            wx[i] = px[i] + wx[i] * warpStrength_;
+            wz[i] = pz[i] + wz[i] * warpStrength_;
+        }
+        source_->evaluateBatch(head(wx, n), head(wz, n), out.subspan(start, n));
+    });
+}
+
 DomainWarp3D::DomainWarp3D(std::unique_ptr<Noise3D> source,
                              std::unique_ptr<Noise3D> warpX,
                              std::unique_ptr<Noise3D> warpY,
@@ -215,6 +438,25 @@ float DomainWarp3D::evaluate(float x, float y, float z) const {
     return source_->evaluate(x + wx, y + wy, z + wz);
 }
 
+void DomainWarp3D::evaluateBatch(std::span<const float> xs, std::span<const float> ys,
+                                 std::span<const float> zs, std::span<float> out) const {
+    forEachChunk(out.size(), [&](size_t start, size_t n) {
+        Chunk wx, wy, wz;
+        auto px = xs.subspan(start, n);
+        auto py = ys.subspan(start, n);
+        auto pz = zs.subspan(start, n);
+        warpX_->evaluateBatch(px, py, pz, head(wx, n));
+        warpY_->evaluateBatch(px, py, pz, head(wy, n));
+        warpZ_->evaluateBatch(px, py, pz, head(wz, n));
+        for (size_t i = 0; i < n; ++i) {
+            wx[i] = px[i] + wx[i] * warpStrength_;
+            wy[i] = py[i] + wy[i] * warpStrength_;
+            wz[i] = pz[i] + wz[i] * warpStrength_;
+        }
+        source_->evaluateBatch(head(wx, n), head(wy, n), head(wz, n), out.subspan(start, n));
+    });
+}
+
 // ============================================================================
 // Utility adapters
 // ============================================================================
@@ -230,6 +472,22 @@ float ScaledNoise2D::evaluate(float x, float z) const {
     return source_->evaluate(x * freqX_, z * freqZ_) * amplitude_ + offset_;
 }
 
+void ScaledNoise2D::evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                                  std::span<float> out) const {
+    forEachChunk(out.size(), [&](size_t start, size_t n) {
+        Chunk sx, sz;
+        for (size_t i = 0; i < n; ++i) {
+            sx[i] = xs[start + i] * freqX_;
+            sz[i] = zs[start + i] * freqZ_;
+        }
+        std::span<float> value = out.subspan(start, n);
+        source_->evaluateBatch(head(sx, n), head(sz, n), value);
+        for (float& v : value) {
+            v = v * amplitude_ + offset_;
+        }
+    });
+}
+
 ScaledNoise3D::ScaledNoise3D(std::unique_ptr<Noise3D> source,
                                float frequencyX, float frequencyY, float frequencyZ,
                                float amplitude, float offset)
@@ -241,6 +499,23 @@ float ScaledNoise3D::evaluate(float x, float y, float z) const {
     return source_->evaluate(x * freqX_, y * freqY_, z * freqZ_) * amplitude_ + offset_;
 }
 
+void ScaledNoise3D::evaluateBatch(std::span<const float> xs, std::span<const float> ys,
+                                  std::span<const float> zs, std::span<float> out) const {
+    forEachChunk(out.size(), [&](size_t start, size_t n) {
+        Chunk sx, sy, sz;
+        for (size_t i = 0; i < n; ++i) {
+            sx[i] = xs[start + i] * freqX_;
+            sy[i] = ys[start + i] * freqY_;
+            sz[i] = zs[start + i] * freqZ_;
+        }
+        std::span<float> value = out.subspan(start, n);
+        source_->evaluateBatch(head(sx, n), head(sy, n), head(sz, n), value);
+        for (float& v : value) {
+            v = v * amplitude_ + offset_;
+        }
+    });
+}
+
 ClampedNoise2D::ClampedNoise2D(std::unique_ptr<Noise2D> source,
                                  float minVal, float maxVal)
     : source_(std::move(source)), minVal_(minVal), maxVal_(maxVal) {
@@ -250,6 +525,14 @@ float ClampedNoise2D::evaluate(float x, float z) const {
     return std::clamp(source_->evaluate(x, z), minVal_, maxVal_);
 }
 
+void ClampedNoise2D::evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                                   std::span<float> out) const {
+    source_->evaluateBatch(xs, zs, out);
+    for (float& v : out) {
+        v = std::clamp(v, minVal_, maxVal_);
+    }
+}
+
 CombinedNoise2D::CombinedNoise2D(std::unique_ptr<Noise2D> a,
                                    std::unique_ptr<Noise2D> b,
                                    CombineOp op, float blendFactor)
@@ -270,6 +553,34 @@ float CombinedNoise2D::evaluate(float x, float z) const {
     return va;  // unreachable
 }
 
+void CombinedNoise2D::evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                                    std::span<float> out) const {
+    forEachChunk(out.size(), [&](size_t start, size_t n) {
+        Chunk vb;
+        std::span<float> va = out.subspan(start, n);
+        a_->evaluateBatch(xs.subspan(start, n), zs.subspan(start, n), va);
+        b_->evaluateBatch(xs.subspan(start, n), zs.subspan(start, n), head(vb, n));
+
+        switch (op_) {
+            case CombineOp::Add:
+                for (size_t i = 0; i < n; ++i) va[i] = va[i] + vb[i];
+                break;
+            case CombineOp::Multiply:
+                for (size_t i = 0; i < n; ++i) va[i] = va[i] * vb[i];
+                break;
+            case CombineOp::Min:
+                for (size_t i = 0; i < n; ++i) va[i] = std::min(va[i], vb[i]);
+                break;
+            case CombineOp::Max:
+                for (size_t i = 0; i < n; ++i) va[i] = std::max(va[i], vb[i]);
+                break;
+            case CombineOp::Lerp:
+                for (size_t i = 0; i < n; ++i) va[i] = va[i] + blendFactor_ * (vb[i] - va[i]);
+                break;
+        }
+    });
+}
+
 MappedNoise2D::MappedNoise2D(std::unique_ptr<Noise2D> source,
                                std::function<float(float)> mapFunc)
     : source_(std::move(source)), mapFunc_(std::move(mapFunc)) {
@@ -279,6 +590,184 @@ float MappedNoise2D::evaluate(float x, float z) const {
     return mapFunc_(source_->evaluate(x, z));
 }
 
+void MappedNoise2D::evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                                  std::span<float> out) const {
+    source_->evaluateBatch(xs, zs, out);
+    for (float& v : out) {
+        v = mapFunc_(v);
+    }
+}
+
+// ============================================================================
+// CoarseDensitySampler
+// ============================================================================
+
+namespace {
+
+int32_t floorDiv(int32_t a, int32_t b) {
+    int32_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+uint64_t postKey(int32_t gx, int32_t gz) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(gx)) << 32) |
+           static_cast<uint32_t>(gz);
+}
+
+}  // namespace
+
+CoarseDensitySampler::CoarseDensitySampler(const Noise3D& source, int32_t cellXZ,
+                                           int32_t cellY, size_t cachedPosts)
+    : source_(source)
+    , cellXZ_(cellXZ)
+    , cellY_(cellY)
+    , posts_(std::max<size_t>(cachedPosts, 1))
+{
+    if (cellXZ <= 0 || 16 % cellXZ != 0 || cellY <= 0) {
+        throw std::invalid_argument("CoarseDensitySampler: cellXZ must divide 16 and cellY must be positive");
+    }
+}
+
+void CoarseDensitySampler::evaluatePost(int32_t gx, int32_t gz, int32_t lo, int32_t hi,
+                                        float* out) {
+    NoiseGrid3D grid;
+    grid.x0 = static_cast<float>(gx * cellXZ_);
+    grid.y0 = static_cast<float>(lo * cellY_);
+    grid.z0 = static_cast<float>(gz * cellXZ_);
+    grid.stepY = static_cast<float>(cellY_);
+    grid.countX = 1;
+    grid.countY = hi - lo + 1;
+    grid.countZ = 1;
+    source_.evaluateGrid(grid, std::span(out, grid.size()));
+    stats_.samplesEvaluated.fetch_add(grid.size(), std::memory_order_relaxed);
+}
+
+void CoarseDensitySampler::sampleColumn(ColumnPos pos, int32_t minY, int32_t maxY,
+                                        std::span<float> out) {
+    if (maxY <= minY) {
+        return;
+    }
+
+    // Lattice levels covering [minY, maxY), including the level above the
+    // top block so it has an upper corner to interpolate toward
+    int32_t levelLo = floorDiv(minY, cellY_);
+    int32_t levelHi = floorDiv(maxY - 1, cellY_) + 1;
+    size_t levels = static_cast<size_t>(levelHi - levelLo + 1);
+
+    int32_t cells = 16 / cellXZ_;
+    int32_t postsPerAxis = cells + 1;
+    int32_t gx0 = pos.x * cells;
+    int32_t gz0 = pos.z * cells;
+    auto postData = [&](std::vector<float>& lattice, int32_t px, int32_t pz) {
+        return lattice.data() + static_cast<size_t>(px * postsPerAxis + pz) * levels;
+    };
+
+    // lattice[(px * postsPerAxis + pz) * levels + (level - levelLo)]
+    std::vector<float> lattice(static_cast<size_t>(postsPerAxis * postsPerAxis) * levels);
+    std::vector<std::pair<int32_t, int32_t>> missing;
+
+    {
+        std::lock_guard lock(mutex_);
+        for (int32_t px = 0; px < postsPerAxis; ++px) {
+            for (int32_t pz = 0; pz < postsPerAxis; ++pz) {
+                uint64_t key = postKey(gx0 + px, gz0 + pz);
+                const Post* post = posts_.peek(key);
+                if (!post || post->firstLevel > levelLo ||
+                    post->firstLevel + static_cast<int32_t>(post->values.size()) <= levelHi) {
+                    missing.emplace_back(px, pz);
+                    continue;
+                }
+                std::copy_n(post->values.begin() + (levelLo - post->firstLevel), levels,
+                            postData(lattice, px, pz));
+                posts_.touch(key);
+            }
+        }
+    }
+    stats_.postsReused.fetch_add(
+        static_cast<uint64_t>(postsPerAxis * postsPerAxis) - missing.size(),
+        std::memory_order_relaxed);
+    if (!missing.empty()) {
+        stats_.postsComputed.fetch_add(missing.size(), std::memory_order_relaxed);
+    }
+
+    // Evaluate missing posts outside the lock. A neighbor running at the same
+    // time may compute the same post; the results are identical.
+    for (auto [px, pz] : missing) {
+        evaluatePost(gx0 + px, gz0 + pz, levelLo, levelHi, postData(lattice, px, pz));
+    }
+
+    if (!missing.empty()) {
+        std::lock_guard lock(mutex_);
+        for (auto [px, pz] : missing) {
+            uint64_t key = postKey(gx0 + px, gz0 + pz);
+
+            // Keep levels a cached post already has outside our range, as
+            // long as the two ranges touch so the post stays contiguous
+            int32_t lo = levelLo;
+            int32_t hi = levelHi;
+            const Post* old = posts_.peek(key);
+            if (old) {
+                int32_t oldHi = old->firstLevel + static_cast<int32_t>(old->values.size()) - 1;
+                if (old->firstLevel > levelHi + 1 || oldHi < levelLo - 1) {
+                    old = nullptr;
+                } else {
+                    lo = std::min(lo, old->firstLevel);
+                    hi = std::max(hi, oldHi);
+                }
+            }
+
+            Post merged;
+            merged.firstLevel = lo;
+            merged.values.resize(static_cast<size_t>(hi - lo + 1));
+            if (old) {
+                std::copy(old->values.begin(), old->values.end(),
+                          merged.values.begin() + (old->firstLevel - lo));
+            }
+            std::copy_n(postData(lattice, px, pz), levels, merged.values.begin() + (levelLo - lo));
+            posts_.put(key, std::move(merged));
+        }
+    }
+
+    // Trilinear interpolation. At lattice points the weights are 0, so those
+    // blocks get the source value unchanged.
+    size_t height = static_cast<size_t>(maxY - minY);
+    float invXZ = 1.0f / static_cast<float>(cellXZ_);
+    float invY = 1.0f / static_cast<float>(cellY_);
+    for (int32_t lx = 0; lx < 16; ++lx) {
+        int32_t px = lx / cellXZ_;
+        float tx = static_cast<float>(lx - px * cellXZ_) * invXZ;
+        for (int32_t lz = 0; lz < 16; ++lz) {
+            int32_t pz = lz / cellXZ_;
+            float tz = static_cast<float>(lz - pz * cellXZ_) * invXZ;
+            const float* p00 = postData(lattice, px, pz);
+            const float* p01 = postData(lattice, px, pz + 1);
+            const float* p10 = postData(lattice, px + 1, pz);
+            const float* p11 = postData(lattice, px + 1, pz + 1);
+
+            // Bilinear within one lattice level
+            auto plane = [&](size_t k) {
+                float a = p00[k] + tz * (p01[k] - p00[k]);
+                float b = p10[k] + tz * (p11[k] - p10[k]);
+                return a + tx * (b - a);
+            };
+
+            float* dst = out.data() + static_cast<size_t>(lx * 16 + lz) * height;
+            int32_t level = floorDiv(minY, cellY_);
+            float lower = plane(static_cast<size_t>(level - levelLo));
+            float upper = plane(static_cast<size_t>(level - levelLo + 1));
+            for (int32_t y = minY; y < maxY; ++y) {
+                if (y >= (level + 1) * cellY_) {
+                    ++level;
+                    lower = upper;
+                    upper = plane(static_cast<size_t>(level - levelLo + 1));
+                }
+                float ty = static_cast<float>(y - level * cellY_) * invY;
+                dst[y - minY] = lower + ty * (upper - lower);
+            }
+        }
+    }
+}
+
 // ============================================================================
 // NoiseFactory convenience functions
 // ============================================================================
@@ -7,6 +7,8 @@
  */
 
 #include "finevox/worldgen/noise.hpp"
+#include "finevox/worldgen/noise_simd.hpp"
+#include "finevox/worldgen/pass_counters.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -51,6 +53,76 @@ uint64_t NoiseHash::deriveSeed(uint64_t baseSeed, uint64_t salt) {
     return h;
 }
 
+// ============================================================================
+// Noise2D / Noise3D batch defaults
+// ============================================================================
+
+void Noise2D::evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                            std::span<float> out) const {
+    for (size_t i = 0; i < out.size(); ++i) {
+        out[i] = evaluate(xs[i], zs[i]);
+    }
+}
+
+void Noise2D::evaluateGrid(const NoiseGrid2D& grid, std::span<float> out) const {
+    PassCounters::current().noiseSamples += grid.size();
+    std::array<float, NOISE_BATCH_CHUNK> xs;
+    std::array<float, NOISE_BATCH_CHUNK> zs;
+    size_t total = grid.size();
+
+    // Walk the grid with counters rather than dividing every index
+    int32_t ix = 0;
+    int32_t iz = 0;
+    for (size_t start = 0; start < total; start += NOISE_BATCH_CHUNK) {
+        size_t n = std::min(NOISE_BATCH_CHUNK, total - start);
+        for (size_t i = 0; i < n; ++i) {
+            xs[i] = grid.x0 + static_cast<float>(ix) * grid.stepX;
+            zs[i] = grid.z0 + static_cast<float>(iz) * grid.stepZ;
+            if (++iz == grid.countZ) {
+                iz = 0;
+                ++ix;
+            }
+        }
+        evaluateBatch(std::span(xs.data(), n), std::span(zs.data(), n), out.subspan(start, n));
+    }
+}
+
+void Noise3D::evaluateBatch(std::span<const float> xs, std::span<const float> ys,
+                            std::span<const float> zs, std::span<float> out) const {
+    for (size_t i = 0; i < out.size(); ++i) {
+        out[i] = evaluate(xs[i], ys[i], zs[i]);
+    }
+}
+
+void Noise3D::evaluateGrid(const NoiseGrid3D& grid, std::span<float> out) const {
+    PassCounters::current().noiseSamples += grid.size();
+    std::array<float, NOISE_BATCH_CHUNK> xs;
+    std::array<float, NOISE_BATCH_CHUNK> ys;
+    std::array<float, NOISE_BATCH_CHUNK> zs;
+    size_t total = grid.size();
+
+    int32_t ix = 0;
+    int32_t iy = 0;
+    int32_t iz = 0;
+    for (size_t start = 0; start < total; start += NOISE_BATCH_CHUNK) {
+        size_t n = std::min(NOISE_BATCH_CHUNK, total - start);
+        for (size_t i = 0; i < n; ++i) {
+            xs[i] = grid.x0 + static_cast<float>(ix) * grid.stepX;
+            ys[i] = grid.y0 + static_cast<float>(iy) * grid.stepY;
+            zs[i] = grid.z0 + static_cast<float>(iz) * grid.stepZ;
+            if (++iy == grid.countY) {
+                iy = 0;
+                if (++iz == grid.countZ) {
+                    iz = 0;
+                    ++ix;
+                }
+            }
+        }
+        evaluateBatch(std::span(xs.data(), n), std::span(ys.data(), n),
+                      std::span(zs.data(), n), out.subspan(start, n));
+    }
+}
+
 // ============================================================================
 // Perlin helper functions
 // ============================================================================
@@ -91,6 +163,29 @@ void shufflePermutation(std::array<uint8_t, 512>& perm, uint64_t seed) {
     }
 }
 
+/// Gradient of grad(hash, x, y, z) as a {-1, 0, 1} vector, so the lane
+/// kernels can compute it as a dot product (one of the three terms is 0)
+struct PerlinGrad3 {
+    float x, y, z;
+};
+
+constexpr std::array<PerlinGrad3, 16> makePerlinGrad3() {
+    std::array<PerlinGrad3, 16> table{};
+    for (int h = 0; h < 16; ++h) {
+        float gu = (h & 1) == 0 ? 1.0f : -1.0f;
+        float gv = (h & 2) == 0 ? 1.0f : -1.0f;
+        PerlinGrad3 g{0.0f, 0.0f, 0.0f};
+        // u = h < 8 ? x : y
+        (h < 8 ? g.x : g.y) = gu;
+        // v = h < 4 ? y : (h == 12 || h == 14 ? x : z)
+        (h < 4 ? g.y : (h == 12 || h == 14 ? g.x : g.z)) = gv;
+        table[static_cast<size_t>(h)] = g;
+    }
+    return table;
+}
+
+constexpr std::array<PerlinGrad3, 16> PERLIN_GRAD3 = makePerlinGrad3();
+
 }  // namespace
 
 // ============================================================================
@@ -143,6 +238,53 @@ float PerlinNoise2D::evaluate(float x, float z) const {
     return lerp(v, x1, x2);
 }
 
+void PerlinNoise2D::evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                                  std::span<float> out) const {
+    using simd::Float4;
+    using simd::LANES;
+
+    simd::forEachLaneGroup<2>({xs.data(), zs.data()}, out.data(), out.size(),
+        [this](const std::array<const float*, 2>& in, float* result) {
+            // Cells and offsets in lanes
+            std::array<int, LANES> xi, zi;
+            Float4 x0 = Float4::load(in[0]);
+            Float4 z0 = Float4::load(in[1]);
+            x0 = x0 - simd::floorLanes(x0, xi.data());
+            z0 = z0 - simd::floorLanes(z0, zi.data());
+
+            // Scalar: corner gradients per lane (aa, ab, ba, bb)
+            std::array<std::array<float, LANES>, 4> gx, gz;
+            for (size_t l = 0; l < LANES; ++l) {
+                int x = xi[l] & 255;
+                int z = zi[l] & 255;
+                std::array<int, 4> hashes = {
+                    perm_[static_cast<size_t>(perm_[static_cast<size_t>(x)] + z)],
+                    perm_[static_cast<size_t>(perm_[static_cast<size_t>(x)] + z + 1)],
+                    perm_[static_cast<size_t>(perm_[static_cast<size_t>(x + 1)] + z)],
+                    perm_[static_cast<size_t>(perm_[static_cast<size_t>(x + 1)] + z + 1)],
+                };
+                for (size_t c = 0; c < 4; ++c) {
+                    // grad(): (h & 2 ? -x : x) + (h & 1 ? -z : z)
+                    gx[c][l] = (hashes[c] & 2) == 0 ? 1.0f : -1.0f;
+                    gz[c][l] = (hashes[c] & 1) == 0 ? 1.0f : -1.0f;
+                }
+            }
+
+            Float4 one = Float4::splat(1.0f);
+            Float4 x1 = x0 - one;
+            Float4 z1 = z0 - one;
+            auto dot = [&](size_t c, Float4 dx, Float4 dz) {
+                return Float4::load(gx[c].data()) * dx + Float4::load(gz[c].data()) * dz;
+            };
+
+            Float4 u = simd::fade(x0);
+            Float4 v = simd::fade(z0);
+            Float4 a = simd::lerp(u, dot(0, x0, z0), dot(2, x1, z0));
+            Float4 b = simd::lerp(u, dot(1, x0, z1), dot(3, x1, z1));
+            simd::lerp(v, a, b).store(result);
+        });
+}
+
 // ============================================================================
 // PerlinNoise3D
 // ============================================================================
@@ -212,4 +354,62 @@ float PerlinNoise3D::evaluate(float x, float y, float z) const {
     return lerp(w, y1, y2);
 }
 
+void PerlinNoise3D::evaluateBatch(std::span<const float> xs, std::span<const float> ys,
+                                  std::span<const float> zs, std::span<float> out) const {
+    using simd::Float4;
+    using simd::LANES;
+
+    simd::forEachLaneGroup<3>({xs.data(), ys.data(), zs.data()}, out.data(), out.size(),
+        [this](const std::array<const float*, 3>& in, float* result) {
+            // Cells and offsets in lanes
+            std::array<int, LANES> xi, yi, zi;
+            Float4 one = Float4::splat(1.0f);
+            Float4 x0 = Float4::load(in[0]);
+            Float4 y0 = Float4::load(in[1]);
+            Float4 z0 = Float4::load(in[2]);
+            x0 = x0 - simd::floorLanes(x0, xi.data());
+            y0 = y0 - simd::floorLanes(y0, yi.data());
+            z0 = z0 - simd::floorLanes(z0, zi.data());
+
+            // Scalar: the 8 corner gradients per lane. Corner c has
+            // bit 2 = x+1, bit 1 = y+1, bit 0 = z+1.
+            std::array<std::array<float, LANES>, 8> gx, gy, gz;
+            for (size_t l = 0; l < LANES; ++l) {
+                int x = xi[l] & 255;
+                int y = yi[l] & 255;
+                int z = zi[l] & 255;
+                int a  = perm_[static_cast<size_t>(x)] + y;
+                int aa = perm_[static_cast<size_t>(a)] + z;
+                int ab = perm_[static_cast<size_t>(a + 1)] + z;
+                int b  = perm_[static_cast<size_t>(x + 1)] + y;
+                int ba = perm_[static_cast<size_t>(b)] + z;
+                int bb = perm_[static_cast<size_t>(b + 1)] + z;
+
+                std::array<int, 8> corners = {aa, aa + 1, ab, ab + 1, ba, ba + 1, bb, bb + 1};
+                for (size_t c = 0; c < 8; ++c) {
+                    const auto& g = PERLIN_GRAD3[perm_[static_cast<size_t>(corners[c])] & 15];
+                    gx[c][l] = g.x;
+                    gy[c][l] = g.y;
+                    gz[c][l] = g.z;
+                }
+            }
+
+            std::array<Float4, 2> dx = {x0, x0 - one};
+            std::array<Float4, 2> dy = {y0, y0 - one};
+            std::array<Float4, 2> dz = {z0, z0 - one};
+            auto dot = [&](size_t c) {
+                return Float4::load(gx[c].data()) * dx[c >> 2] +
+                       Float4::load(gy[c].data()) * dy[(c >> 1) & 1] +
+                       Float4::load(gz[c].data()) * dz[c & 1];
+            };
+
+            Float4 u = simd::fade(dx[0]);
+            Float4 v = simd::fade(dy[0]);
+            Float4 w = simd::fade(dz[0]);
+            Float4 y1 = simd::lerp(v, simd::lerp(u, dot(0), dot(4)), simd::lerp(u, dot(2), dot(6)));
+            Float4 y2 = simd::lerp(v, simd::lerp(u, dot(1), dot(5)), simd::lerp(u, dot(3), dot(7)));
+            simd::lerp(w, y1, y2).store(result);
+        });
+}
+
 }  // namespace finevox::worldgen
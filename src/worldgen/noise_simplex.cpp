@@ -8,6 +8,7 @@
  */
 
 #include "finevox/worldgen/noise.hpp"
+#include "finevox/worldgen/noise_simd.hpp"
 
 #include <cmath>
 
@@ -245,6 +246,81 @@ float OpenSimplex2D::evaluate(float x, float z) const {
     return value * 18.24196194486065f;
 }
 
+void OpenSimplex2D::evaluateBatch(std::span<const float> xs, std::span<const float> zs,
+                                  std::span<float> out) const {
+    using simd::Float4;
+    using simd::LANES;
+    constexpr size_t VERTICES = 6;
+
+    simd::forEachLaneGroup<2>({xs.data(), zs.data()}, out.data(), out.size(),
+        [this](const std::array<const float*, 2>& in, float* result) {
+            // Scalar setup: pick the 6 vertices (same order as evaluate())
+            // and fetch their gradients; the contributions run in lanes
+            std::array<std::array<float, LANES>, VERTICES> dxs, dzs, gxs, gzs;
+            for (size_t l = 0; l < LANES; ++l) {
+                float x = in[0][l];
+                float z = in[1][l];
+                float s = SKEW_2D * (x + z);
+                float xsk = x + s;
+                float zsk = z + s;
+                int xsb = fastFloor(xsk);
+                int zsb = fastFloor(zsk);
+                float xsi = xsk - static_cast<float>(xsb);
+                float zsi = zsk - static_cast<float>(zsb);
+                float t = (xsi + zsi) * UNSKEW_2D;
+                float dx0 = xsi - t;
+                float dz0 = zsi - t;
+
+                size_t vertex = 0;
+                auto add = [&](int xsv, int zsv, float dx, float dz) {
+                    dxs[vertex][l] = dx;
+                    dzs[vertex][l] = dz;
+                    if (RSQUARED_2D - dx * dx - dz * dz <= 0.0f) {
+                        // Out of range: lane masked to 0 below, skip the lookup
+                        gxs[vertex][l] = gzs[vertex][l] = 0.0f;
+                    } else {
+                        int gi = permGrad2_[static_cast<size_t>(
+                            perm_[static_cast<size_t>(xsv & 2047)] ^ (zsv & 2047))];
+                        gxs[vertex][l] = GRAD2[static_cast<size_t>(gi * 2)];
+                        gzs[vertex][l] = GRAD2[static_cast<size_t>(gi * 2 + 1)];
+                    }
+                    ++vertex;
+                };
+
+                add(xsb, zsb, dx0, dz0);
+                add(xsb + 1, zsb, dx0 - 1.0f + UNSKEW_2D, dz0 + UNSKEW_2D);
+                add(xsb, zsb + 1, dx0 + UNSKEW_2D, dz0 - 1.0f + UNSKEW_2D);
+                add(xsb + 1, zsb + 1,
+                    dx0 - 1.0f + 2.0f * UNSKEW_2D,
+                    dz0 - 1.0f + 2.0f * UNSKEW_2D);
+                if (xsi + zsi > 1.0f) {
+                    add(xsb + 2, zsb + 1,
+                        dx0 - 2.0f + 3.0f * UNSKEW_2D,
+                        dz0 - 1.0f + 3.0f * UNSKEW_2D);
+                    add(xsb + 1, zsb + 2,
+                        dx0 - 1.0f + 3.0f * UNSKEW_2D,
+                        dz0 - 2.0f + 3.0f * UNSKEW_2D);
+                } else {
+                    add(xsb - 1, zsb, dx0 + 1.0f - UNSKEW_2D, dz0 - UNSKEW_2D);
+                    add(xsb, zsb - 1, dx0 - UNSKEW_2D, dz0 + 1.0f - UNSKEW_2D);
+                }
+            }
+
+            Float4 value = Float4::splat(0.0f);
+            Float4 radius = Float4::splat(RSQUARED_2D);
+            for (size_t v = 0; v < VERTICES; ++v) {
+                Float4 dx = Float4::load(dxs[v].data());
+                Float4 dz = Float4::load(dzs[v].data());
+                Float4 attn = radius - dx * dx - dz * dz;
+                Float4 extrapolation = Float4::load(gxs[v].data()) * dx +
+                                       Float4::load(gzs[v].data()) * dz;
+                Float4 attn2 = attn * attn;
+                value = value + simd::whereGatePositive(attn, attn2 * attn2 * extrapolation);
+            }
+            (value * Float4::splat(18.24196194486065f)).store(result);
+        });
+}
+
 // ============================================================================
 // OpenSimplex3D
 // ============================================================================
@@ -374,4 +450,16 @@ float OpenSimplex3D::evaluate(float x, float y, float z) const {
     return value * GRAD3_NORM * 32.0f;
 }
 
+void OpenSimplex3D::evaluateBatch(std::span<const float> xs, std::span<const float> ys,
+                                  std::span<const float> zs, std::span<float> out) const {
+    // The 3D kernel is dominated by its three dependent permutation lookups
+    // per vertex. Without a gather instruction, staging all five vertices
+    // for a four-lane version costs more than the lanes save (see Section
+    // 27.2.7), so this runs the scalar path without per-point virtual
+    // dispatch.
+    for (size_t i = 0; i < out.size(); ++i) {
+        out[i] = OpenSimplex3D::evaluate(xs[i], ys[i], zs[i]);
+    }
+}
+
 }  // namespace finevox::worldgen
@@ -78,6 +78,8 @@ VoronoiResult VoronoiNoise2D::evaluate(float x, float z) const {
     result.distance2 = std::sqrt(dist2);
     result.cellCenter = closestCenter;
     result.cellId = cellHash(closestCellX, closestCellZ);
+    result.cellX = closestCellX;
+    result.cellZ = closestCellZ;
     return result;
 }
 
@@ -0,0 +1,297 @@
+/**
+ * @file pregenerator.cpp
+ * @brief Headless bulk generation into region files
+ *
+ * Design: [27-world-generation.md] Section 27.8.5
+ */
+
+#include "finevox/worldgen/pregenerator.hpp"
+#include "finevox/worldgen/feature_registry.hpp"
+#include "finevox/worldgen/feature_write_buffer.hpp"
+#include "finevox/core/chunk_column.hpp"
+#include "finevox/core/serialization.hpp"
+#include "finevox/core/world.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace finevox::worldgen {
+
+// ============================================================================
+// PregenArea
+// ============================================================================
+
+PregenArea PregenArea::square(ColumnPos center, int32_t radius) {
+    return PregenArea{ColumnPos{center.x - radius, center.z - radius},
+                      ColumnPos{center.x + radius, center.z + radius}};
+}
+
+uint64_t PregenArea::columnCount() const {
+    if (max.x < min.x || max.z < min.z) {
+        return 0;
+    }
+    return static_cast<uint64_t>(max.x - min.x + 1) * static_cast<uint64_t>(max.z - min.z + 1);
+}
+
+// ============================================================================
+// WorldPregenerator
+// ============================================================================
+
+WorldPregenerator::WorldPregenerator(GenerationPipeline& pipeline, const BiomeMap& biomeMap,
+                                     std::filesystem::path regionDir)
+    : pipeline_(pipeline)
+    , biomeMap_(biomeMap)
+    , regionDir_(std::move(regionDir))
+{
+}
+
+namespace {
+
+// Columns the widest registered feature can reach past its own: an origin
+// anywhere in a column plus the feature's horizontal extent
+int32_t registeredFeatureReach() {
+    auto& registry = FeatureRegistry::global();
+    int32_t extent = 0;
+    for (const FeaturePlacement& placement : registry.allPlacements()) {
+        if (const Feature* feature = registry.getFeature(placement.featureName)) {
+            BlockPos e = feature->maxExtent();
+            extent = std::max({extent, e.x, e.z});
+        }
+    }
+    return std::max((15 + extent) / 16, 1);
+}
+
+}  // namespace
+
+PregenResult WorldPregenerator::run(const PregenArea& area, const PregenOptions& options,
+                                    ProgressCallback progress) {
+    using Clock = std::chrono::steady_clock;
+    using Write = FeatureWriteBuffer::Write;
+    auto start = Clock::now();
+    auto elapsed = [&] {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    PregenResult result;
+    if (area.columnCount() == 0) {
+        return result;
+    }
+
+    std::vector<RegionPos> regions;
+    RegionPos minRegion = RegionPos::fromColumn(area.min);
+    RegionPos maxRegion = RegionPos::fromColumn(area.max);
+    for (int32_t rz = minRegion.rz; rz <= maxRegion.rz; ++rz) {
+        for (int32_t rx = minRegion.rx; rx <= maxRegion.rx; ++rx) {
+            regions.push_back(RegionPos{rx, rz});
+        }
+    }
+    auto regionIndex = [&](RegionPos rp) {
+        return static_cast<size_t>(rp.rz - minRegion.rz) * static_cast<size_t>(maxRegion.rx - minRegion.rx + 1) +
+               static_cast<size_t>(rp.rx - minRegion.rx);
+    };
+
+    CompressionPolicy policy = options.compression.value_or(CompressionPolicy::fromConfig());
+    const int32_t reach = options.featureReach > 0 ? options.featureReach : registeredFeatureReach();
+
+    std::atomic<uint64_t> generated{0};
+    std::atomic<uint64_t> skipped{0};
+    std::atomic<uint64_t> failures{0};
+    std::atomic<uint64_t> patched{0};
+    std::atomic<uint64_t> dropped{0};
+    std::mutex progressMutex;
+    size_t regionsDone = 0;
+
+    // Set by the one job that owns each region, in either phase
+    std::vector<uint8_t> regionWritten(regions.size(), 0);
+
+    // Feature writes a region's job cannot apply itself, by target region:
+    // into another region, into a column it already wrote, or into a column
+    // it never generated
+    std::mutex patchMutex;
+    std::unordered_map<RegionPos, std::vector<Write>> patches;
+
+    auto runJobs = [&](size_t count, const std::function<void(size_t)>& job) {
+        std::atomic<size_t> next{0};
+        auto worker = [&] {
+            for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+                job(i);
+            }
+        };
+        size_t threadCount = std::clamp<size_t>(options.threads, 1, std::max<size_t>(count, 1));
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+        for (size_t i = 1; i < threadCount; ++i) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    };
+
+    // Phase 1: each region generated by one job
+    auto generateRegion = [&](size_t index) {
+        RegionPos rp = regions[index];
+
+        // Clip the area to this region
+        int32_t x0 = std::max(area.min.x, rp.rx * REGION_SIZE);
+        int32_t x1 = std::min(area.max.x, rp.rx * REGION_SIZE + REGION_SIZE - 1);
+        int32_t z0 = std::max(area.min.z, rp.rz * REGION_SIZE);
+        int32_t z1 = std::min(area.max.z, rp.rz * REGION_SIZE + REGION_SIZE - 1);
+
+        RegionFile region(regionDir_, rp);
+        World world;
+        FeatureWriteBuffer pendingWrites;
+
+        // Rows below residentZ have been written and dropped from world
+        int32_t residentZ = z0;
+        std::vector<Write> deferred;
+        pendingWrites.setRouter([&](const Write& write) {
+            ColumnPos target = ColumnPos::fromBlock(write.pos);
+            if (RegionPos::fromColumn(target) == rp && target.z >= residentZ) {
+                return false;  // Queued here, or written directly if resident
+            }
+            deferred.push_back(write);
+            return true;
+        });
+
+        size_t saved = 0;
+        auto writeRow = [&](const std::vector<ColumnPos>& row) {
+            for (ColumnPos pos : row) {
+                const ChunkColumn* column = world.getColumn(pos);
+                auto cbor = ColumnSerializer::toCBOR(*column, pos.x, pos.z);
+                if (region.saveColumnRaw(pos, cbor, policy)) {
+                    ++saved;
+                } else {
+                    failures.fetch_add(1, std::memory_order_relaxed);
+                }
+                world.removeColumn(pos);
+            }
+        };
+
+        // Generated rows stay resident until the row `reach` past them is
+        // done, so features spilling back into them land before the write
+        std::deque<std::vector<ColumnPos>> rows;
+        for (int32_t z = z0; z <= z1; ++z) {
+            std::vector<ColumnPos> row;
+            for (int32_t x = x0; x <= x1; ++x) {
+                ColumnPos pos{x, z};
+                if (options.skipExisting && region.hasColumn(pos)) {
+                    skipped.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                // Features of earlier rows spilling into this one were queued
+                // in pendingWrites and land once its passes have run
+                auto& column = world.getOrCreateColumn(pos);
+                pipeline_.generateColumn(column, world, biomeMap_, &pendingWrites);
+                row.push_back(pos);
+            }
+            generated.fetch_add(row.size(), std::memory_order_relaxed);
+
+            rows.push_back(std::move(row));
+            if (rows.size() > static_cast<size_t>(reach)) {
+                writeRow(rows.front());
+                rows.pop_front();
+                ++residentZ;
+            }
+        }
+        while (!rows.empty()) {
+            writeRow(rows.front());
+            rows.pop_front();
+        }
+        region.flush();
+        regionWritten[index] = saved > 0 ? 1 : 0;
+
+        // Targets this job never generated (skipped or outside the area)
+        for (const Write& write : pendingWrites.takePending()) {
+            deferred.push_back(write);
+        }
+        {
+            std::lock_guard lock(patchMutex);
+            for (const Write& write : deferred) {
+                ColumnPos target = ColumnPos::fromBlock(write.pos);
+                if (area.contains(target)) {
+                    patches[RegionPos::fromColumn(target)].push_back(write);
+                } else {
+                    dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        if (progress) {
+            std::lock_guard lock(progressMutex);
+            ++regionsDone;
+            progress(PregenProgress{regionsDone, regions.size(),
+                                    generated.load(std::memory_order_relaxed),
+                                    skipped.load(std::memory_order_relaxed), elapsed()});
+        }
+    };
+    runJobs(regions.size(), generateRegion);
+
+    // Phase 2: every region's patches applied by one job, after all regions
+    // exist. Each target is patched in (source, sequence) order, so the
+    // result does not depend on which job finished first.
+    std::vector<RegionPos> patchRegions;
+    patchRegions.reserve(patches.size());
+    for (const auto& [rp, writes] : patches) {
+        patchRegions.push_back(rp);
+    }
+    auto patchRegion = [&](size_t index) {
+        RegionPos rp = patchRegions[index];
+        std::vector<Write>& writes = patches.at(rp);
+        std::sort(writes.begin(), writes.end(), [](const Write& a, const Write& b) {
+            return ColumnPos::fromBlock(a.pos) < ColumnPos::fromBlock(b.pos);
+        });
+
+        RegionFile region(regionDir_, rp);
+        FeatureWriteBuffer buffer;
+        size_t saved = 0;
+        for (size_t first = 0; first < writes.size();) {
+            ColumnPos target = ColumnPos::fromBlock(writes[first].pos);
+            size_t last = first;
+            while (last < writes.size() && ColumnPos::fromBlock(writes[last].pos) == target) {
+                ++last;
+            }
+
+            auto column = region.loadColumn(target);
+            if (!column) {
+                // Its phase 1 write failed
+                dropped.fetch_add(last - first, std::memory_order_relaxed);
+                first = last;
+                continue;
+            }
+            for (; first < last; ++first) {
+                buffer.add(writes[first]);
+            }
+            patched.fetch_add(buffer.flush(target, *column), std::memory_order_relaxed);
+            auto cbor = ColumnSerializer::toCBOR(*column, target.x, target.z);
+            if (region.saveColumnRaw(target, cbor, policy)) {
+                ++saved;
+            } else {
+                failures.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        region.flush();
+        if (saved > 0) {
+            regionWritten[regionIndex(rp)] = 1;
+        }
+    };
+    runJobs(patchRegions.size(), patchRegion);
+
+    result.columnsGenerated = generated.load();
+    result.columnsSkipped = skipped.load();
+    result.writeFailures = failures.load();
+    result.featureWritesPatched = patched.load();
+    result.featureWritesDropped = dropped.load();
+    result.regionsWritten = static_cast<size_t>(std::count(regionWritten.begin(), regionWritten.end(), 1));
+    result.seconds = elapsed();
+    return result;
+}
+
+}  // namespace finevox::worldgen
@@ -16,16 +16,29 @@ namespace finevox::worldgen {
 namespace {
 
 /// Deep copy a BlockSnapshot (handles move-only DataContainer via clone)
-void copySnapshotTo(BlockSnapshot& dst, const BlockSnapshot& src) {
-    dst.typeName = src.typeName;
+BlockSnapshot cloneSnapshot(const BlockSnapshot& src) {
+    BlockSnapshot dst(src.typeName);
     dst.rotation = src.rotation;
     dst.displacement = src.displacement;
     if (src.extraData.has_value()) {
         auto cloned = src.extraData->clone();
         dst.extraData = std::move(*cloned);
-    } else {
-        dst.extraData.reset();
     }
+    return dst;
+}
+
+/// Copy snap into dst at pos with a new rotation and displacement. Cells
+/// without displacement or extra data skip building a snapshot.
+void copyTransformed(Schematic& dst, glm::ivec3 pos, const BlockSnapshot& snap,
+                     Rotation rotation, glm::vec3 displacement) {
+    if (displacement == glm::vec3(0.0f) && !snap.extraData.has_value()) {
+        dst.setBlock(pos, snap.typeName, rotation);
+        return;
+    }
+    BlockSnapshot copy = cloneSnapshot(snap);
+    copy.rotation = rotation;
+    copy.displacement = displacement;
+    dst.set(pos, std::move(copy));
 }
 
 }  // namespace
@@ -39,21 +52,64 @@ Schematic::Schematic(int32_t sizeX, int32_t sizeY, int32_t sizeZ)
     if (sizeX <= 0 || sizeY <= 0 || sizeZ <= 0) {
         throw std::invalid_argument("Schematic dimensions must be positive");
     }
-    blocks_.resize(static_cast<size_t>(sizeX) * sizeY * sizeZ);
+    palette_.emplace_back();  // Air
 }
 
 BlockSnapshot& Schematic::at(int32_t x, int32_t y, int32_t z) {
     if (!contains(x, y, z)) {
         throw std::out_of_range("Schematic::at out of bounds");
     }
-    return blocks_[index(x, y, z)];
+    size_t i = index(x, y, z);
+    auto [it, inserted] = side_.try_emplace(static_cast<uint32_t>(i));
+    if (inserted) {
+        const BlockSnapshot& current = palette_[packedAt(i)];
+        it->second.typeName = current.typeName;
+        it->second.rotation = current.rotation;
+        setSideBit(i, true);
+    }
+    return it->second;
 }
 
 const BlockSnapshot& Schematic::at(int32_t x, int32_t y, int32_t z) const {
     if (!contains(x, y, z)) {
         throw std::out_of_range("Schematic::at out of bounds");
     }
-    return blocks_[index(x, y, z)];
+    size_t i = index(x, y, z);
+    if (inSideTable(i)) {
+        return side_.find(static_cast<uint32_t>(i))->second;
+    }
+    return palette_[packedAt(i)];
+}
+
+void Schematic::setBlock(int32_t x, int32_t y, int32_t z, std::string_view typeName,
+                         Rotation rotation) {
+    if (!contains(x, y, z)) {
+        throw std::out_of_range("Schematic::setBlock out of bounds");
+    }
+    size_t i = index(x, y, z);
+    setPacked(i, paletteIndexFor(typeName, rotation));
+    if (inSideTable(i)) {
+        side_.erase(static_cast<uint32_t>(i));
+        setSideBit(i, false);
+    }
+}
+
+void Schematic::set(int32_t x, int32_t y, int32_t z, BlockSnapshot snapshot) {
+    if (!contains(x, y, z)) {
+        throw std::out_of_range("Schematic::set out of bounds");
+    }
+    size_t i = index(x, y, z);
+    setPacked(i, paletteIndexFor(snapshot.typeName, snapshot.rotation));
+
+    bool keep = !snapshot.isAir() &&
+                (snapshot.displacement != glm::vec3(0.0f) || snapshot.extraData.has_value());
+    if (keep) {
+        side_.insert_or_assign(static_cast<uint32_t>(i), std::move(snapshot));
+        setSideBit(i, true);
+    } else if (inSideTable(i)) {
+        side_.erase(static_cast<uint32_t>(i));
+        setSideBit(i, false);
+    }
 }
 
 bool Schematic::contains(int32_t x, int32_t y, int32_t z) const {
@@ -62,19 +118,184 @@ bool Schematic::contains(int32_t x, int32_t y, int32_t z) const {
            z >= 0 && z < sizeZ_;
 }
 
+uint32_t Schematic::paletteIndex(int32_t x, int32_t y, int32_t z) const {
+    if (!contains(x, y, z)) {
+        throw std::out_of_range("Schematic::paletteIndex out of bounds");
+    }
+    size_t i = index(x, y, z);
+    return inSideTable(i) ? NO_PALETTE_INDEX : packedAt(i);
+}
+
+// ----------------------------------------------------------------------------
+// Packed storage
+// ----------------------------------------------------------------------------
+
+void Schematic::setPacked(size_t i, uint32_t value) {
+    if (bits_ == 0) {
+        return;  // All air: paletteIndexFor() widens before handing out index 1
+    }
+    size_t bit = i * bits_;
+    uint64_t mask = (uint64_t{1} << bits_) - 1;
+    uint64_t& word = packed_[bit >> 6];
+    word = (word & ~(mask << (bit & 63))) | (static_cast<uint64_t>(value) << (bit & 63));
+}
+
+void Schematic::repack(uint8_t bits) {
+    std::vector<uint64_t> packed;
+    if (bits > 0) {
+        packed.assign((static_cast<size_t>(volume()) * bits + 63) / 64, 0);
+        size_t count = static_cast<size_t>(volume());
+        for (size_t i = 0; i < count; ++i) {
+            uint64_t value = packedAt(i);
+            size_t bit = i * bits;
+            packed[bit >> 6] |= value << (bit & 63);
+        }
+    }
+    packed_ = std::move(packed);
+    bits_ = bits;
+}
+
+uint32_t Schematic::paletteIndexFor(std::string_view typeName, Rotation rotation) {
+    if (typeName.empty() || typeName == "air") {
+        return 0;
+    }
+    const BlockSnapshot& last = palette_[lastPaletteIndex_];
+    if (last.typeName == typeName && last.rotation == rotation) {
+        return lastPaletteIndex_;
+    }
+
+    PaletteKey key{std::string(typeName), rotation.index()};
+    auto it = paletteLookup_.find(key);
+    if (it != paletteLookup_.end()) {
+        lastPaletteIndex_ = it->second;
+        return it->second;
+    }
+
+    auto paletteIndex = static_cast<uint32_t>(palette_.size());
+    BlockSnapshot& entry = palette_.emplace_back(typeName);
+    entry.rotation = rotation;
+    paletteLookup_.emplace(std::move(key), paletteIndex);
+    lastPaletteIndex_ = paletteIndex;
+
+    uint8_t bits = bits_ == 0 ? 1 : bits_;
+    while (bits < 32 && (uint64_t{1} << bits) <= paletteIndex) {
+        bits *= 2;
+    }
+    if (bits != bits_) {
+        repack(bits);
+    }
+    return paletteIndex;
+}
+
+void Schematic::setSideBit(size_t i, bool present) {
+    if (sideMask_.empty()) {
+        if (!present) return;
+        sideMask_.assign((static_cast<size_t>(volume()) + 63) / 64, 0);
+    }
+    if (present) {
+        sideMask_[i >> 6] |= uint64_t{1} << (i & 63);
+    } else {
+        sideMask_[i >> 6] &= ~(uint64_t{1} << (i & 63));
+    }
+}
+
+void Schematic::compact() {
+    // Fold edited cells back into the packed form
+    for (auto it = side_.begin(); it != side_.end();) {
+        BlockSnapshot& snap = it->second;
+        setPacked(it->first, paletteIndexFor(snap.typeName, snap.rotation));
+        if (snap.isAir() ||
+            (snap.displacement == glm::vec3(0.0f) && !snap.extraData.has_value())) {
+            setSideBit(it->first, false);
+            it = side_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    if (side_.empty()) {
+        std::unordered_map<uint32_t, BlockSnapshot>().swap(side_);  // Release the buckets too
+        sideMask_.clear();
+        sideMask_.shrink_to_fit();
+    }
+
+    // Renumber used palette entries in their current order
+    size_t count = static_cast<size_t>(volume());
+    std::vector<uint32_t> remap(palette_.size(), 0);
+    for (size_t i = 0; i < count; ++i) {
+        remap[packedAt(i)] = 1;
+    }
+    remap[0] = 0;
+    std::vector<BlockSnapshot> palette;
+    palette.emplace_back();
+    paletteLookup_.clear();
+    for (size_t p = 1; p < palette_.size(); ++p) {
+        if (remap[p] == 0) continue;
+        remap[p] = static_cast<uint32_t>(palette.size());
+        paletteLookup_.emplace(PaletteKey{palette_[p].typeName, palette_[p].rotation.index()},
+                               remap[p]);
+        palette.push_back(std::move(palette_[p]));
+    }
+
+    uint8_t bits = 0;
+    if (palette.size() > 1) {
+        bits = 1;
+        while (bits < 32 && (uint64_t{1} << bits) < palette.size()) {
+            bits *= 2;
+        }
+    }
+    std::vector<uint64_t> packed((count * bits + 63) / 64, 0);
+    if (bits > 0) {
+        for (size_t i = 0; i < count; ++i) {
+            size_t bit = i * bits;
+            packed[bit >> 6] |= static_cast<uint64_t>(remap[packedAt(i)]) << (bit & 63);
+        }
+    }
+    palette_ = std::move(palette);
+    packed_ = std::move(packed);
+    bits_ = bits;
+    lastPaletteIndex_ = 0;
+}
+
+size_t Schematic::memoryUsage() const {
+    size_t bytes = sizeof(*this);
+    bytes += packed_.capacity() * sizeof(uint64_t);
+    bytes += sideMask_.capacity() * sizeof(uint64_t);
+    bytes += palette_.capacity() * sizeof(BlockSnapshot);
+    for (const auto& entry : palette_) {
+        bytes += entry.typeName.capacity();
+    }
+    // Hash nodes: key, value and a next pointer, plus the bucket array
+    bytes += paletteLookup_.size() * (sizeof(PaletteKey) + sizeof(uint32_t) + sizeof(void*));
+    bytes += paletteLookup_.bucket_count() * sizeof(void*);
+    for (const auto& [cell, snap] : side_) {
+        bytes += sizeof(cell) + sizeof(BlockSnapshot) + sizeof(void*) + snap.typeName.capacity();
+        if (snap.extraData) {
+            bytes += sizeof(DataContainer);
+        }
+    }
+    bytes += side_.bucket_count() * sizeof(void*);
+    return bytes;
+}
+
 size_t Schematic::nonAirBlockCount() const {
     size_t count = 0;
-    for (const auto& snap : blocks_) {
-        if (!snap.isAir()) ++count;
-    }
+    forEachBlockIndexed([&](glm::ivec3, uint32_t, const BlockSnapshot&) { ++count; });
     return count;
 }
 
 std::unordered_set<std::string> Schematic::uniqueBlockTypes() const {
+    std::vector<bool> used(palette_.size(), false);
     std::unordered_set<std::string> types;
-    for (const auto& snap : blocks_) {
-        if (!snap.isAir()) {
+    forEachBlockIndexed([&](glm::ivec3, uint32_t paletteIndex, const BlockSnapshot& snap) {
+        if (paletteIndex == NO_PALETTE_INDEX) {
             types.insert(snap.typeName);
+        } else {
+            used[paletteIndex] = true;
+        }
+    });
+    for (size_t p = 1; p < palette_.size(); ++p) {
+        if (used[p]) {
+            types.insert(palette_[p].typeName);
         }
     }
     return types;
@@ -91,7 +312,7 @@ Schematic rotateSchematic(const Schematic& schematic, Rotation rotation) {
         result.setName(schematic.name());
         result.setAuthor(schematic.author());
         schematic.forEachBlock([&](glm::ivec3 pos, const BlockSnapshot& snap) {
-            copySnapshotTo(result.at(pos), snap);
+            copyTransformed(result, pos, snap, snap.rotation, snap.displacement);
         });
         return result;
     }
@@ -132,14 +353,8 @@ Schematic rotateSchematic(const Schematic& schematic, Rotation rotation) {
         glm::ivec3 newPos(rx - minCorner.x, ry - minCorner.y, rz - minCorner.z);
 
         if (result.contains(newPos)) {
-            auto& dst = result.at(newPos);
-            dst.typeName = snap.typeName;
-            dst.rotation = snap.rotation.compose(rotation);
-            dst.displacement = snap.displacement;
-            if (snap.extraData.has_value()) {
-                auto cloned = snap.extraData->clone();
-                dst.extraData = std::move(*cloned);
-            }
+            copyTransformed(result, newPos, snap, snap.rotation.compose(rotation),
+                            snap.displacement);
         }
     });
 
@@ -153,23 +368,22 @@ Schematic mirrorSchematic(const Schematic& schematic, Axis axis) {
 
     schematic.forEachBlock([&](glm::ivec3 pos, const BlockSnapshot& snap) {
         glm::ivec3 newPos = pos;
+        glm::vec3 displacement = snap.displacement;
         switch (axis) {
-            case Axis::X: newPos.x = schematic.sizeX() - 1 - pos.x; break;
-            case Axis::Y: newPos.y = schematic.sizeY() - 1 - pos.y; break;
-            case Axis::Z: newPos.z = schematic.sizeZ() - 1 - pos.z; break;
-        }
-
-        auto& dst = result.at(newPos);
-        dst.typeName = snap.typeName;
-        dst.rotation = snap.rotation;
-        dst.displacement = snap.displacement;
-        if (axis == Axis::X) dst.displacement.x = -dst.displacement.x;
-        else if (axis == Axis::Y) dst.displacement.y = -dst.displacement.y;
-        else if (axis == Axis::Z) dst.displacement.z = -dst.displacement.z;
-        if (snap.extraData.has_value()) {
-            auto cloned = snap.extraData->clone();
-            dst.extraData = std::move(*cloned);
+            case Axis::X:
+                newPos.x = schematic.sizeX() - 1 - pos.x;
+                displacement.x = -displacement.x;
+                break;
+            case Axis::Y:
+                newPos.y = schematic.sizeY() - 1 - pos.y;
+                displacement.y = -displacement.y;
+                break;
+            case Axis::Z:
+                newPos.z = schematic.sizeZ() - 1 - pos.z;
+                displacement.z = -displacement.z;
+                break;
         }
+        copyTransformed(result, newPos, snap, snap.rotation, displacement);
     });
 
     return result;
@@ -196,8 +410,7 @@ Schematic cropSchematic(const Schematic& schematic) {
     result.setAuthor(schematic.author());
 
     schematic.forEachBlock([&](glm::ivec3 pos, const BlockSnapshot& snap) {
-        glm::ivec3 newPos = pos - minPos;
-        copySnapshotTo(result.at(newPos), snap);
+        copyTransformed(result, pos - minPos, snap, snap.rotation, snap.displacement);
     });
 
     return result;
@@ -211,22 +424,16 @@ Schematic replaceBlocks(
     result.setName(schematic.name());
     result.setAuthor(schematic.author());
 
-    for (int32_t x = 0; x < schematic.sizeX(); ++x) {
-        for (int32_t z = 0; z < schematic.sizeZ(); ++z) {
-            for (int32_t y = 0; y < schematic.sizeY(); ++y) {
-                const auto& snap = schematic.at(x, y, z);
-                auto& dst = result.at(x, y, z);
-                copySnapshotTo(dst, snap);
-
-                if (!snap.isAir()) {
-                    auto it = replacements.find(snap.typeName);
-                    if (it != replacements.end()) {
-                        dst.typeName = it->second;
-                    }
-                }
-            }
+    schematic.forEachBlock([&](glm::ivec3 pos, const BlockSnapshot& snap) {
+        auto it = replacements.find(snap.typeName);
+        if (it == replacements.end()) {
+            copyTransformed(result, pos, snap, snap.rotation, snap.displacement);
+            return;
         }
-    }
+        BlockSnapshot copy = cloneSnapshot(snap);
+        copy.typeName = it->second;
+        result.set(pos, std::move(copy));
+    });
 
     return result;
 }
@@ -348,14 +348,15 @@ Schematic deserializeSchematic(std::span<const uint8_t> data) {
                 }
 
                 if (paletteIdx < palette.size() && palette[paletteIdx] != "air") {
-                    auto& snap = result.at(x, y, z);
-                    snap.typeName = palette[paletteIdx];
-
                     auto metaIt = metadata.find(blockIdx);
-                    if (metaIt != metadata.end()) {
+                    if (metaIt == metadata.end()) {
+                        result.setBlock(x, y, z, palette[paletteIdx]);
+                    } else {
+                        BlockSnapshot snap(palette[paletteIdx]);
                         snap.rotation = Rotation::byIndex(metaIt->second.rotIndex);
                         snap.displacement = metaIt->second.displacement;
                         snap.extraData = std::move(metaIt->second.extraData);
+                        result.set(x, y, z, std::move(snap));
                     }
                 }
                 ++blockIdx;
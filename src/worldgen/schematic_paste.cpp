@@ -0,0 +1,286 @@
+/**
+ * @file schematic_paste.cpp
+ * @brief Multi-threaded schematic placement, committed per subchunk
+ *
+ * Design: [21-clipboard-schematic.md] Section 21.5
+ */
+
+#include "finevox/worldgen/schematic_paste.hpp"
+#include "finevox/core/chunk_column.hpp"
+#include "finevox/core/light_engine.hpp"
+#include "finevox/core/mesh_rebuild_queue.hpp"
+#include "finevox/core/string_interner.hpp"
+#include "finevox/core/subchunk.hpp"
+#include "finevox/core/world.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace finevox::worldgen {
+
+namespace {
+
+/// One staged write into a subchunk
+struct Cell {
+    uint16_t index = 0;                  ///< Subchunk array index
+    BlockTypeId type;
+    uint8_t rotation = 0;
+    const DataContainer* data = nullptr; ///< Schematic's extra data, cloned on commit
+};
+
+/// The part of the target box inside one subchunk
+struct Task {
+    ChunkPos pos;
+    BlockPos lo;                   ///< Inclusive world bounds of the overlap
+    BlockPos hi;
+    SubChunk* subChunk = nullptr;  ///< Existing (read during staging) or created before commit
+    std::vector<Cell> cells;
+    bool anyNonAir = false;
+};
+
+/// Type ids for the schematic's palette and for the names used by its
+/// side-table cells. Names are interned in sorted order before any worker
+/// starts, so ids never depend on thread timing.
+struct ResolvedNames {
+    std::vector<BlockTypeId> palette;
+    std::unordered_map<std::string_view, BlockTypeId> side;
+};
+
+ResolvedNames resolveNames(const Schematic& schematic) {
+    std::vector<std::string_view> names;
+    for (const auto& entry : schematic.palette()) {
+        names.push_back(entry.typeName);
+    }
+    for (const auto& [cell, snap] : schematic.sideTable()) {
+        names.push_back(snap.typeName);
+    }
+    std::sort(names.begin(), names.end());
+    names.erase(std::unique(names.begin(), names.end()), names.end());
+
+    std::unordered_map<std::string_view, BlockTypeId> ids;
+    for (std::string_view name : names) {
+        ids.emplace(name, BlockSnapshot(name).isAir() ? AIR_BLOCK_TYPE : BlockTypeId::fromName(name));
+    }
+
+    ResolvedNames resolved;
+    for (const auto& entry : schematic.palette()) {
+        resolved.palette.push_back(ids.at(entry.typeName));
+    }
+    for (const auto& [cell, snap] : schematic.sideTable()) {
+        resolved.side.emplace(snap.typeName, ids.at(snap.typeName));
+    }
+    return resolved;
+}
+
+/// Run fn(i) for i in [0, count) on up to threads threads, this one included
+template<typename Fn>
+void parallelFor(size_t count, size_t threads, Fn&& fn) {
+    std::atomic<size_t> next{0};
+    auto worker = [&] {
+        for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+            fn(i);
+        }
+    };
+
+    size_t threadCount = std::clamp<size_t>(threads, 1, std::max<size_t>(count, 1));
+    std::vector<std::thread> pool;
+    pool.reserve(threadCount - 1);
+    for (size_t i = 1; i < threadCount; ++i) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+}
+
+void stage(Task& task, const Schematic& schematic, BlockPos origin,
+           const ResolvedNames& names, const PlaceOptions& options) {
+    BlockPos corner = task.pos.cornerBlockPos();
+    task.cells.reserve(static_cast<size_t>(task.hi.x - task.lo.x + 1) *
+                       (task.hi.y - task.lo.y + 1) * (task.hi.z - task.lo.z + 1));
+    const auto& palette = schematic.palette();
+
+    // Walk in the schematic's storage order (y innermost) to stay cache friendly
+    for (int32_t x = task.lo.x; x <= task.hi.x; ++x) {
+        for (int32_t z = task.lo.z; z <= task.hi.z; ++z) {
+            for (int32_t y = task.lo.y; y <= task.hi.y; ++y) {
+                int32_t sx = x - origin.x, sy = y - origin.y, sz = z - origin.z;
+                uint32_t paletteIndex = schematic.paletteIndex(sx, sy, sz);
+
+                Cell cell{};
+                if (paletteIndex != Schematic::NO_PALETTE_INDEX) {
+                    cell.type = names.palette[paletteIndex];
+                    cell.rotation = palette[paletteIndex].rotation.index();
+                } else {
+                    const BlockSnapshot& snap = schematic.at(sx, sy, sz);
+                    cell.type = names.side.at(snap.typeName);
+                    cell.rotation = snap.rotation.index();
+                    cell.data = snap.extraData ? &*snap.extraData : nullptr;
+                }
+
+                bool air = cell.type.isAir();
+                if (air && !options.pasteAir) {
+                    continue;
+                }
+
+                cell.index = LocalBlockPos(x - corner.x, y - corner.y, z - corner.z).toIndex();
+                if (!options.replaceNonAir && task.subChunk &&
+                    !task.subChunk->getBlock(cell.index).isAir()) {
+                    continue;
+                }
+
+                task.anyNonAir = task.anyNonAir || !air;
+                task.cells.push_back(cell);
+            }
+        }
+    }
+}
+
+void commit(Task& task) {
+    SubChunk& subChunk = *task.subChunk;
+    auto& blockData = subChunk.allBlockData();
+
+    BlockTypeId lastType = AIR_BLOCK_TYPE;
+    SubChunk::LocalIndex lastIndex = 0;  // Air is always index 0
+    for (const Cell& cell : task.cells) {
+        if (cell.type != lastType) {
+            lastType = cell.type;
+            lastIndex = subChunk.bulkPaletteIndex(cell.type);
+        }
+        subChunk.bulkSetCounted(cell.index, lastIndex);
+        subChunk.setRotationIndex(cell.index, cell.rotation);
+        if (cell.data) {
+            blockData[cell.index] = cell.data->clone();
+        } else if (!blockData.empty()) {
+            blockData.erase(cell.index);
+        }
+    }
+    subChunk.endSparseWrite();
+}
+
+}  // namespace
+
+// ============================================================================
+// placeSchematic
+// ============================================================================
+
+PlaceResult placeSchematic(World& world, const Schematic& schematic, BlockPos origin,
+                           const PlaceOptions& options) {
+    PlaceResult result;
+
+    size_t threads = options.threads;
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    ResolvedNames names = resolveNames(schematic);
+
+    // One task per subchunk the target box overlaps, in (x, z, y) order
+    BlockPos last(origin.x + schematic.sizeX() - 1,
+                  origin.y + schematic.sizeY() - 1,
+                  origin.z + schematic.sizeZ() - 1);
+    ChunkPos minChunk = ChunkPos::fromBlock(origin);
+    ChunkPos maxChunk = ChunkPos::fromBlock(last);
+
+    std::vector<Task> tasks;
+    for (int32_t cx = minChunk.x; cx <= maxChunk.x; ++cx) {
+        for (int32_t cz = minChunk.z; cz <= maxChunk.z; ++cz) {
+            for (int32_t cy = minChunk.y; cy <= maxChunk.y; ++cy) {
+                Task task;
+                task.pos = ChunkPos(cx, cy, cz);
+                BlockPos corner = task.pos.cornerBlockPos();
+                task.lo = BlockPos(std::max(origin.x, corner.x),
+                                   std::max(origin.y, corner.y),
+                                   std::max(origin.z, corner.z));
+                task.hi = BlockPos(std::min(last.x, corner.x + 15),
+                                   std::min(last.y, corner.y + 15),
+                                   std::min(last.z, corner.z + 15));
+                task.subChunk = world.getSubChunk(task.pos);
+                tasks.push_back(std::move(task));
+            }
+        }
+    }
+
+    // Stage: read-only, so subchunks can be staged on any thread
+    parallelFor(tasks.size(), threads, [&](size_t i) {
+        stage(tasks[i], schematic, origin, names, options);
+    });
+
+    // Create what is missing. Subchunks that would only receive air stay absent.
+    std::vector<Task*> pending;
+    for (auto& task : tasks) {
+        if (task.cells.empty()) {
+            continue;
+        }
+        if (!task.subChunk) {
+            if (!task.anyNonAir) {
+                continue;
+            }
+            ColumnPos columnPos{task.pos.x, task.pos.z};
+            task.subChunk = &world.getOrCreateColumn(columnPos).getOrCreateSubChunk(task.pos.y);
+        }
+        pending.push_back(&task);
+    }
+
+    // Commit: each subchunk gets one bulk write and one version bump
+    parallelFor(pending.size(), threads, [&](size_t i) {
+        commit(*pending[i]);
+    });
+
+    std::vector<ColumnPos> columns;
+    for (Task* task : pending) {
+        result.blocksPlaced += task->cells.size();
+        ColumnPos columnPos{task->pos.x, task->pos.z};
+        if (columns.empty() || columns.back() != columnPos) {
+            columns.push_back(columnPos);
+        }
+    }
+    result.subChunksTouched = pending.size();
+    result.columnsTouched = columns.size();
+
+    for (const auto& columnPos : columns) {
+        if (ChunkColumn* column = world.getColumn(columnPos)) {
+            column->markHeightmapDirty();
+        }
+    }
+
+    LightEngine* lightEngine = world.lightEngine();
+    if (options.relight && lightEngine) {
+        for (const auto& columnPos : columns) {
+            lightEngine->recalculateColumn(columnPos);
+        }
+    }
+
+    MeshRebuildQueue* meshQueue = world.meshRebuildQueue();
+    if (options.remesh && meshQueue) {
+        // Faces of neighboring subchunks may sample the changed border blocks
+        std::vector<ChunkPos> remesh;
+        std::unordered_set<ChunkPos> seen;
+        static constexpr int32_t OFFSETS[7][3] = {
+            {0, 0, 0}, {-1, 0, 0}, {1, 0, 0}, {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1}};
+        for (Task* task : pending) {
+            for (const auto& offset : OFFSETS) {
+                ChunkPos pos(task->pos.x + offset[0], task->pos.y + offset[1], task->pos.z + offset[2]);
+                if (seen.insert(pos).second) {
+                    remesh.push_back(pos);
+                }
+            }
+        }
+        for (const auto& pos : remesh) {
+            if (const SubChunk* subChunk = world.getSubChunk(pos)) {
+                meshQueue->push(pos, MeshRebuildRequest::normal(subChunk->blockVersion(),
+                                                                subChunk->lightVersion()));
+            }
+        }
+    }
+
+    return result;
+}
+
+}  // namespace finevox::worldgen
@@ -6,10 +6,13 @@
  */
 
 #include "finevox/worldgen/world_generator.hpp"
+#include "finevox/worldgen/feature_write_buffer.hpp"
+#include "finevox/worldgen/pass_counters.hpp"
 #include "finevox/core/chunk_column.hpp"
 #include "finevox/core/world.hpp"
 
 #include <algorithm>
+#include <chrono>
 
 namespace finevox::worldgen {
 
@@ -29,13 +32,13 @@ uint64_t GenerationContext::columnSeed() const {
 
 void GenerationPipeline::addPass(std::unique_ptr<GenerationPass> pass) {
     if (!pass) return;
-    passes_.push_back(std::move(pass));
+    passes_.push_back({std::move(pass), std::make_unique<PassProfile>()});
     sortPasses();
 }
 
 bool GenerationPipeline::removePass(std::string_view name) {
     auto it = std::find_if(passes_.begin(), passes_.end(),
-        [&](const auto& p) { return p->name() == name; });
+        [&](const auto& p) { return p.pass->name() == name; });
     if (it == passes_.end()) return false;
     passes_.erase(it);
     return true;
@@ -45,15 +48,16 @@ bool GenerationPipeline::replacePass(std::unique_ptr<GenerationPass> pass) {
     if (!pass) return false;
     auto name = pass->name();
     auto it = std::find_if(passes_.begin(), passes_.end(),
-        [&](const auto& p) { return p->name() == name; });
+        [&](const auto& p) { return p.pass->name() == name; });
     if (it == passes_.end()) return false;
-    *it = std::move(pass);
+    *it = {std::move(pass), std::make_unique<PassProfile>()};
     sortPasses();
     return true;
 }
 
 void GenerationPipeline::generateColumn(ChunkColumn& column, World& world,
-                                         const BiomeMap& biomeMap) {
+                                         const BiomeMap& biomeMap,
+                                         FeatureWriteBuffer* pendingWrites) {
     GenerationContext ctx{
         column,
         column.position(),
@@ -62,23 +66,124 @@ void GenerationPipeline::generateColumn(ChunkColumn& column, World& world,
         worldSeed_,
         {},  // heightmap
         {},  // biomes
+        pendingWrites,
     };
 
-    for (auto& pass : passes_) {
-        pass->generate(ctx);
+    // Complete (the default for columns not built by the generator) and
+    // not-started columns both get every pass
+    size_t first = 0;
+    int32_t stage = column.generationStage();
+    if (stage != ChunkColumn::GENERATION_NOT_STARTED && stage != ChunkColumn::GENERATION_COMPLETE) {
+        first = nextPassIndex(stage, column.generationStageRank());
+        restoreContext(ctx);
+    }
+
+    for (size_t i = first; i < passes_.size(); ++i) {
+        runPass(i, ctx);
+    }
+    column.setGenerationStage(ChunkColumn::GENERATION_COMPLETE);
+    if (pendingWrites) {
+        pendingWrites->flush(column.position(), column);
+    }
+}
+
+size_t GenerationPipeline::nextPassIndex(int32_t stage, int32_t rank) const {
+    if (stage == ChunkColumn::GENERATION_COMPLETE) {
+        return passes_.size();
+    }
+    if (stage == ChunkColumn::GENERATION_NOT_STARTED) {
+        return 0;
+    }
+    auto last = std::upper_bound(passes_.begin(), passes_.end(), stage,
+        [](int32_t value, const auto& entry) { return value < entry.pass->priority(); });
+    size_t end = static_cast<size_t>(last - passes_.begin());
+    if (rank <= 0) {
+        return end;
+    }
+    auto first = std::lower_bound(passes_.begin(), passes_.end(), stage,
+        [](const auto& entry, int32_t value) { return entry.pass->priority() < value; });
+    return std::min(static_cast<size_t>(first - passes_.begin()) + static_cast<size_t>(rank), end);
+}
+
+void GenerationPipeline::runPass(size_t index, GenerationContext& ctx) {
+    GenerationPass& pass = *passes_[index].pass;
+    PassCounters& counters = PassCounters::current();
+    PassCounters before = counters;
+    auto start = profiling_ ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+    {
+        // Passes should use pre-resolved IDs; any name lookup is counted
+        StringInterner::HotPathScope hotPath;
+        pass.generate(ctx);
+    }
+    if (profiling_) {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        PassProfile& profile = *passes_[index].profile;
+        profile.runs.fetch_add(1, std::memory_order_relaxed);
+        profile.nanoseconds.fetch_add(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+            std::memory_order_relaxed);
+        profile.blocksWritten.fetch_add(counters.blocksWritten - before.blocksWritten,
+                                        std::memory_order_relaxed);
+        profile.noiseSamples.fetch_add(counters.noiseSamples - before.noiseSamples,
+                                       std::memory_order_relaxed);
+    }
+    if (index + 1 == passes_.size()) {
+        ctx.column.setGenerationStage(ChunkColumn::GENERATION_COMPLETE);
+        return;
+    }
+
+    // Passes sharing a priority are told apart by their rank among them
+    int32_t rank = 1;
+    while (static_cast<size_t>(rank) <= index &&
+           passes_[index - static_cast<size_t>(rank)].pass->priority() == pass.priority()) {
+        ++rank;
+    }
+    ctx.column.setGenerationStage(pass.priority(), rank);
+}
+
+void GenerationPipeline::restoreContext(GenerationContext& ctx) const {
+    int32_t topY = -1;
+    ctx.column.forEachSubChunk([&](int32_t y, const SubChunk& subChunk) {
+        if (!subChunk.isEmpty()) {
+            topY = std::max(topY, y * 16 + 15);
+        }
+    });
+
+    ColumnBiomeGrid biomeGrid;
+    ctx.biomeMap.sampleColumn(ctx.pos, biomeGrid);
+    ctx.biomes = biomeGrid.biomes;
+
+    for (int32_t lx = 0; lx < 16; ++lx) {
+        for (int32_t lz = 0; lz < 16; ++lz) {
+            int32_t idx = GenerationContext::hmIndex(lx, lz);
+            int32_t y = topY;
+            while (y > 0 && ctx.column.getBlock(lx, y, lz).isAir()) {
+                --y;
+            }
+            ctx.heightmap[idx] = std::max(y, 0);
+        }
     }
 }
 
 GenerationPass* GenerationPipeline::getPass(std::string_view name) const {
     auto it = std::find_if(passes_.begin(), passes_.end(),
-        [&](const auto& p) { return p->name() == name; });
-    return (it != passes_.end()) ? it->get() : nullptr;
+        [&](const auto& p) { return p.pass->name() == name; });
+    return (it != passes_.end()) ? it->pass.get() : nullptr;
+}
+
+void GenerationPipeline::resetProfile() {
+    for (auto& entry : passes_) {
+        entry.profile->runs = 0;
+        entry.profile->nanoseconds = 0;
+        entry.profile->blocksWritten = 0;
+        entry.profile->noiseSamples = 0;
+    }
 }
 
 void GenerationPipeline::sortPasses() {
     std::stable_sort(passes_.begin(), passes_.end(),
         [](const auto& a, const auto& b) {
-            return a->priority() < b->priority();
+            return a.pass->priority() < b.pass->priority();
         });
 }
 
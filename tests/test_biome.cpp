@@ -8,6 +8,7 @@
 #include "finevox/worldgen/biome.hpp"
 #include "finevox/worldgen/biome_map.hpp"
 #include "finevox/worldgen/biome_loader.hpp"
+#include "finevox/worldgen/pass_counters.hpp"
 #include "finevox/core/config_parser.hpp"
 
 #include <filesystem>
@@ -112,6 +113,40 @@ TEST_F(BiomeRegistryTest, OverwriteExisting) {
     EXPECT_EQ(registry().size(), 1u);
 }
 
+TEST_F(BiomeRegistryTest, RegisterResolvesBlockIds) {
+    BiomeProperties props;
+    props.surfaceBlock = "resolve:sand";
+    props.fillerBlock = "resolve:sandstone";
+    props.stoneBlock = "resolve:stone";
+    props.underwaterBlock = "resolve:gravel";
+    registry().registerBiome("beach", props);
+
+    const BiomeProperties* result = registry().getBiome("beach");
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->surfaceBlockId, BlockTypeId::fromName("resolve:sand"));
+    EXPECT_EQ(result->fillerBlockId, BlockTypeId::fromName("resolve:sandstone"));
+    EXPECT_EQ(result->stoneBlockId, BlockTypeId::fromName("resolve:stone"));
+    EXPECT_EQ(result->underwaterBlockId, BlockTypeId::fromName("resolve:gravel"));
+}
+
+TEST_F(BiomeRegistryTest, GenerationChangesOnRegisterAndClear) {
+    uint64_t g0 = registry().generation();
+    BiomeProperties p;
+    registry().registerBiome("plains", p);
+    uint64_t g1 = registry().generation();
+    EXPECT_NE(g1, g0);
+
+    registry().registerBiome("plains", p);  // Reload of the same biome
+    uint64_t g2 = registry().generation();
+    EXPECT_NE(g2, g1);
+
+    (void)registry().getBiome("plains");
+    EXPECT_EQ(registry().generation(), g2);
+
+    registry().clear();
+    EXPECT_NE(registry().generation(), g2);
+}
+
 TEST_F(BiomeRegistryTest, AllBiomes) {
     BiomeProperties p;
     registry().registerBiome("a", p);
@@ -343,6 +378,92 @@ TEST_F(BiomeMapTest, BlendedBiomeSecondaryValid) {
     // It's possible no blending is found in this range, that's OK
 }
 
+TEST_F(BiomeMapTest, SampleColumnMatchesPointQueries) {
+    BiomeMap map(42, registry(), 64.0f);
+
+    // Columns spanning several small cells, so borders are included
+    for (ColumnPos pos : {ColumnPos(0, 0), ColumnPos(-3, 5), ColumnPos(7, -2)}) {
+        ColumnBiomeGrid grid;
+        map.sampleColumn(pos, grid);
+        for (int32_t lx = 0; lx < 16; ++lx) {
+            for (int32_t lz = 0; lz < 16; ++lz) {
+                float x = static_cast<float>(pos.x * 16 + lx);
+                float z = static_cast<float>(pos.z * 16 + lz);
+                size_t idx = static_cast<size_t>(lx * 16 + lz);
+                auto [base, variation] = map.getTerrainParams(x, z);
+                EXPECT_EQ(grid.biomes[idx], map.getBiome(x, z));
+                EXPECT_EQ(grid.baseHeight[idx], base);
+                EXPECT_EQ(grid.heightVariation[idx], variation);
+            }
+        }
+    }
+}
+
+TEST_F(BiomeMapTest, CellCacheSharedAcrossColumns) {
+    BiomeMap map(42, registry());
+    ColumnBiomeGrid grid;
+    map.sampleColumn(ColumnPos(0, 0), grid);
+    uint64_t misses = map.stats().cellMisses.load();
+    EXPECT_GE(misses, 1u);
+    EXPECT_LE(misses, 4u);  // A 16x16 column touches at most a few 256-block cells
+
+    // The neighbor lies in the same cells
+    map.sampleColumn(ColumnPos(1, 0), grid);
+    EXPECT_GT(map.stats().cellHits.load(), 0u);
+    EXPECT_LE(map.stats().cellMisses.load(), misses + 2);
+}
+
+TEST_F(BiomeMapTest, CellCacheDroppedOnRegistryChange) {
+    BiomeMap map(42, registry());
+    auto [before, unusedVar] = map.getTerrainParams(100, 100);
+    (void)unusedVar;
+
+    // Every biome raised by 100: cached cells must not serve old heights
+    for (BiomeId id : registry().allBiomes()) {
+        BiomeProperties props = *registry().getBiome(id);
+        props.baseHeight += 100.0f;
+        registry().registerBiome(id.name(), props);
+    }
+    auto [after, unusedVar2] = map.getTerrainParams(100, 100);
+    (void)unusedVar2;
+    EXPECT_FLOAT_EQ(after, before + 100.0f);
+}
+
+TEST_F(BiomeMapTest, SampleColumnCoarseParamsInterpolate) {
+    BiomeMap map(42, registry(), 64.0f);
+    ColumnPos pos(2, -1);
+    ColumnBiomeGrid exact;
+    ColumnBiomeGrid coarse;
+    uint64_t& samples = PassCounters::current().noiseSamples;
+    uint64_t before = samples;
+    map.sampleColumn(pos, exact);
+    uint64_t exactSamples = samples - before;
+    before = samples;
+    map.sampleColumn(pos, coarse, 4);
+    uint64_t coarseSamples = samples - before;
+
+    EXPECT_EQ(coarse.biomes, exact.biomes);  // Biomes stay per block
+    // Corners, plus per-block searches only in squares on a cell border
+    EXPECT_GE(exactSamples, 256u);
+    EXPECT_GE(coarseSamples, 25u);
+    EXPECT_LT(coarseSamples, exactSamples);
+    for (int32_t lx = 0; lx < 16; ++lx) {
+        for (int32_t lz = 0; lz < 16; ++lz) {
+            size_t idx = static_cast<size_t>(lx * 16 + lz);
+            if (lx % 4 == 0 && lz % 4 == 0) {
+                EXPECT_FLOAT_EQ(coarse.baseHeight[idx], exact.baseHeight[idx]);
+                EXPECT_FLOAT_EQ(coarse.heightVariation[idx], exact.heightVariation[idx]);
+            }
+            // Interpolated between the registered extremes (60 .. 68)
+            EXPECT_GE(coarse.baseHeight[idx], 60.0f - 1e-3f);
+            EXPECT_LE(coarse.baseHeight[idx], 68.0f + 1e-3f);
+        }
+    }
+
+    EXPECT_THROW(map.sampleColumn(pos, coarse, 3), std::invalid_argument);
+    EXPECT_THROW(map.sampleColumn(pos, coarse, 0), std::invalid_argument);
+}
+
 // ============================================================================
 // BiomeLoader Tests
 // ============================================================================
@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
 #include "finevox/core/block_type.hpp"
 #include "finevox/core/world.hpp"
+#include "finevox/core/block_handler.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace finevox;
 
@@ -242,6 +248,118 @@ TEST_F(BlockTypeTest, HasTypeCheck) {
     EXPECT_FALSE(BlockRegistry::global().hasType(nonExistingId));
 }
 
+namespace {
+
+class NamedHandler : public BlockHandler {
+public:
+    explicit NamedHandler(std::string name) : name_(std::move(name)) {}
+    [[nodiscard]] std::string_view name() const override { return name_; }
+
+private:
+    std::string name_;
+};
+
+}  // namespace
+
+TEST_F(BlockTypeTest, HandlerLookupById) {
+    auto& registry = BlockRegistry::global();
+    BlockTypeId direct = BlockTypeId::fromName("test:dense_direct");
+    BlockTypeId lazy = BlockTypeId::fromName("test:dense_lazy");
+    BlockTypeId none = BlockTypeId::fromName("test:dense_none");
+
+    registry.registerHandler("test:dense_direct", std::make_unique<NamedHandler>("test:dense_direct"));
+    int factoryCalls = 0;
+    registry.registerHandlerFactory("test:dense_lazy", [&factoryCalls] {
+        ++factoryCalls;
+        return std::make_unique<NamedHandler>("test:dense_lazy");
+    });
+
+    ASSERT_NE(registry.getHandler(direct), nullptr);
+    EXPECT_EQ(registry.getHandler(direct), registry.getHandler("test:dense_direct"));
+    EXPECT_EQ(registry.getHandler(none), nullptr);
+    EXPECT_FALSE(registry.hasHandler(none));
+
+    // The factory runs once, on the first id lookup
+    EXPECT_TRUE(registry.hasHandler(lazy));
+    EXPECT_EQ(factoryCalls, 0);
+    BlockHandler* loaded = registry.getHandler(lazy);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ(loaded->name(), "test:dense_lazy");
+    EXPECT_EQ(registry.getHandler(lazy), loaded);
+    EXPECT_EQ(registry.getHandler("test:dense_lazy"), loaded);
+    EXPECT_EQ(factoryCalls, 1);
+}
+
+TEST_F(BlockTypeTest, LookupsDuringRegistration) {
+    auto& registry = BlockRegistry::global();
+    std::vector<BlockTypeId> ids;
+    for (int i = 0; i < 2000; ++i) {
+        ids.push_back(BlockTypeId::fromName("test:dense_concurrent_" + std::to_string(i)));
+    }
+
+    // Readers see either the default type or the registered one, never garbage
+    std::atomic<bool> done{false};
+    std::atomic<int> mismatches{0};
+    std::thread reader([&] {
+        while (!done.load()) {
+            for (const auto& id : ids) {
+                float hardness = registry.getType(id).hardness();
+                if (hardness != BlockRegistry::defaultType().hardness() && hardness != 7.5f) {
+                    ++mismatches;
+                }
+            }
+        }
+    });
+    for (const auto& id : ids) {
+        BlockType type;
+        type.setHardness(7.5f);
+        registry.registerType(id, type);
+    }
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(mismatches.load(), 0);
+    for (const auto& id : ids) {
+        EXPECT_TRUE(registry.hasType(id));
+        EXPECT_FLOAT_EQ(registry.getType(id).hardness(), 7.5f);
+    }
+}
+
+TEST_F(BlockTypeTest, PropertyLookupsMatchType) {
+    auto& registry = BlockRegistry::global();
+    BlockTypeId glass = BlockTypeId::fromName("test:props_glass");
+    BlockTypeId lamp = BlockTypeId::fromName("test:props_lamp");
+    BlockTypeId unregistered = BlockTypeId::fromName("test:props_unregistered");
+
+    BlockType glassType;
+    glassType.setOpaque(false).setTransparent(true).setLightAttenuation(2).setBlocksSkyLight(false);
+    registry.registerType(glass, glassType);
+
+    BlockType lampType;
+    lampType.setLightEmission(14).setHasCustomMesh(true).setWantsGameTicks(true).setWantsRandomTicks(true);
+    registry.registerType(lamp, lampType);
+
+    for (BlockTypeId id : {AIR_BLOCK_TYPE, glass, lamp, unregistered}) {
+        const BlockType& type = registry.getType(id);
+        EXPECT_EQ(registry.isOpaque(id), type.isOpaque());
+        EXPECT_EQ(registry.isTransparent(id), type.isTransparent());
+        EXPECT_EQ(registry.blocksSkyLight(id), type.blocksSkyLight());
+        EXPECT_EQ(registry.lightAttenuation(id), type.lightAttenuation());
+        EXPECT_EQ(registry.lightEmission(id), type.lightEmission());
+        EXPECT_EQ(registry.hasCustomMesh(id), type.hasCustomMesh());
+        EXPECT_EQ(registry.wantsGameTicks(id), type.wantsGameTicks());
+        EXPECT_EQ(registry.wantsRandomTicks(id), type.wantsRandomTicks());
+    }
+
+    EXPECT_FALSE(registry.isOpaque(glass));
+    EXPECT_EQ(registry.lightAttenuation(glass), 2);
+    EXPECT_EQ(registry.lightEmission(lamp), 14);
+    EXPECT_TRUE(registry.wantsGameTicks(lamp));
+    EXPECT_TRUE(registry.isOpaque(unregistered));
+    EXPECT_EQ(registry.lightAttenuation(unregistered), 15);
+    EXPECT_FALSE(registry.isOpaque(AIR_BLOCK_TYPE));
+}
+
 // ============================================================================
 // BlockShapeProvider Tests
 // ============================================================================
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include "finevox/core/chunk_column.hpp"
+#include "finevox/core/column_bulk_writer.hpp"
+
+#include <random>
 
 using namespace finevox;
 
@@ -328,3 +331,135 @@ TEST(ChunkColumnTest, LargeYValues) {
     EXPECT_EQ(column.getBlock(0, 2000, 0), stone);
     EXPECT_EQ(column.getBlock(0, -2000, 0), stone);
 }
+
+// ============================================================================
+// ColumnBulkWriter tests
+// ============================================================================
+
+namespace {
+
+void expectSameBlocks(const ChunkColumn& a, const ChunkColumn& b, int32_t minY, int32_t maxY) {
+    for (int32_t y = minY; y < maxY; ++y) {
+        for (int32_t z = 0; z < 16; ++z) {
+            for (int32_t x = 0; x < 16; ++x) {
+                ASSERT_EQ(a.getBlock(x, y, z), b.getBlock(x, y, z)) << x << "," << y << "," << z;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST(ColumnBulkWriterTest, MatchesPerBlockWrites) {
+    auto stone = BlockTypeId::fromName("bulk:stone");
+    auto dirt = BlockTypeId::fromName("bulk:dirt");
+    auto grass = BlockTypeId::fromName("bulk:grass");
+    std::array<BlockTypeId, 4> types = {AIR_BLOCK_TYPE, stone, dirt, grass};
+
+    ChunkColumn expected(ColumnPos(0, 0));
+    ChunkColumn bulk(ColumnPos(0, 0));
+    {
+        ColumnBulkWriter writer(bulk);
+        std::mt19937 rng(7);
+        for (int i = 0; i < 2000; ++i) {
+            int32_t x = static_cast<int32_t>(rng() % 16);
+            int32_t z = static_cast<int32_t>(rng() % 16);
+            int32_t y0 = static_cast<int32_t>(rng() % 80) - 20;
+            int32_t y1 = y0 + static_cast<int32_t>(rng() % 40);
+            BlockTypeId type = types[rng() % types.size()];
+
+            if (i % 100 == 0) {
+                writer.fillLayers(y0, y1, type);
+                for (int32_t y = y0; y < y1; ++y) {
+                    for (int32_t zz = 0; zz < 16; ++zz) {
+                        for (int32_t xx = 0; xx < 16; ++xx) {
+                            expected.setBlock(xx, y, zz, type);
+                        }
+                    }
+                }
+            } else {
+                writer.fillRun(x, z, y0, y1, type);
+                for (int32_t y = y0; y < y1; ++y) {
+                    expected.setBlock(x, y, z, type);
+                }
+            }
+        }
+    }
+
+    expectSameBlocks(expected, bulk, -32, 80);
+    EXPECT_EQ(bulk.nonAirCount(), expected.nonAirCount());
+    EXPECT_EQ(bulk.subChunkCount(), expected.subChunkCount());
+
+    // Usage counts were rebuilt: palettes agree once compacted
+    bulk.compactAll();
+    expected.compactAll();
+    expected.forEachSubChunk([&](int32_t chunkY, const SubChunk& sub) {
+        const SubChunk* other = bulk.getSubChunk(chunkY);
+        ASSERT_NE(other, nullptr);
+        EXPECT_EQ(other->palette().activeCount(), sub.palette().activeCount());
+        EXPECT_EQ(other->getUsageCounts().size(), other->palette().entries().size());
+    });
+}
+
+TEST(ColumnBulkWriterTest, ReplaceBlockOnlyWritesExpected) {
+    auto stone = BlockTypeId::fromName("bulk:stone");
+    auto ore = BlockTypeId::fromName("bulk:ore");
+    auto dirt = BlockTypeId::fromName("bulk:dirt");
+    ChunkColumn column(ColumnPos(0, 0));
+    column.setBlock(1, 5, 1, stone);
+    column.setBlock(2, 5, 1, dirt);
+
+    ColumnBulkWriter writer(column);
+    EXPECT_TRUE(writer.replaceBlock(1, 5, 1, stone, ore));
+    EXPECT_FALSE(writer.replaceBlock(1, 5, 1, stone, ore));   // already ore
+    EXPECT_FALSE(writer.replaceBlock(2, 5, 1, stone, ore));
+    EXPECT_FALSE(writer.replaceBlock(3, 5, 1, ore, dirt));    // air
+    EXPECT_TRUE(writer.replaceBlock(1, 5, 1, ore, dirt));     // sees the earlier write
+    EXPECT_FALSE(writer.replaceBlock(0, 40, 0, stone, ore));  // no subchunk
+    EXPECT_TRUE(writer.replaceBlock(0, 40, 0, AIR_BLOCK_TYPE, ore));
+    writer.finish();
+
+    EXPECT_EQ(column.getBlock(1, 5, 1), dirt);
+    EXPECT_EQ(column.getBlock(2, 5, 1), dirt);
+    EXPECT_EQ(column.getBlock(0, 40, 0), ore);
+    EXPECT_EQ(column.nonAirCount(), 3);
+}
+
+TEST(ColumnBulkWriterTest, FillLayersUsesWholeSubChunks) {
+    auto stone = BlockTypeId::fromName("bulk:stone");
+    ChunkColumn column(ColumnPos(0, 0));
+    ColumnBulkWriter writer(column);
+    writer.fillLayers(0, 40, stone);
+    writer.finish();
+
+    EXPECT_EQ(column.subChunkCount(), 3u);
+    EXPECT_EQ(column.getSubChunk(0)->nonAirCount(), SubChunk::VOLUME);
+    EXPECT_EQ(column.getSubChunk(1)->nonAirCount(), SubChunk::VOLUME);
+    EXPECT_EQ(column.getSubChunk(2)->nonAirCount(), 8 * 256);
+    EXPECT_EQ(column.getBlock(15, 39, 15), stone);
+    EXPECT_TRUE(column.getBlock(0, 40, 0).isAir());
+}
+
+TEST(ColumnBulkWriterTest, FinishBumpsVersionAndPrunesEmpty) {
+    auto stone = BlockTypeId::fromName("bulk:stone");
+    ChunkColumn column(ColumnPos(0, 0));
+    column.setBlock(3, 20, 3, stone);
+    column.setBlock(3, 40, 3, stone);
+    uint64_t version = column.getSubChunk(2)->blockVersion();
+
+    ColumnBulkWriter writer(column);
+    writer.setBlock(3, 20, 3, AIR_BLOCK_TYPE);   // empties subchunk 1
+    writer.fillRun(0, 0, 32, 48, stone);
+    writer.fillRun(5, 5, 100, 120, AIR_BLOCK_TYPE);  // no subchunk there: no-op
+
+    // Blocks are readable before finish()
+    EXPECT_EQ(column.getBlock(0, 47, 0), stone);
+    EXPECT_EQ(column.getSubChunk(2)->blockVersion(), version);
+
+    writer.finish();
+    EXPECT_EQ(column.getSubChunk(2)->blockVersion(), version + 1);
+    EXPECT_EQ(column.getSubChunk(2)->nonAirCount(), 17);
+    EXPECT_FALSE(column.hasSubChunk(1));
+    EXPECT_FALSE(column.hasSubChunk(6));
+    EXPECT_FALSE(column.hasSubChunk(7));
+}
@@ -55,6 +55,17 @@ TEST_F(ConfigTest, ModifyAndSave) {
     EXPECT_TRUE(std::filesystem::exists(configPath));
 }
 
+TEST_F(ConfigTest, CompressionHCLevelClamped) {
+    ConfigManager::instance().init(tempDir / "config.cbor");
+
+    ConfigManager::instance().setCompressionHCLevel(7);
+    EXPECT_EQ(ConfigManager::instance().compressionHCLevel(), 7);
+    ConfigManager::instance().setCompressionHCLevel(0);
+    EXPECT_EQ(ConfigManager::instance().compressionHCLevel(), 3);
+    ConfigManager::instance().setCompressionHCLevel(99);
+    EXPECT_EQ(ConfigManager::instance().compressionHCLevel(), 12);
+}
+
 TEST_F(ConfigTest, GenericSetGet) {
     auto configPath = tempDir / "config.cbor";
 
@@ -4,6 +4,12 @@
 #include "finevox/core/block_type.hpp"
 #include "finevox/core/block_handler.hpp"  // For TickType
 #include "finevox/core/world.hpp"
+#include "finevox/core/tick_wheel.hpp"
+#include "finevox/core/data_container.hpp"
+
+#include <algorithm>
+#include <random>
+#include <span>
 
 using namespace finevox;
 
@@ -110,6 +116,37 @@ TEST(EventOutboxTest, DifferentEventTypesKeptSeparate) {
     EXPECT_TRUE(hasBlockPlaced);
 }
 
+TEST(EventOutboxTest, SwapKeepsFirstPushOrderAcrossRounds) {
+    EventOutbox outbox;
+
+    // Enough keys to grow the table several times, every one pushed twice
+    for (int round = 0; round < 3; ++round) {
+        std::vector<BlockPos> order;
+        for (int i = 0; i < 1000; ++i) {
+            BlockPos pos{(i * 37) % 101 - 50, i / 101 + round, -i};
+            order.push_back(pos);
+            BlockEvent event = BlockEvent::neighborChanged(pos, Face::PosX);
+            event.addNeighborFace(Face::PosX);
+            outbox.push(event);
+        }
+        for (const BlockPos& pos : order) {
+            BlockEvent event = BlockEvent::neighborChanged(pos, Face::NegZ);
+            event.addNeighborFace(Face::NegZ);
+            outbox.push(event);
+        }
+        ASSERT_EQ(outbox.size(), order.size());
+
+        std::vector<BlockEvent> inbox;
+        outbox.swapTo(inbox);
+        ASSERT_TRUE(outbox.empty());
+        ASSERT_EQ(inbox.size(), order.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            EXPECT_EQ(inbox[i].pos, order[i]);
+            EXPECT_EQ(inbox[i].changedNeighborCount(), 2);
+        }
+    }
+}
+
 // ============================================================================
 // BlockEvent Face Mask Tests
 // ============================================================================
@@ -431,6 +468,666 @@ TEST(ScheduledTickTest, Ordering) {
     EXPECT_TRUE(tick3 > tick1);   // 200 > 100
 }
 
+// ============================================================================
+// TickWheel Tests
+// ============================================================================
+
+TEST(TickWheelTest, SameTickFiresInScheduleOrder) {
+    TickWheel wheel;
+    wheel.schedule(BlockPos{3, 0, 0}, 10, TickType::Scheduled);
+    wheel.schedule(BlockPos{1, 0, 0}, 10, TickType::Repeat);
+    wheel.schedule(BlockPos{2, 0, 0}, 5, TickType::Scheduled);
+    wheel.schedule(BlockPos{0, 0, 0}, 10, TickType::Scheduled);
+
+    std::vector<ScheduledTick> due;
+    wheel.advanceTo(9, due);
+    ASSERT_EQ(due.size(), 1);
+    EXPECT_EQ(due[0].pos, (BlockPos{2, 0, 0}));
+
+    due.clear();
+    wheel.advanceTo(10, due);
+    ASSERT_EQ(due.size(), 3);
+    EXPECT_EQ(due[0].pos, (BlockPos{3, 0, 0}));
+    EXPECT_EQ(due[1].pos, (BlockPos{1, 0, 0}));
+    EXPECT_EQ(due[1].type, TickType::Repeat);
+    EXPECT_EQ(due[2].pos, (BlockPos{0, 0, 0}));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TickWheelTest, LongDelaysFireOnTime) {
+    // One target per level boundary, plus one in the overflow list
+    std::vector<uint64_t> targets = {1, 255, 256, 257, 16383, 16384, 16385,
+                                     (1u << 20) - 1, 1u << 20, (1u << 26) + 7};
+    TickWheel wheel;
+    for (size_t i = 0; i < targets.size(); ++i) {
+        wheel.schedule(BlockPos{static_cast<int32_t>(i), 0, 0}, targets[i], TickType::Scheduled);
+    }
+
+    std::vector<ScheduledTick> due;
+    for (size_t i = 0; i < targets.size(); ++i) {
+        wheel.advanceTo(targets[i] - 1, due);
+        EXPECT_TRUE(due.empty()) << "target " << targets[i] << " fired early";
+        wheel.advanceTo(targets[i], due);
+        ASSERT_EQ(due.size(), 1) << "target " << targets[i];
+        EXPECT_EQ(due[0].targetTick, targets[i]);
+        due.clear();
+    }
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TickWheelTest, PastTargetsFireOnNextAdvance) {
+    TickWheel wheel(100);
+    wheel.schedule(BlockPos{0, 0, 0}, 40, TickType::Scheduled);
+
+    std::vector<ScheduledTick> due;
+    wheel.advanceTo(101, due);
+    ASSERT_EQ(due.size(), 1);
+    EXPECT_EQ(due[0].targetTick, 101);
+}
+
+TEST(TickWheelTest, CancelAndContains) {
+    TickWheel wheel;
+    BlockPos a{1, 2, 3};
+    BlockPos b{4, 5, 6};
+    wheel.schedule(a, 5, TickType::Scheduled);
+    wheel.schedule(b, 5, TickType::Scheduled);
+    wheel.schedule(a, 5000, TickType::Repeat);
+    EXPECT_TRUE(wheel.contains(a));
+    EXPECT_EQ(wheel.size(), 3);
+
+    EXPECT_EQ(wheel.cancel(a), 2);
+    EXPECT_FALSE(wheel.contains(a));
+    EXPECT_TRUE(wheel.contains(b));
+    EXPECT_EQ(wheel.cancel(a), 0);
+    EXPECT_EQ(wheel.size(), 1);
+
+    std::vector<ScheduledTick> due;
+    wheel.advanceTo(10000, due);
+    ASSERT_EQ(due.size(), 1);
+    EXPECT_EQ(due[0].pos, b);
+    EXPECT_FALSE(wheel.contains(b));
+}
+
+TEST(TickWheelTest, MatchesSortedReference) {
+    // Reference: every pending tick with its scheduling sequence
+    struct Pending {
+        ScheduledTick tick;
+        uint64_t sequence;
+    };
+    std::vector<Pending> reference;
+    uint64_t sequence = 0;
+
+    TickWheel wheel;
+    std::mt19937 rng(1234);
+    uint64_t now = 0;
+    for (int round = 0; round < 300; ++round) {
+        for (int i = 0; i < 40; ++i) {
+            BlockPos pos{static_cast<int32_t>(rng() % 64), 0, static_cast<int32_t>(rng() % 4)};
+            uint64_t delay = (rng() % 4 == 0) ? rng() % 40000 : rng() % 300;
+            wheel.schedule(pos, now + delay, TickType::Scheduled);
+            reference.push_back({{pos, std::max(now + delay, now + 1), TickType::Scheduled}, sequence++});
+        }
+
+        BlockPos cancelled{static_cast<int32_t>(rng() % 64), 0, static_cast<int32_t>(rng() % 4)};
+        auto before = reference.size();
+        std::erase_if(reference, [&](const Pending& p) { return p.tick.pos == cancelled; });
+        EXPECT_EQ(wheel.cancel(cancelled), before - reference.size());
+
+        now += rng() % 600;
+        std::vector<ScheduledTick> due;
+        wheel.advanceTo(now, due);
+
+        std::vector<Pending> expected;
+        std::erase_if(reference, [&](const Pending& p) {
+            if (p.tick.targetTick > now) {
+                return false;
+            }
+            expected.push_back(p);
+            return true;
+        });
+        std::sort(expected.begin(), expected.end(), [](const Pending& x, const Pending& y) {
+            return x.tick.targetTick != y.tick.targetTick ? x.tick.targetTick < y.tick.targetTick
+                                                          : x.sequence < y.sequence;
+        });
+
+        ASSERT_EQ(due.size(), expected.size()) << "round " << round;
+        for (size_t i = 0; i < due.size(); ++i) {
+            EXPECT_EQ(due[i].pos, expected[i].tick.pos);
+            EXPECT_EQ(due[i].targetTick, expected[i].tick.targetTick);
+        }
+        EXPECT_EQ(wheel.size(), reference.size());
+    }
+}
+
+// ============================================================================
+// Random Tick Tests
+// ============================================================================
+
+namespace {
+
+// Counts random ticks delivered to one block type
+class RandomTickCounter : public BlockHandler {
+public:
+    explicit RandomTickCounter(std::string name) : name_(std::move(name)) {}
+    [[nodiscard]] std::string_view name() const override { return name_; }
+    void onTick(BlockContext& ctx, TickType type) override {
+        (void)ctx;
+        if (type & TickType::Random) {
+            ++randomTicks;
+        }
+    }
+    int randomTicks = 0;
+
+private:
+    std::string name_;
+};
+
+BlockTypeId randomTickType(const char* name) {
+    BlockType type;
+    type.setWantsRandomTicks(true);
+    BlockRegistry::global().registerType(name, type);
+    return BlockTypeId::fromName(name);
+}
+
+}  // namespace
+
+TEST(RandomTickTest, SubChunkTracksPaletteMembership) {
+    BlockTypeId grass = randomTickType("randomticktest:grass");
+    BlockTypeId stone = BlockTypeId::fromName("randomticktest:stone");
+
+    SubChunk chunk;
+    chunk.setBlock(0, stone);
+    EXPECT_FALSE(chunk.hasRandomTickBlocks());
+
+    chunk.setBlock(1, grass);
+    chunk.setBlock(2, grass);
+    EXPECT_TRUE(chunk.hasRandomTickBlocks());
+    EXPECT_TRUE(chunk.wantsRandomTick(1));
+    EXPECT_FALSE(chunk.wantsRandomTick(0));
+    EXPECT_FALSE(chunk.wantsRandomTick(3));
+
+    chunk.setBlock(1, AIR_BLOCK_TYPE);
+    EXPECT_TRUE(chunk.hasRandomTickBlocks());
+    chunk.setBlock(2, stone);
+    EXPECT_FALSE(chunk.hasRandomTickBlocks());
+
+    chunk.fill(grass);
+    EXPECT_TRUE(chunk.hasRandomTickBlocks());
+    EXPECT_TRUE(chunk.wantsRandomTick(4095));
+    chunk.clear();
+    EXPECT_FALSE(chunk.hasRandomTickBlocks());
+}
+
+TEST(RandomTickTest, WorldMaintainsRandomTickSet) {
+    BlockTypeId grass = randomTickType("randomticktest:grass");
+    BlockTypeId stone = BlockTypeId::fromName("randomticktest:stone");
+
+    World world;
+    world.setBlock(BlockPos{1, 1, 1}, stone);
+    world.setBlock(BlockPos{40, 1, 1}, grass);
+    EXPECT_EQ(world.randomTickSet().size(), 1);
+    EXPECT_TRUE(world.randomTickSet().contains(ChunkPos{2, 0, 0}));
+
+    world.setBlock(BlockPos{40, 1, 1}, AIR_BLOCK_TYPE);
+    EXPECT_EQ(world.randomTickSet().size(), 0);
+
+    world.setBlock(BlockPos{40, 1, 1}, grass);
+    world.setBlock(BlockPos{40, 100, 1}, grass);
+    EXPECT_EQ(world.randomTickSet().size(), 2);
+    world.removeColumn(ColumnPos{2, 0});
+    EXPECT_EQ(world.randomTickSet().size(), 0);
+
+    // Bulk writes recount membership when they finish
+    SubChunk& subChunk = world.getOrCreateColumn(ColumnPos{0, 0}).getOrCreateSubChunk(3);
+    SubChunk::LocalIndex grassIndex = subChunk.bulkPaletteIndex(grass);
+    subChunk.bulkSetCounted(7, grassIndex);
+    subChunk.endSparseWrite();
+    EXPECT_TRUE(world.randomTickSet().contains(ChunkPos{0, 3, 0}));
+}
+
+TEST(RandomTickTest, OnlyInterestedBlocksReceiveTicks) {
+    BlockTypeId grass = randomTickType("randomticktest:counted_grass");
+    BlockTypeId stone = BlockTypeId::fromName("randomticktest:counted_stone");
+    auto grassHandler = std::make_unique<RandomTickCounter>("randomticktest:counted_grass");
+    auto stoneHandler = std::make_unique<RandomTickCounter>("randomticktest:counted_stone");
+    RandomTickCounter* grassCounter = grassHandler.get();
+    RandomTickCounter* stoneCounter = stoneHandler.get();
+    BlockRegistry::global().registerHandler("randomticktest:counted_grass", std::move(grassHandler));
+    BlockRegistry::global().registerHandler("randomticktest:counted_stone", std::move(stoneHandler));
+
+    // One subchunk of each, and one mixed
+    World world;
+    world.getOrCreateColumn(ColumnPos{0, 0}).getOrCreateSubChunk(0).fill(grass);
+    world.getOrCreateColumn(ColumnPos{1, 0}).getOrCreateSubChunk(0).fill(stone);
+    SubChunk& mixed = world.getOrCreateColumn(ColumnPos{2, 0}).getOrCreateSubChunk(0);
+    for (int32_t i = 0; i < SubChunk::VOLUME; ++i) {
+        mixed.setBlock(static_cast<uint16_t>(i), i % 2 ? grass : stone);
+    }
+    EXPECT_EQ(world.randomTickSet().size(), 2);
+
+    UpdateScheduler scheduler(world);
+    TickConfig config;
+    config.randomSeed = 99;
+    config.randomTicksPerSubchunk = 16;
+    config.gameTicksEnabled = false;
+    scheduler.setTickConfig(config);
+
+    for (int tick = 0; tick < 20; ++tick) {
+        scheduler.advanceGameTick();
+        scheduler.processEvents();
+    }
+
+    EXPECT_EQ(stoneCounter->randomTicks, 0);
+    // 20 ticks x 16 attempts into the grass subchunk, about half in the mixed one
+    EXPECT_GT(grassCounter->randomTicks, 320);
+    EXPECT_LT(grassCounter->randomTicks, 640);
+}
+
+TEST(RandomTickTest, SameSeedSameTicks) {
+    BlockTypeId grass = randomTickType("randomticktest:grass");
+
+    World world;
+    for (int32_t cx = 0; cx < 4; ++cx) {
+        SubChunk& subChunk = world.getOrCreateColumn(ColumnPos{cx, 0}).getOrCreateSubChunk(0);
+        for (int32_t i = 0; i < SubChunk::VOLUME; i += 3) {
+            subChunk.setBlock(static_cast<uint16_t>(i), grass);
+        }
+    }
+
+    TickConfig config;
+    config.randomSeed = 1234;
+    config.randomTicksPerSubchunk = 8;
+    config.gameTicksEnabled = false;
+
+    UpdateScheduler a(world);
+    UpdateScheduler b(world);
+    a.setTickConfig(config);
+    b.setTickConfig(config);
+    for (int tick = 0; tick < 5; ++tick) {
+        a.advanceGameTick();
+        b.advanceGameTick();
+        EXPECT_EQ(a.pendingEventCount(), b.pendingEventCount());
+    }
+    EXPECT_GT(a.pendingEventCount(), 0);
+}
+
+// ============================================================================
+// Parallel Event Processing Tests
+// ============================================================================
+
+namespace {
+
+// Region-safe: counts updates in its own data, spins its own rotation and
+// passes updates along +X through the context
+class ParallelWire : public BlockHandler {
+public:
+    [[nodiscard]] std::string_view name() const override { return "paralleltest:wire"; }
+    [[nodiscard]] bool isRegionSafe() const override { return true; }
+
+    void onBlockUpdate(BlockContext& ctx) override {
+        DataContainer& data = ctx.getOrCreateData();
+        auto hits = data.get<int64_t>("hits") + 1;
+        data.set("hits", hits);
+        if (hits < 4 && ctx.getNeighbor(Face::PosX) == ctx.blockType()) {
+            ctx.pushEvent(BlockEvent::blockUpdate(ctx.pos().neighbor(Face::PosX)));
+        }
+        ctx.scheduleTick(static_cast<int>(hits));
+    }
+
+    void onTick(BlockContext& ctx, TickType type) override {
+        (void)type;
+        ctx.setRotationIndex(static_cast<uint8_t>((ctx.rotationIndex() + 1) % 24));
+        if (ctx.rotationIndex() == 3) {
+            ctx.notifyNeighbors();
+        }
+    }
+};
+
+// Not region-safe: counts neighbor notifications in instance state
+class SerialListener : public BlockHandler {
+public:
+    [[nodiscard]] std::string_view name() const override { return "paralleltest:listener"; }
+    void onNeighborChanged(BlockContext& ctx, Face face) override {
+        (void)ctx;
+        (void)face;
+        ++notifications;
+    }
+    void onBlockUpdate(BlockContext& ctx) override {
+        (void)ctx;
+        ++updates;
+    }
+    int notifications = 0;
+    int updates = 0;
+};
+
+SerialListener* parallelTestListener() {
+    static SerialListener* listener = [] {
+        BlockRegistry::global().registerHandler("paralleltest:wire", std::make_unique<ParallelWire>());
+        auto handler = std::make_unique<SerialListener>();
+        SerialListener* raw = handler.get();
+        BlockRegistry::global().registerHandler("paralleltest:listener", std::move(handler));
+        return raw;
+    }();
+    return listener;
+}
+
+// Rows of wire crossing several 32-block regions, a listener above every
+// fourth wire block
+std::vector<BlockPos> buildWireWorld(World& world) {
+    BlockTypeId wire = BlockTypeId::fromName("paralleltest:wire");
+    BlockTypeId listener = BlockTypeId::fromName("paralleltest:listener");
+    std::vector<BlockPos> wires;
+    for (int32_t z = 0; z < 96; z += 5) {
+        for (int32_t x = -40; x < 100; ++x) {
+            BlockPos pos(x, 10 + z % 20, z);
+            world.setBlock(pos, wire);
+            wires.push_back(pos);
+            if (x % 4 == 0) {
+                world.setBlock(pos.neighbor(Face::PosY), listener);
+            }
+        }
+    }
+    return wires;
+}
+
+struct WireSnapshot {
+    std::vector<uint8_t> rotations;
+    std::vector<int64_t> hits;
+    size_t scheduledTicks = 0;
+    int notifications = 0;
+
+    bool operator==(const WireSnapshot&) const = default;
+};
+
+WireSnapshot runWires(const ParallelEventConfig& parallel, uint64_t* parallelEvents = nullptr) {
+    SerialListener* listener = parallelTestListener();
+    listener->notifications = 0;
+
+    World world;
+    std::vector<BlockPos> wires = buildWireWorld(world);
+
+    UpdateScheduler scheduler(world);
+    TickConfig config;
+    config.randomTicksEnabled = false;
+    config.gameTicksEnabled = false;
+    scheduler.setTickConfig(config);
+    scheduler.setParallelConfig(parallel);
+
+    for (const BlockPos& pos : wires) {
+        scheduler.pushExternalEvent(BlockEvent::blockUpdate(pos));
+    }
+    scheduler.processEvents();
+    for (int tick = 0; tick < 8; ++tick) {
+        scheduler.advanceGameTick();
+        scheduler.processEvents();
+    }
+
+    WireSnapshot snapshot;
+    for (const BlockPos& pos : wires) {
+        SubChunk* subchunk = world.getSubChunk(ChunkPos::fromBlock(pos));
+        LocalBlockPos local = pos.local();
+        snapshot.rotations.push_back(subchunk->getRotationIndex(local));
+        const DataContainer* data = subchunk->blockData(local.x, local.y, local.z);
+        snapshot.hits.push_back(data ? data->get<int64_t>("hits") : 0);
+    }
+    snapshot.scheduledTicks = scheduler.scheduledTickCount();
+    snapshot.notifications = listener->notifications;
+    if (parallelEvents) {
+        *parallelEvents = scheduler.parallelEventCount();
+    }
+    return snapshot;
+}
+
+}  // namespace
+
+TEST(ParallelEventTest, SameWorldForAnyThreadCount) {
+    ParallelEventConfig parallel;
+    parallel.enabled = true;
+    parallel.minBatch = 1;
+
+    parallel.threads = 1;
+    uint64_t oneThreadParallel = 0;
+    WireSnapshot oneThread = runWires(parallel, &oneThreadParallel);
+
+    parallel.threads = 4;
+    uint64_t fourThreadParallel = 0;
+    WireSnapshot fourThreads = runWires(parallel, &fourThreadParallel);
+
+    EXPECT_EQ(oneThread, fourThreads);
+    EXPECT_EQ(oneThreadParallel, fourThreadParallel);
+    EXPECT_GT(fourThreadParallel, 0u);
+    EXPECT_GT(fourThreads.notifications, 0);
+}
+
+TEST(ParallelEventTest, MatchesSerialForRegionLocalHandlers) {
+    // The wire handler's outcome does not depend on event order, so the
+    // opt-in mode must reach the same world as the default path
+    WireSnapshot serial = runWires(ParallelEventConfig{});
+
+    ParallelEventConfig parallel;
+    parallel.enabled = true;
+    parallel.minBatch = 1;
+    parallel.threads = 3;
+    WireSnapshot regions = runWires(parallel);
+
+    EXPECT_EQ(serial, regions);
+}
+
+TEST(ParallelEventTest, UnsafeAndBorderEventsStaySerial) {
+    SerialListener* listener = parallelTestListener();
+    listener->updates = 0;
+    BlockTypeId wire = BlockTypeId::fromName("paralleltest:wire");
+    BlockTypeId listenerType = BlockTypeId::fromName("paralleltest:listener");
+
+    World world;
+    world.setBlock(BlockPos(8, 8, 8), listenerType);   // Interior, not region-safe
+    world.setBlock(BlockPos(31, 8, 8), wire);          // Region-safe, on a region face
+    world.setBlock(BlockPos(40, 8, 40), wire);         // Region-safe, interior
+
+    UpdateScheduler scheduler(world);
+    ParallelEventConfig parallel;
+    parallel.enabled = true;
+    parallel.minBatch = 1;
+    scheduler.setParallelConfig(parallel);
+
+    scheduler.pushExternalEvent(BlockEvent::blockUpdate(BlockPos(8, 8, 8)));
+    scheduler.pushExternalEvent(BlockEvent::blockUpdate(BlockPos(31, 8, 8)));
+    scheduler.pushExternalEvent(BlockEvent::blockUpdate(BlockPos(40, 8, 40)));
+    EXPECT_EQ(scheduler.processEvents(), 3u);
+
+    EXPECT_EQ(scheduler.parallelEventCount(), 1u);
+    EXPECT_EQ(listener->updates, 1);
+    EXPECT_TRUE(scheduler.hasScheduledTick(BlockPos(31, 8, 8)));
+    EXPECT_TRUE(scheduler.hasScheduledTick(BlockPos(40, 8, 40)));
+}
+
+namespace {
+
+// Region-safe: an update burns the block away
+class ParallelFuse : public BlockHandler {
+public:
+    [[nodiscard]] std::string_view name() const override { return "paralleltest:fuse"; }
+    [[nodiscard]] bool isRegionSafe() const override { return true; }
+    void onBlockUpdate(BlockContext& ctx) override { ctx.setBlock(AIR_BLOCK_TYPE); }
+};
+
+}  // namespace
+
+TEST(ParallelEventTest, CountsOnlyDispatchedEventsAcrossBatches) {
+    static const bool registered = BlockRegistry::global().registerHandler(
+        "paralleltest:fuse", std::make_unique<ParallelFuse>());
+    (void)registered;
+    BlockTypeId fuse = BlockTypeId::fromName("paralleltest:fuse");
+
+    World world;
+    UpdateScheduler scheduler(world);
+    ParallelEventConfig parallel;
+    parallel.enabled = true;
+    parallel.minBatch = 1;
+    parallel.threads = 3;
+    scheduler.setParallelConfig(parallel);
+
+    // Same workers across batches; the second update of each fuse finds air
+    for (int round = 1; round <= 4; ++round) {
+        for (int32_t r = 0; r < 3; ++r) {
+            BlockPos pos(8 + 32 * r, 8, 8 + 32 * round);
+            world.setBlock(pos, fuse);
+            scheduler.pushExternalEvent(BlockEvent::blockUpdate(pos));
+            scheduler.pushExternalEvent(BlockEvent::blockUpdate(pos));
+        }
+        EXPECT_EQ(scheduler.processEvents(), 6u);
+        EXPECT_EQ(scheduler.parallelEventCount(), 3u * static_cast<uint64_t>(round));
+    }
+}
+
+// ============================================================================
+// Batched Tick Tests
+// ============================================================================
+
+namespace {
+
+// Opts in to batches; records each batch and grows its block one stage per tick
+class BatchedCrop : public BlockHandler {
+public:
+    [[nodiscard]] std::string_view name() const override { return "batchtest:crop"; }
+    [[nodiscard]] bool wantsTickBatches() const override { return true; }
+
+    void onTickBatch(std::span<BlockContext> blocks, TickType type) override {
+        (void)type;
+        batchSizes.push_back(blocks.size());
+        for (BlockContext& ctx : blocks) {
+            onTick(ctx, type);
+        }
+    }
+
+    void onTick(BlockContext& ctx, TickType type) override {
+        (void)type;
+        DataContainer& data = ctx.getOrCreateData();
+        data.set("stage", data.get<int64_t>("stage") + 1);
+    }
+
+    std::vector<size_t> batchSizes;
+};
+
+// Default per-event path
+class PlainCrop : public BlockHandler {
+public:
+    [[nodiscard]] std::string_view name() const override { return "batchtest:plain"; }
+    void onTick(BlockContext& ctx, TickType type) override {
+        (void)ctx;
+        (void)type;
+        ++ticks;
+    }
+    int ticks = 0;
+};
+
+std::pair<BatchedCrop*, PlainCrop*> batchTestHandlers() {
+    static auto handlers = [] {
+        auto crop = std::make_unique<BatchedCrop>();
+        auto plain = std::make_unique<PlainCrop>();
+        std::pair raw{crop.get(), plain.get()};
+        BlockRegistry::global().registerHandler("batchtest:crop", std::move(crop));
+        BlockRegistry::global().registerHandler("batchtest:plain", std::move(plain));
+        return raw;
+    }();
+    handlers.first->batchSizes.clear();
+    handlers.second->ticks = 0;
+    return handlers;
+}
+
+}  // namespace
+
+TEST(BatchedTickTest, GroupsBySubchunkTypeAndTickKind) {
+    auto [crop, plain] = batchTestHandlers();
+
+    BlockTypeId cropType = BlockTypeId::fromName("batchtest:crop");
+    BlockTypeId plainType = BlockTypeId::fromName("batchtest:plain");
+    World world;
+    UpdateScheduler scheduler(world);
+    for (int32_t x = 0; x < 5; ++x) {
+        world.setBlock(BlockPos(x, 1, 1), cropType);           // Subchunk (0,0,0)
+        world.setBlock(BlockPos(x, 1, 20), cropType);          // Subchunk (0,0,1)
+        world.setBlock(BlockPos(x, 3, 3), plainType);
+        scheduler.pushExternalEvent(BlockEvent::tick(BlockPos(x, 1, 1), TickType::Random));
+        scheduler.pushExternalEvent(BlockEvent::tick(BlockPos(x, 1, 20), TickType::Random));
+        scheduler.pushExternalEvent(BlockEvent::tick(BlockPos(x, 3, 3), TickType::Random));
+    }
+    scheduler.pushExternalEvent(BlockEvent::tick(BlockPos(0, 1, 1), TickType::Scheduled));
+
+    EXPECT_EQ(scheduler.processEvents(), 16u);
+
+    std::vector<size_t> sizes = crop->batchSizes;
+    std::sort(sizes.begin(), sizes.end());
+    EXPECT_EQ(sizes, (std::vector<size_t>{1, 5, 5}));
+    EXPECT_EQ(scheduler.batchedTickCount(), 11u);
+    EXPECT_EQ(plain->ticks, 5);
+
+    const DataContainer* data = world.getSubChunk(ChunkPos(0, 0, 0))->blockData(0, 1, 1);
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(data->get<int64_t>("stage"), 2);
+}
+
+TEST(BatchedTickTest, ReplacedBlockUsesNewHandler) {
+    auto [crop, plain] = batchTestHandlers();
+    BlockTypeId cropType = BlockTypeId::fromName("batchtest:crop");
+    BlockTypeId plainType = BlockTypeId::fromName("batchtest:plain");
+    World world;
+    UpdateScheduler scheduler(world);
+    world.setBlock(BlockPos(2, 2, 2), cropType);
+    world.setBlock(BlockPos(3, 2, 2), cropType);
+
+    // The inbox drains from the back: both ticks are queued for the batch,
+    // then one block is replaced before the batch is delivered
+    scheduler.pushExternalEvent(BlockEvent::blockPlaced(BlockPos(3, 2, 2), plainType, cropType));
+    scheduler.pushExternalEvent(BlockEvent::tick(BlockPos(2, 2, 2), TickType::Random));
+    scheduler.pushExternalEvent(BlockEvent::tick(BlockPos(3, 2, 2), TickType::Random));
+    scheduler.processEvents();
+
+    EXPECT_EQ(crop->batchSizes, std::vector<size_t>{1});
+    EXPECT_EQ(scheduler.batchedTickCount(), 1u);
+    EXPECT_EQ(plain->ticks, 1);
+}
+
+TEST(BatchedTickTest, RegionSafeBatchHandlerStaysSerialInParallelMode) {
+    // Region-safe too, so only the batching opt-in keeps it off the workers
+    class RegionSafeCrop : public BatchedCrop {
+    public:
+        [[nodiscard]] std::string_view name() const override { return "batchtest:safecrop"; }
+        [[nodiscard]] bool isRegionSafe() const override { return true; }
+    };
+    static RegionSafeCrop* crop = [] {
+        auto handler = std::make_unique<RegionSafeCrop>();
+        RegionSafeCrop* raw = handler.get();
+        BlockRegistry::global().registerHandler("batchtest:safecrop", std::move(handler));
+        return raw;
+    }();
+    crop->batchSizes.clear();
+
+    BlockTypeId cropType = BlockTypeId::fromName("batchtest:safecrop");
+    World world;
+    UpdateScheduler scheduler(world);
+    ParallelEventConfig parallel;
+    parallel.enabled = true;
+    parallel.minBatch = 1;
+    parallel.threads = 2;
+    scheduler.setParallelConfig(parallel);
+
+    // Interior of one region, and of a second one
+    for (int32_t x = 4; x < 10; ++x) {
+        for (BlockPos pos : {BlockPos(x, 4, 4), BlockPos(x + 32, 4, 4)}) {
+            world.setBlock(pos, cropType);
+            scheduler.pushExternalEvent(BlockEvent::tick(pos, TickType::Random));
+        }
+    }
+    EXPECT_EQ(scheduler.processEvents(), 12u);
+
+    EXPECT_EQ(scheduler.parallelEventCount(), 0u);
+    EXPECT_EQ(scheduler.batchedTickCount(), 12u);
+    std::vector<size_t> sizes = crop->batchSizes;
+    std::sort(sizes.begin(), sizes.end());
+    EXPECT_EQ(sizes, (std::vector<size_t>{6, 6}));
+}
+
 // ============================================================================
 // Auto-Registration Tests
 // ============================================================================
@@ -11,6 +11,10 @@
 #include "finevox/worldgen/feature_schematic.hpp"
 #include "finevox/worldgen/feature_registry.hpp"
 #include "finevox/worldgen/feature_loader.hpp"
+#include "finevox/worldgen/feature_write_buffer.hpp"
+#include "finevox/worldgen/world_generator.hpp"
+#include "finevox/worldgen/biome_map.hpp"
+#include "finevox/core/chunk_column.hpp"
 #include "finevox/core/config_parser.hpp"
 #include "finevox/core/world.hpp"
 #include "finevox/core/block_type.hpp"
@@ -354,6 +358,72 @@ TEST_F(SchematicFeatureTest, NullSchematicFails) {
     EXPECT_EQ(feature.place(ctx), FeatureResult::Failed);
 }
 
+// ============================================================================
+// Deferred cross-column writes
+// ============================================================================
+
+class FeatureWriteBufferTest : public FeatureTestBase {};
+
+TEST_F(FeatureWriteBufferTest, FlushOrdersBySourceAndChecksConditions) {
+    FeatureWriteBuffer buffer;
+    ChunkColumn column(ColumnPos(0, 0));
+    column.setBlock(1, 10, 1, stoneId_);
+
+    // Queued out of source order, as racing threads would
+    BlockPos p(1, 10, 1);
+    EXPECT_TRUE(buffer.add({ColumnPos(1, 0), 0, p, dirtId_, stoneId_, true}));
+    EXPECT_TRUE(buffer.add({ColumnPos(-1, 0), 1, p, grassId_, AIR_BLOCK_TYPE, true}));
+    EXPECT_TRUE(buffer.add({ColumnPos(-1, 0), 0, p, ironOreId_, stoneId_, true}));
+    EXPECT_TRUE(buffer.add({ColumnPos(0, 1), 0, BlockPos(2, 5, 2), oakLogId_, {}, false}));
+    EXPECT_EQ(buffer.pendingWrites(), 4u);
+
+    // (-1,0) #0 replaces stone with ore, (-1,0) #1 finds no air, (1,0)
+    // finds ore instead of stone; the unconditional write always lands
+    EXPECT_EQ(buffer.flush(ColumnPos(0, 0), column), 2u);
+    EXPECT_EQ(column.getBlock(1, 10, 1), ironOreId_);
+    EXPECT_EQ(column.getBlock(2, 5, 2), oakLogId_);
+    EXPECT_EQ(buffer.stats().rejected.load(), 2u);
+    EXPECT_EQ(buffer.pendingWrites(), 0u);
+
+    // Flushed columns refuse further writes; the caller writes directly
+    EXPECT_TRUE(buffer.isFlushed(ColumnPos(0, 0)));
+    EXPECT_FALSE(buffer.add({ColumnPos(1, 0), 1, p, dirtId_, {}, false}));
+    EXPECT_TRUE(buffer.add({ColumnPos(0, 0), 0, BlockPos(16, 1, 0), dirtId_, {}, false}));
+}
+
+TEST_F(FeatureWriteBufferTest, TreeAtColumnEdgeQueuesNeighborLeaves) {
+    auto world = createFlatWorld();
+    BiomeMap biomeMap(42, BiomeRegistry::global());
+    FeatureWriteBuffer buffer;
+    GenerationContext gen{world->getOrCreateColumn(ColumnPos(0, 0)), ColumnPos(0, 0), *world,
+                          biomeMap, 42, {}, {}, &buffer};
+
+    TreeConfig config;
+    config.trunkBlock = oakLogId_;
+    config.leavesBlock = oakLeavesId_;
+    config.minTrunkHeight = 5;
+    config.maxTrunkHeight = 5;
+    config.leafRadius = 2;
+    TreeFeature tree("oak_tree", config);
+
+    // Trunk on the column's east edge: the canopy reaches into column (1, 0)
+    FeaturePlacementContext ctx{*world, BlockPos(15, 64, 8), BiomeId{}, 42, &gen};
+    EXPECT_EQ(tree.place(ctx), FeatureResult::Placed);
+    EXPECT_EQ(world->getBlock(15, 64, 8), oakLogId_);
+    EXPECT_EQ(world->getBlock(14, 68, 8), oakLeavesId_);
+
+    // Neighbor leaves are queued, not written (the column is not even created)
+    EXPECT_EQ(world->getColumn(ColumnPos(1, 0)), nullptr);
+    EXPECT_GT(buffer.pendingWrites(), 0u);
+    EXPECT_EQ(gen.pendingWriteSequence, buffer.pendingWrites());
+
+    auto& neighbor = world->getOrCreateColumn(ColumnPos(1, 0));
+    neighbor.setBlock(16, 68, 7, stoneId_);  // Generated since: no longer air
+    EXPECT_GT(buffer.flush(ColumnPos(1, 0), neighbor), 0u);
+    EXPECT_EQ(world->getBlock(16, 68, 8), oakLeavesId_);
+    EXPECT_EQ(world->getBlock(16, 68, 7), stoneId_);
+}
+
 // ============================================================================
 // FeatureRegistry Tests
 // ============================================================================
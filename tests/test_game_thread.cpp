@@ -7,9 +7,11 @@
 #include "finevox/core/graphics_event_queue.hpp"
 #include "finevox/core/block_type.hpp"
 #include "finevox/core/entity_state.hpp"
+#include "finevox/core/tick_profiler.hpp"
 
 #include <thread>
 #include <chrono>
+#include <sstream>
 
 using namespace finevox;
 using namespace std::chrono_literals;
@@ -335,3 +337,87 @@ TEST(GameThreadTest, SendPlayerState) {
     EXPECT_NEAR(player->position().y, 70.0f, 1.0f);
     EXPECT_NEAR(player->position().z, 20.0f, 1.0f);
 }
+
+// ============================================================================
+// Tick profiling
+// ============================================================================
+
+TEST(TickProfilerTest, PercentilesOverWindow) {
+    TickProfiler profiler(100);
+    auto t0 = TickProfiler::Clock::now();
+    // 1..200 ms; only the last 100 (101..200) stay in the window
+    for (int ms = 1; ms <= 200; ++ms) {
+        profiler.record(TickPhase::GameTicks, t0, t0 + std::chrono::milliseconds(ms));
+    }
+
+    TickProfileSnapshot snapshot = profiler.snapshot();
+    const TickPhaseStats& stats = snapshot[TickPhase::GameTicks];
+    EXPECT_EQ(stats.samples, 200u);
+    EXPECT_DOUBLE_EQ(stats.p50Ms, 150.0);
+    EXPECT_DOUBLE_EQ(stats.p95Ms, 195.0);
+    EXPECT_DOUBLE_EQ(stats.p99Ms, 199.0);
+    EXPECT_DOUBLE_EQ(stats.maxMs, 200.0);
+    EXPECT_DOUBLE_EQ(stats.meanMs, 150.5);
+    EXPECT_EQ(snapshot[TickPhase::Commands].samples, 0u);
+
+    profiler.addSkippedTicks(3);
+    EXPECT_EQ(profiler.snapshot().skippedTicks, 3u);
+    profiler.reset();
+    EXPECT_EQ(profiler.snapshot()[TickPhase::GameTicks].samples, 0u);
+    EXPECT_EQ(profiler.snapshot().skippedTicks, 0u);
+}
+
+TEST(TickProfilerTest, ChromeTraceKeepsMostRecentSpans) {
+    TickProfiler profiler;
+    EXPECT_EQ(profiler.traceEventCount(), 0u);
+    profiler.setTraceCapacity(4);
+
+    for (int i = 0; i < 3; ++i) {
+        profiler.beginTick();
+        { TickProfiler::Scope scope(&profiler, TickPhase::ScheduledTicks); }
+        { TickProfiler::Scope scope(&profiler, TickPhase::EntityPhysics); }
+        profiler.endTick();
+    }
+    profiler.addSkippedTicks(2);
+    EXPECT_EQ(profiler.traceEventCount(), 4u);
+
+    std::ostringstream out;
+    profiler.writeChromeTrace(out);
+    std::string json = out.str();
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0u);
+    // Oldest retained span is tick 3's scheduled_ticks, newest the skip marker
+    EXPECT_EQ(json.find("\"name\":\"scheduled_ticks\""), json.rfind("\"name\":\"scheduled_ticks\""));
+    EXPECT_NE(json.find("\"tick\":3"), std::string::npos);
+    EXPECT_EQ(json.find("\"tick\":2"), std::string::npos);
+    EXPECT_LT(json.find("\"name\":\"entity_physics\""), json.find("\"name\":\"skipped_ticks\""));
+    EXPECT_NE(json.find("\"count\":2"), std::string::npos);
+}
+
+TEST(TickProfilerTest, SessionRecordsTickPhases) {
+    BlockTypeId stone = ensureTestBlock("profiletest:stone", false);
+    auto session = GameSession::createLocal();
+    session->entities().spawnPlayer(Vec3(0, 64, 0));
+
+    session->actions().placeBlock(BlockPos(0, 0, 0), stone);
+    for (int i = 0; i < 5; ++i) {
+        session->tick(0.05f);
+    }
+
+    TickProfileSnapshot profile = session->tickProfile();
+    EXPECT_EQ(profile.ticks, 5u);
+    EXPECT_EQ(profile.tick.samples, 5u);
+    EXPECT_EQ(profile[TickPhase::Commands].samples, 1u);
+    for (TickPhase phase : {TickPhase::DeferredEvents, TickPhase::GameTicks, TickPhase::RandomTicks,
+                            TickPhase::ScheduledTicks, TickPhase::EventProcessing,
+                            TickPhase::EntityPhysics, TickPhase::SnapshotPublish}) {
+        EXPECT_EQ(profile[phase].samples, 5u) << tickPhaseName(phase);
+    }
+    EXPECT_GE(profile.tick.maxMs, profile.tick.p50Ms);
+    EXPECT_EQ(profile.skippedTicks, 0u);
+
+    GameSessionConfig quiet;
+    quiet.profileTicks = false;
+    auto unprofiled = GameSession::createLocal(quiet);
+    unprofiled->tick(0.05f);
+    EXPECT_EQ(unprofiled->tickProfile().ticks, 0u);
+}
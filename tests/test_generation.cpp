@@ -12,11 +12,19 @@
 #include "finevox/worldgen/feature_registry.hpp"
 #include "finevox/worldgen/feature_tree.hpp"
 #include "finevox/worldgen/feature_ore.hpp"
+#include "finevox/worldgen/pregenerator.hpp"
+#include "finevox/worldgen/generation_scheduler.hpp"
 #include "finevox/core/world.hpp"
 #include "finevox/core/chunk_column.hpp"
 #include "finevox/core/block_type.hpp"
+#include "finevox/core/region_file.hpp"
+#include "finevox/core/serialization.hpp"
 
+#include <atomic>
+#include <filesystem>
 #include <memory>
+#include <tuple>
+#include <unordered_set>
 
 namespace finevox::worldgen {
 namespace {
@@ -214,6 +222,103 @@ TEST_F(GenerationTest, PipelineRunsInPriorityOrder) {
     EXPECT_EQ(order[2], 3);
 }
 
+TEST_F(GenerationTest, PipelineStageIndex) {
+    GenerationPipeline pipeline;
+    pipeline.addPass(std::make_unique<CustomPass>("a", 1000));
+    pipeline.addPass(std::make_unique<CustomPass>("b", 2000));
+    pipeline.addPass(std::make_unique<CustomPass>("c", 3000));
+
+    EXPECT_EQ(pipeline.nextPassIndex(ChunkColumn::GENERATION_NOT_STARTED), 0u);
+    EXPECT_EQ(pipeline.nextPassIndex(1000), 1u);
+    EXPECT_EQ(pipeline.nextPassIndex(2500), 2u);  // Pass added after the save
+    EXPECT_EQ(pipeline.nextPassIndex(3000), 3u);
+    EXPECT_EQ(pipeline.nextPassIndex(ChunkColumn::GENERATION_COMPLETE), 3u);
+}
+
+TEST_F(GenerationTest, PipelineResumesFromStageMarker) {
+    GenerationPipeline pipeline;
+    pipeline.setWorldSeed(42);
+    pipeline.addPass(std::make_unique<TerrainPass>(42));
+    pipeline.addPass(std::make_unique<SurfacePass>());
+    BiomeMap biomeMap(42, BiomeRegistry::global());
+
+    World reference;
+    auto& full = reference.getOrCreateColumn(ColumnPos(3, -2));
+    pipeline.generateColumn(full, reference, biomeMap);
+    EXPECT_TRUE(full.isGenerationComplete());
+
+    // Stop after terrain, save, and pick up again from the saved column
+    World world;
+    auto& partial = world.getOrCreateColumn(ColumnPos(3, -2));
+    partial.setGenerationStage(ChunkColumn::GENERATION_NOT_STARTED);
+    GenerationContext ctx{partial, partial.position(), world, biomeMap, 42, {}, {}};
+    pipeline.runPass(0, ctx);
+    EXPECT_EQ(partial.generationStage(), static_cast<int32_t>(GenerationPriority::TerrainShape));
+
+    auto resumed = ColumnSerializer::fromCBOR(ColumnSerializer::toCBOR(partial, 3, -2));
+    ASSERT_NE(resumed, nullptr);
+    EXPECT_EQ(resumed->generationStage(), static_cast<int32_t>(GenerationPriority::TerrainShape));
+    pipeline.generateColumn(*resumed, world, biomeMap);
+    EXPECT_TRUE(resumed->isGenerationComplete());
+
+    for (int32_t lx = 0; lx < 16; ++lx) {
+        for (int32_t lz = 0; lz < 16; ++lz) {
+            for (int32_t y = 0; y < 80; ++y) {
+                ASSERT_EQ(resumed->getBlock(lx, y, lz), full.getBlock(lx, y, lz))
+                    << "Mismatch at (" << lx << "," << y << "," << lz << ")";
+            }
+        }
+    }
+}
+
+TEST_F(GenerationTest, PipelineResumesBetweenEqualPriorityPasses) {
+    bool ranFirst = false;
+    bool ranSecond = false;
+    bool ranLast = false;
+    auto decoration = static_cast<int32_t>(GenerationPriority::Decoration);
+    GenerationPipeline pipeline;
+    pipeline.addPass(std::make_unique<CustomPass>("first", decoration, &ranFirst));
+    pipeline.addPass(std::make_unique<CustomPass>("second", decoration, &ranSecond));
+    pipeline.addPass(std::make_unique<CustomPass>("last", 9000, &ranLast));
+    EXPECT_EQ(pipeline.nextPassIndex(decoration, 1), 1u);
+    EXPECT_EQ(pipeline.nextPassIndex(decoration, 2), 2u);
+    EXPECT_EQ(pipeline.nextPassIndex(decoration), 2u);  // Saved without a rank
+    BiomeMap biomeMap(42, BiomeRegistry::global());
+
+    // Interrupted after the first of the two, saved and loaded again
+    World world;
+    auto& partial = world.getOrCreateColumn(ColumnPos(0, 0));
+    partial.setGenerationStage(ChunkColumn::GENERATION_NOT_STARTED);
+    GenerationContext ctx{partial, partial.position(), world, biomeMap, 42, {}, {}};
+    pipeline.runPass(0, ctx);
+    EXPECT_EQ(partial.generationStage(), decoration);
+    EXPECT_EQ(partial.generationStageRank(), 1);
+
+    auto resumed = ColumnSerializer::fromCBOR(ColumnSerializer::toCBOR(partial, 0, 0));
+    ASSERT_NE(resumed, nullptr);
+    EXPECT_EQ(resumed->generationStageRank(), 1);
+    ranFirst = false;
+    pipeline.generateColumn(*resumed, world, biomeMap);
+    EXPECT_FALSE(ranFirst);
+    EXPECT_TRUE(ranSecond);
+    EXPECT_TRUE(ranLast);
+    EXPECT_TRUE(resumed->isGenerationComplete());
+
+    // The scheduler resumes the same way
+    World scheduled;
+    auto& loaded = scheduled.getOrCreateColumn(ColumnPos(0, 0));
+    loaded.setGenerationStage(decoration, 1);
+    GenerationScheduler scheduler(pipeline, scheduled, biomeMap, 1);
+    scheduler.start();
+    ranFirst = ranSecond = false;
+    scheduler.request(ColumnPos(0, 0));
+    scheduler.waitIdle();
+    EXPECT_FALSE(ranFirst);
+    EXPECT_TRUE(ranSecond);
+    EXPECT_EQ(scheduler.stats().passesRun.load(), 2u);
+    scheduler.stop();
+}
+
 // ============================================================================
 // TerrainPass Tests
 // ============================================================================
@@ -314,6 +419,39 @@ TEST_F(GenerationTest, SurfacePassAppliesBiomeBlocks) {
     EXPECT_TRUE(foundNonStone);
 }
 
+TEST_F(GenerationTest, SurfacePassPicksUpReloadedBiomes) {
+    World world;
+    BiomeMap biomeMap(42, BiomeRegistry::global());
+    TerrainPass terrain(42);
+    SurfacePass surface;
+
+    auto surfaceTypes = [&](ColumnPos pos) {
+        auto& col = world.getOrCreateColumn(pos);
+        GenerationContext ctx{col, pos, world, biomeMap, 42, {}, {}};
+        terrain.generate(ctx);
+        surface.generate(ctx);
+        std::unordered_set<BlockTypeId> types;
+        for (int32_t lx = 0; lx < 16; ++lx) {
+            for (int32_t lz = 0; lz < 16; ++lz) {
+                types.insert(col.getBlock(lx, ctx.heightmap[GenerationContext::hmIndex(lx, lz)], lz));
+            }
+        }
+        return types;
+    };
+    EXPECT_FALSE(surfaceTypes(ColumnPos(0, 0)).contains(BlockTypeId::fromName("snow")));
+
+    // Re-register both biomes with a new surface block; the pass's cached
+    // table must notice the registry change
+    for (const char* name : {"plains", "desert"}) {
+        BiomeProperties props = *BiomeRegistry::global().getBiome(name);
+        props.surfaceBlock = "snow";
+        BiomeRegistry::global().registerBiome(name, props);
+    }
+    auto reloaded = surfaceTypes(ColumnPos(1, 0));
+    EXPECT_EQ(reloaded.size(), 1u);
+    EXPECT_TRUE(reloaded.contains(BlockTypeId::fromName("snow")));
+}
+
 // ============================================================================
 // CavePass Tests
 // ============================================================================
@@ -355,6 +493,48 @@ TEST_F(GenerationTest, CavePassCarves) {
     EXPECT_LT(stoneAfter, stoneBefore);
 }
 
+TEST_F(GenerationTest, CavePassCoarseSamplingStaysClose) {
+    World exactWorld;
+    World coarseWorld;
+    BiomeMap biomeMap(42, BiomeRegistry::global());
+    TerrainPass terrain(42);
+    CavePass exactCaves(42);
+    CavePass coarseCaves(42, true);
+
+    int carvable = 0;
+    int differing = 0;
+    for (int32_t cx = 0; cx < 2; ++cx) {
+        for (int32_t cz = 0; cz < 2; ++cz) {
+            ColumnPos pos(cx, cz);
+            auto& exactCol = exactWorld.getOrCreateColumn(pos);
+            auto& coarseCol = coarseWorld.getOrCreateColumn(pos);
+            GenerationContext exactCtx{exactCol, pos, exactWorld, biomeMap, 42, {}, {}};
+            GenerationContext coarseCtx{coarseCol, pos, coarseWorld, biomeMap, 42, {}, {}};
+            terrain.generate(exactCtx);
+            terrain.generate(coarseCtx);
+            auto surface = exactCtx.heightmap;
+            exactCaves.generate(exactCtx);
+            coarseCaves.generate(coarseCtx);
+
+            for (int32_t lx = 0; lx < 16; ++lx) {
+                for (int32_t lz = 0; lz < 16; ++lz) {
+                    for (int32_t y = 1; y < surface[GenerationContext::hmIndex(lx, lz)] - 2; ++y) {
+                        ++carvable;
+                        if (exactCol.getBlock(lx, y, lz) != coarseCol.getBlock(lx, y, lz)) {
+                            ++differing;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Interpolated cheese noise only shifts cavern outlines
+    ASSERT_GT(carvable, 0);
+    EXPECT_GT(differing, 0);
+    EXPECT_LT(differing, carvable / 50);
+}
+
 // ============================================================================
 // Full Pipeline Tests
 // ============================================================================
@@ -446,6 +626,101 @@ TEST_F(GenerationTest, FullPipelineProducesPlayableColumn) {
     EXPECT_GT(nonStoneCount, 0);
 }
 
+TEST_F(GenerationTest, PipelinePassesDoNoNameLookups) {
+    uint64_t seed = 42;
+    OreConfig oreConfig;
+    oreConfig.oreBlock = ironOreId_;
+    oreConfig.replaceBlock = stoneId_;
+    FeatureRegistry::global().registerFeature(
+        std::make_shared<OreFeature>("iron_ore", oreConfig));
+    FeaturePlacement orePlacement;
+    orePlacement.featureName = "iron_ore";
+    orePlacement.density = 0.03f;
+    orePlacement.maxHeight = 48;
+    FeatureRegistry::global().addPlacement(orePlacement);
+
+    TreeConfig treeConfig;
+    treeConfig.trunkBlock = oakLogId_;
+    treeConfig.leavesBlock = oakLeavesId_;
+    FeatureRegistry::global().registerFeature(
+        std::make_shared<TreeFeature>("oak_tree", treeConfig));
+    FeaturePlacement treePlacement;
+    treePlacement.featureName = "oak_tree";
+    treePlacement.density = 0.02f;
+    treePlacement.requiresSurface = true;
+    FeatureRegistry::global().addPlacement(treePlacement);
+
+    GenerationPipeline pipeline;
+    pipeline.setWorldSeed(seed);
+    pipeline.addPass(std::make_unique<TerrainPass>(seed));
+    pipeline.addPass(std::make_unique<SurfacePass>());
+    pipeline.addPass(std::make_unique<CavePass>(seed));
+    pipeline.addPass(std::make_unique<OrePass>());
+    pipeline.addPass(std::make_unique<StructurePass>());
+    pipeline.addPass(std::make_unique<DecorationPass>());
+
+    World world;
+    BiomeMap biomeMap(seed, BiomeRegistry::global());
+    uint64_t before = StringInterner::global().hotPathLookups();
+    for (int32_t x = 0; x < 3; ++x) {
+        pipeline.generateColumn(world.getOrCreateColumn(ColumnPos(x, 0)), world, biomeMap);
+    }
+    EXPECT_EQ(StringInterner::global().hotPathLookups(), before);
+}
+
+TEST_F(GenerationTest, ProfilingRecordsPerPassTotals) {
+    uint64_t seed = 42;
+    OreConfig oreConfig;
+    oreConfig.oreBlock = ironOreId_;
+    oreConfig.replaceBlock = stoneId_;
+    FeatureRegistry::global().registerFeature(
+        std::make_shared<OreFeature>("iron_ore", oreConfig));
+    FeaturePlacement orePlacement;
+    orePlacement.featureName = "iron_ore";
+    orePlacement.density = 0.05f;
+    orePlacement.maxHeight = 48;
+    FeatureRegistry::global().addPlacement(orePlacement);
+
+    GenerationPipeline pipeline;
+    pipeline.setWorldSeed(seed);
+    pipeline.addPass(std::make_unique<TerrainPass>(seed));
+    pipeline.addPass(std::make_unique<CavePass>(seed));
+    pipeline.addPass(std::make_unique<OrePass>());
+    BiomeMap biomeMap(seed, BiomeRegistry::global());
+    World world;
+
+    // Off by default
+    pipeline.generateColumn(world.getOrCreateColumn(ColumnPos(0, 0)), world, biomeMap);
+    EXPECT_EQ(pipeline.passProfile(0).runs.load(), 0u);
+
+    pipeline.setProfiling(true);
+    pipeline.generateColumn(world.getOrCreateColumn(ColumnPos(1, 0)), world, biomeMap);
+    pipeline.generateColumn(world.getOrCreateColumn(ColumnPos(2, 0)), world, biomeMap);
+
+    const auto& terrain = pipeline.passProfile(0);
+    const auto& caves = pipeline.passProfile(1);
+    const auto& ores = pipeline.passProfile(2);
+    for (size_t i = 0; i < pipeline.passCount(); ++i) {
+        EXPECT_EQ(pipeline.passProfile(i).runs.load(), 2u);
+    }
+    EXPECT_GT(terrain.nanoseconds.load(), 0u);
+    EXPECT_GT(terrain.blocksWritten.load(), 2u * 256 * 40);  // Stone up to the surface
+    EXPECT_GT(terrain.noiseSamples.load(), 0u);
+    EXPECT_GT(caves.noiseSamples.load(), 0u);
+    EXPECT_GT(ores.blocksWritten.load(), 0u);
+    EXPECT_EQ(ores.noiseSamples.load(), 0u);
+
+    pipeline.resetProfile();
+    EXPECT_EQ(terrain.runs.load(), 0u);
+    EXPECT_EQ(terrain.blocksWritten.load(), 0u);
+
+    // Replacing a pass starts its profile over
+    pipeline.generateColumn(world.getOrCreateColumn(ColumnPos(3, 0)), world, biomeMap);
+    EXPECT_TRUE(pipeline.replacePass(std::make_unique<CavePass>(seed, true)));
+    EXPECT_EQ(pipeline.passProfile(1).runs.load(), 0u);
+    EXPECT_EQ(pipeline.passProfile(0).runs.load(), 1u);
+}
+
 TEST_F(GenerationTest, FullPipelineDeterministic) {
     uint64_t seed = 12345;
 
@@ -482,5 +757,527 @@ TEST_F(GenerationTest, FullPipelineDeterministic) {
     }
 }
 
+TEST_F(GenerationTest, BulkOrePassMatchesPerVeinPlacement) {
+    uint64_t seed = 777;
+
+    OreConfig iron;
+    iron.oreBlock = ironOreId_;
+    iron.replaceBlock = stoneId_;
+    iron.veinSize = 12;
+    iron.maxHeight = 64;
+    FeatureRegistry::global().registerFeature(std::make_shared<OreFeature>("iron_ore", iron));
+    FeaturePlacement ironPlacement;
+    ironPlacement.featureName = "iron_ore";
+    ironPlacement.density = 0.1f;
+    ironPlacement.maxHeight = 64;
+    FeatureRegistry::global().addPlacement(ironPlacement);
+
+    // Replaces the first ore, so overlapping veins depend on write order
+    OreConfig pocket;
+    pocket.oreBlock = dirtId_;
+    pocket.replaceBlock = ironOreId_;
+    pocket.veinSize = 16;
+    pocket.maxHeight = 64;
+    FeatureRegistry::global().registerFeature(std::make_shared<OreFeature>("dirt_pocket", pocket));
+    FeaturePlacement pocketPlacement;
+    pocketPlacement.featureName = "dirt_pocket";
+    pocketPlacement.density = 0.1f;
+    pocketPlacement.maxHeight = 64;
+    FeatureRegistry::global().addPlacement(pocketPlacement);
+
+    auto generate = [&](bool bulk, World& world) {
+        GenerationPipeline pipeline;
+        pipeline.setWorldSeed(seed);
+        pipeline.addPass(std::make_unique<TerrainPass>(seed));
+        pipeline.addPass(std::make_unique<SurfacePass>());
+        pipeline.addPass(std::make_unique<OrePass>(bulk));
+        BiomeMap biomeMap(seed, BiomeRegistry::global());
+        for (int32_t x = 0; x < 3; ++x) {
+            for (int32_t z = 0; z < 3; ++z) {
+                pipeline.generateColumn(world.getOrCreateColumn(ColumnPos(x, z)), world, biomeMap);
+            }
+        }
+    };
+
+    World perVein;
+    World bulk;
+    generate(false, perVein);
+    generate(true, bulk);
+
+    int32_t ores = 0;
+    int32_t pockets = 0;
+    for (int32_t x = -16; x < 64; ++x) {
+        for (int32_t z = -16; z < 64; ++z) {
+            for (int32_t y = 0; y < 80; ++y) {
+                BlockTypeId expected = perVein.getBlock(x, y, z);
+                ASSERT_EQ(bulk.getBlock(x, y, z), expected) << "at (" << x << "," << y << "," << z << ")";
+                ores += expected == ironOreId_ ? 1 : 0;
+                pockets += expected == dirtId_ && y < 50 ? 1 : 0;
+            }
+        }
+    }
+    EXPECT_GT(ores, 0);
+    EXPECT_GT(pockets, 0);
+}
+
+
+// ============================================================================
+// WorldPregenerator Tests
+// ============================================================================
+
+TEST(PregenAreaTest, SquareAndCount) {
+    PregenArea area = PregenArea::square(ColumnPos(10, -4), 2);
+    EXPECT_EQ(area.min, ColumnPos(8, -6));
+    EXPECT_EQ(area.max, ColumnPos(12, -2));
+    EXPECT_EQ(area.columnCount(), 25u);
+    EXPECT_TRUE(area.contains(ColumnPos(12, -6)));
+    EXPECT_FALSE(area.contains(ColumnPos(13, -6)));
+    EXPECT_EQ((PregenArea{ColumnPos(1, 1), ColumnPos(0, 0)}.columnCount()), 0u);
+}
+
+class PregenTest : public GenerationTest {
+protected:
+    void SetUp() override {
+        GenerationTest::SetUp();
+        tempDir_ = std::filesystem::temp_directory_path() / "finevox_test_pregen";
+        std::filesystem::remove_all(tempDir_);
+
+        TreeConfig treeConfig;
+        treeConfig.trunkBlock = oakLogId_;
+        treeConfig.leavesBlock = oakLeavesId_;
+        FeatureRegistry::global().registerFeature(
+            std::make_shared<TreeFeature>("oak_tree", treeConfig));
+        FeaturePlacement treePlacement;
+        treePlacement.featureName = "oak_tree";
+        treePlacement.density = 0.02f;
+        treePlacement.requiresSurface = true;
+        FeatureRegistry::global().addPlacement(treePlacement);
+
+        pipeline_.setWorldSeed(SEED);
+        pipeline_.addPass(std::make_unique<TerrainPass>(SEED));
+        pipeline_.addPass(std::make_unique<SurfacePass>());
+        pipeline_.addPass(std::make_unique<StructurePass>());
+        biomeMap_ = std::make_unique<BiomeMap>(SEED, BiomeRegistry::global());
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(tempDir_);
+        GenerationTest::TearDown();
+    }
+
+    static constexpr uint64_t SEED = 777;
+    std::filesystem::path tempDir_;
+    GenerationPipeline pipeline_;
+    std::unique_ptr<BiomeMap> biomeMap_;
+};
+
+TEST_F(PregenTest, WritesAreaAcrossRegions) {
+    // Straddles the border between regions (0, 0) and (1, 0)
+    PregenArea area{ColumnPos(30, 0), ColumnPos(33, 1)};
+    WorldPregenerator pregen(pipeline_, *biomeMap_, tempDir_);
+    PregenResult result = pregen.run(area, PregenOptions{2});
+
+    EXPECT_EQ(result.columnsGenerated, 8u);
+    EXPECT_EQ(result.columnsSkipped, 0u);
+    EXPECT_EQ(result.regionsWritten, 2u);
+    EXPECT_EQ(result.writeFailures, 0u);
+
+    RegionFile west(tempDir_, RegionPos{0, 0});
+    RegionFile east(tempDir_, RegionPos{1, 0});
+    EXPECT_EQ(west.getExistingColumns().size(), 4u);
+    EXPECT_EQ(east.getExistingColumns().size(), 4u);
+    EXPECT_FALSE(west.hasColumn(ColumnPos(29, 0)));
+
+    auto column = east.loadColumn(ColumnPos(33, 1));
+    ASSERT_NE(column, nullptr);
+    EXPECT_EQ(column->getBlock(0, 0, 0), stoneId_);
+}
+
+TEST_F(PregenTest, ThreadCountDoesNotChangeOutput) {
+    PregenArea area{ColumnPos(-3, -3), ColumnPos(34, 2)};  // Four regions
+
+    WorldPregenerator serial(pipeline_, *biomeMap_, tempDir_ / "serial");
+    WorldPregenerator parallel(pipeline_, *biomeMap_, tempDir_ / "parallel");
+    PregenOptions options;
+    options.threads = 1;
+    (void)serial.run(area, options);
+    options.threads = 4;
+    (void)parallel.run(area, options);
+
+    for (int32_t x = area.min.x; x <= area.max.x; ++x) {
+        for (int32_t z = area.min.z; z <= area.max.z; ++z) {
+            ColumnPos pos(x, z);
+            RegionPos rp = RegionPos::fromColumn(pos);
+            RegionFile a(tempDir_ / "serial", rp);
+            RegionFile b(tempDir_ / "parallel", rp);
+            auto bytesA = a.loadColumnRaw(pos);
+            EXPECT_FALSE(bytesA.empty());
+            EXPECT_EQ(bytesA, b.loadColumnRaw(pos)) << "Mismatch at " << x << "," << z;
+        }
+    }
+}
+
+TEST_F(PregenTest, SkipsExistingColumns) {
+    PregenArea area{ColumnPos(0, 0), ColumnPos(3, 3)};
+    WorldPregenerator pregen(pipeline_, *biomeMap_, tempDir_);
+
+    std::vector<size_t> progressRegions;
+    EXPECT_EQ(pregen.run(area, {}, [&](const PregenProgress& p) {
+        progressRegions.push_back(p.regionsDone);
+        EXPECT_EQ(p.regionsTotal, 1u);
+    }).columnsGenerated, 16u);
+    EXPECT_EQ(progressRegions, std::vector<size_t>{1});
+
+    // Resumed run over a larger area only fills in the new columns
+    PregenResult resumed = pregen.run(PregenArea{ColumnPos(0, 0), ColumnPos(3, 4)});
+    EXPECT_EQ(resumed.columnsGenerated, 4u);
+    EXPECT_EQ(resumed.columnsSkipped, 16u);
+
+    PregenOptions force;
+    force.skipExisting = false;
+    EXPECT_EQ(pregen.run(area, force).columnsGenerated, 16u);
+}
+
+namespace {
+
+// Writes a marker into the columns east (y 200), west (y 201) and two rows
+// north (y 202) of each column it generates
+class SpillPass : public GenerationPass {
+public:
+    explicit SpillPass(BlockTypeId marker) : marker_(marker) {}
+
+    std::string_view name() const override { return "test:spill"; }
+    int32_t priority() const override { return 4000; }
+
+    void generate(GenerationContext& ctx) override {
+        BlockPos origin(ctx.pos.x * 16, 0, ctx.pos.z * 16);
+        FeaturePlacementContext fctx{ctx.world, origin, BiomeId{}, 0, &ctx};
+        fctx.setBlock(BlockPos(origin.x + 16, 200, origin.z), marker_);
+        fctx.setBlock(BlockPos(origin.x - 16, 201, origin.z), marker_);
+        fctx.setBlock(BlockPos(origin.x, 202, origin.z - 32), marker_);
+    }
+
+private:
+    BlockTypeId marker_;
+};
+
+}  // namespace
+
+TEST_F(PregenTest, PatchesCrossRegionAndLateFeatureWrites) {
+    GenerationPipeline spill;
+    spill.addPass(std::make_unique<SpillPass>(stoneId_));
+
+    // Straddles regions (0, 0) and (1, 0); a reach of one row leaves the
+    // northward writes to the patch phase
+    PregenArea area{ColumnPos(29, 0), ColumnPos(34, 4)};
+    PregenOptions options;
+    options.featureReach = 1;
+
+    for (size_t threads : {size_t{1}, size_t{2}}) {
+        auto dir = tempDir_ / ("threads" + std::to_string(threads));
+        WorldPregenerator pregen(spill, *biomeMap_, dir);
+        options.threads = threads;
+        PregenResult result = pregen.run(area, options);
+
+        EXPECT_EQ(result.columnsGenerated, 30u);
+        EXPECT_EQ(result.regionsWritten, 2u);
+        // West of x 29, east of x 34, and north of rows 0 and 1
+        EXPECT_EQ(result.featureWritesDropped, 5u + 5u + 12u);
+        EXPECT_GT(result.featureWritesPatched, 0u);
+
+        for (int32_t x = area.min.x; x <= area.max.x; ++x) {
+            for (int32_t z = area.min.z; z <= area.max.z; ++z) {
+                ColumnPos pos(x, z);
+                RegionFile region(dir, RegionPos::fromColumn(pos));
+                auto column = region.loadColumn(pos);
+                ASSERT_NE(column, nullptr);
+                auto marked = [&](int32_t y) { return column->getBlock(0, y, 0) == stoneId_; };
+                EXPECT_EQ(marked(200), area.contains(ColumnPos(x - 1, z))) << x << "," << z;
+                EXPECT_EQ(marked(201), area.contains(ColumnPos(x + 1, z))) << x << "," << z;
+                EXPECT_EQ(marked(202), area.contains(ColumnPos(x, z + 2))) << x << "," << z;
+            }
+        }
+
+        // Nothing left to generate, so nothing is written
+        options.threads = 1;
+        EXPECT_EQ(pregen.run(area, options).regionsWritten, 0u);
+    }
+}
+
+// ============================================================================
+// GenerationScheduler Tests
+// ============================================================================
+
+/// Neighbor-dependent pass that checks the 3x3 reached the previous pass
+class NeighborCheckPass : public GenerationPass {
+public:
+    NeighborCheckPass(int32_t prio, int32_t required)
+        : priority_(prio), required_(required) {}
+
+    std::string_view name() const override { return "test:neighbor_check"; }
+    int32_t priority() const override { return priority_; }
+    bool needsNeighbors() const override { return true; }
+    void generate(GenerationContext& ctx) override {
+        for (int32_t dz = -1; dz <= 1; ++dz) {
+            for (int32_t dx = -1; dx <= 1; ++dx) {
+                const ChunkColumn* nb = ctx.world.getColumn(ColumnPos(ctx.pos.x + dx, ctx.pos.z + dz));
+                if (!nb || nb->generationStage() < required_) {
+                    violations.fetch_add(1);
+                }
+            }
+        }
+        runs.fetch_add(1);
+    }
+
+    std::atomic<int> violations{0};
+    std::atomic<int> runs{0};
+
+private:
+    int32_t priority_;
+    int32_t required_;
+};
+
+TEST_F(GenerationTest, SchedulerWaitsForNeighborStage) {
+    GenerationPipeline pipeline;
+    pipeline.setWorldSeed(42);
+    pipeline.addPass(std::make_unique<TerrainPass>(42));
+    pipeline.addPass(std::make_unique<NeighborCheckPass>(1500, 1000));
+    pipeline.addPass(std::make_unique<SurfacePass>());
+    auto* check = static_cast<NeighborCheckPass*>(pipeline.getPass("test:neighbor_check"));
+    BiomeMap biomeMap(42, BiomeRegistry::global());
+    World world;
+
+    GenerationScheduler scheduler(pipeline, world, biomeMap, 4);
+    scheduler.start();
+    std::atomic<int> readyCount{0};
+    for (int32_t x = 0; x < 3; ++x) {
+        scheduler.request(ColumnPos(x, 0), [&](ColumnPos, ChunkColumn& column) {
+            EXPECT_TRUE(column.isGenerationComplete());
+            readyCount.fetch_add(1);
+        });
+    }
+    scheduler.waitIdle();
+
+    EXPECT_EQ(readyCount.load(), 3);
+    EXPECT_EQ(check->violations.load(), 0);
+    for (int32_t x = 0; x < 3; ++x) {
+        EXPECT_TRUE(scheduler.isReady(ColumnPos(x, 0)));
+        EXPECT_EQ(world.getColumn(ColumnPos(x, 0))->getBlock(0, 0, 0), stoneId_);
+    }
+
+    // Neighbors ran the neighbor pass (so nothing more spills into the
+    // requested columns); their own neighbors only got terrain
+    EXPECT_EQ(scheduler.completedPasses(ColumnPos(-1, 1)), 2u);
+    EXPECT_EQ(scheduler.completedPasses(ColumnPos(-2, 0)), 1u);
+    EXPECT_EQ(world.getColumn(ColumnPos(-2, 0))->generationStage(),
+              static_cast<int32_t>(GenerationPriority::TerrainShape));
+    EXPECT_EQ(check->runs.load(), 15);  // 5x3 strip
+    EXPECT_EQ(scheduler.stats().columnsReady.load(), 3u);
+    scheduler.stop();
+}
+
+TEST_F(GenerationTest, SchedulerMatchesSerialGeneration) {
+    GenerationPipeline pipeline;
+    pipeline.setWorldSeed(42);
+    pipeline.addPass(std::make_unique<TerrainPass>(42));
+    pipeline.addPass(std::make_unique<SurfacePass>());
+    pipeline.addPass(std::make_unique<CavePass>(42));
+    BiomeMap biomeMap(42, BiomeRegistry::global());
+
+    World serial;
+    World parallel;
+    GenerationScheduler scheduler(pipeline, parallel, biomeMap, 3);
+    scheduler.start();
+    for (int32_t x = -2; x <= 2; ++x) {
+        for (int32_t z = -2; z <= 2; ++z) {
+            pipeline.generateColumn(serial.getOrCreateColumn(ColumnPos(x, z)), serial, biomeMap);
+            scheduler.request(ColumnPos(x, z));
+        }
+    }
+    scheduler.waitIdle();
+    EXPECT_EQ(scheduler.stats().passesRun.load(), 75u);
+    EXPECT_EQ(parallel.columnCount(), 25u);
+
+    for (int32_t x = -2; x <= 2; ++x) {
+        for (int32_t z = -2; z <= 2; ++z) {
+            ColumnPos pos(x, z);
+            EXPECT_EQ(ColumnSerializer::toCBOR(*parallel.getColumn(pos), x, z),
+                      ColumnSerializer::toCBOR(*serial.getColumn(pos), x, z))
+                << "Mismatch at " << x << "," << z;
+        }
+    }
+}
+
+TEST_F(GenerationTest, SchedulerFeatureOutputIndependentOfThreads) {
+    // Two overlapping tree kinds so cross-column leaf writes can conflict
+    BlockTypeId birchLeaves = BlockTypeId::fromName("birch_leaves");
+    BlockRegistry::global().registerType(birchLeaves, BlockType().setOpaque(true));
+    for (auto [name, leaves, density] : {std::tuple{"oak_tree", oakLeavesId_, 0.03f},
+                                         std::tuple{"birch_tree", birchLeaves, 0.03f}}) {
+        TreeConfig config;
+        config.trunkBlock = oakLogId_;
+        config.leavesBlock = leaves;
+        config.leafRadius = 3;
+        config.requiresSoil = true;
+        FeatureRegistry::global().registerFeature(std::make_shared<TreeFeature>(name, config));
+        FeaturePlacement placement;
+        placement.featureName = name;
+        placement.density = density;
+        placement.requiresSurface = true;
+        FeatureRegistry::global().addPlacement(placement);
+    }
+
+    GenerationPipeline pipeline;
+    pipeline.setWorldSeed(7);
+    pipeline.addPass(std::make_unique<TerrainPass>(7));
+    pipeline.addPass(std::make_unique<SurfacePass>());
+    pipeline.addPass(std::make_unique<StructurePass>());
+    BiomeMap biomeMap(7, BiomeRegistry::global());
+
+    auto generate = [&](World& world, size_t threads) {
+        GenerationScheduler scheduler(pipeline, world, biomeMap, threads);
+        scheduler.start();
+        for (int32_t x = -2; x <= 2; ++x) {
+            for (int32_t z = -2; z <= 2; ++z) {
+                scheduler.request(ColumnPos(x, z));
+            }
+        }
+        scheduler.waitIdle();
+        return scheduler.pendingWrites().stats().buffered.load();
+    };
+    World single;
+    World multi;
+    EXPECT_GT(generate(single, 1), 0u);  // Canopies did cross column borders
+    generate(multi, 4);
+
+    for (int32_t x = -2; x <= 2; ++x) {
+        for (int32_t z = -2; z <= 2; ++z) {
+            ColumnPos pos(x, z);
+            EXPECT_EQ(ColumnSerializer::toCBOR(*multi.getColumn(pos), x, z),
+                      ColumnSerializer::toCBOR(*single.getColumn(pos), x, z))
+                << "Mismatch at " << x << "," << z;
+        }
+    }
+}
+
+TEST_F(GenerationTest, SchedulerForgetsUnloadedColumns) {
+    GenerationPipeline pipeline;
+    pipeline.setWorldSeed(42);
+    pipeline.addPass(std::make_unique<TerrainPass>(42));
+    pipeline.addPass(std::make_unique<NeighborCheckPass>(1500, 1000));
+    BiomeMap biomeMap(42, BiomeRegistry::global());
+    World world;
+    GenerationScheduler scheduler(pipeline, world, biomeMap, 2);
+
+    // Queued but not started: the column and its neighbors are still needed
+    scheduler.request(ColumnPos(0, 0));
+    EXPECT_FALSE(scheduler.forget(ColumnPos(0, 0)));
+    EXPECT_FALSE(scheduler.forget(ColumnPos(1, 0)));
+
+    scheduler.start();
+    scheduler.waitIdle();
+    ASSERT_TRUE(scheduler.isReady(ColumnPos(0, 0)));
+
+    EXPECT_TRUE(scheduler.forget(ColumnPos(0, 0)));
+    EXPECT_FALSE(scheduler.isReady(ColumnPos(0, 0)));
+    EXPECT_EQ(scheduler.completedPasses(ColumnPos(0, 0)), 0u);
+    EXPECT_TRUE(scheduler.forget(ColumnPos(1, 0)));
+    ASSERT_TRUE(world.removeColumn(ColumnPos(0, 0)));
+    ASSERT_TRUE(world.removeColumn(ColumnPos(1, 0)));
+
+    // Requested again, the columns are regenerated into new World columns
+    ChunkColumn* delivered = nullptr;
+    scheduler.request(ColumnPos(0, 0), [&](ColumnPos, ChunkColumn& column) { delivered = &column; });
+    scheduler.waitIdle();
+    ASSERT_NE(delivered, nullptr);
+    EXPECT_EQ(delivered, world.getColumn(ColumnPos(0, 0)));
+    EXPECT_TRUE(delivered->isGenerationComplete());
+    EXPECT_EQ(world.getColumn(ColumnPos(1, 0))->getBlock(0, 0, 0), stoneId_);
+
+    // Removed without forget(): noticed on the next request
+    ASSERT_TRUE(world.removeColumn(ColumnPos(0, 0)));
+    delivered = nullptr;
+    scheduler.request(ColumnPos(0, 0), [&](ColumnPos, ChunkColumn& column) { delivered = &column; });
+    scheduler.waitIdle();
+    ASSERT_NE(delivered, nullptr);
+    EXPECT_EQ(delivered, world.getColumn(ColumnPos(0, 0)));
+    EXPECT_TRUE(delivered->isGenerationComplete());
+    scheduler.stop();
+}
+
+/// Writes a marker three columns east of each column
+class FarSpillPass : public GenerationPass {
+public:
+    explicit FarSpillPass(BlockTypeId marker) : marker_(marker) {}
+
+    std::string_view name() const override { return "test:far_spill"; }
+    int32_t priority() const override { return 4000; }
+    void generate(GenerationContext& ctx) override {
+        BlockPos origin(ctx.pos.x * 16, 0, ctx.pos.z * 16);
+        FeaturePlacementContext fctx{ctx.world, origin, BiomeId{}, 0, &ctx};
+        fctx.setBlock(BlockPos(origin.x + 48, 200, origin.z), marker_);
+    }
+
+private:
+    BlockTypeId marker_;
+};
+
+TEST_F(GenerationTest, SchedulerDropsWritesOutsideGeneratedArea) {
+    GenerationPipeline pipeline;
+    pipeline.setWorldSeed(42);
+    pipeline.addPass(std::make_unique<TerrainPass>(42));
+    pipeline.addPass(std::make_unique<FarSpillPass>(sandId_));
+    BiomeMap biomeMap(42, BiomeRegistry::global());
+    World world;
+
+    // Request the whole area before starting, so (3, 0) is known to the
+    // scheduler before (0, 0) spills into it
+    GenerationScheduler scheduler(pipeline, world, biomeMap, 2);
+    for (int32_t x = 0; x < 4; ++x) {
+        scheduler.request(ColumnPos(x, 0));
+    }
+    scheduler.start();
+    scheduler.waitIdle();
+
+    // Only (3, 0) is inside the area; writes into x 4..6 are not kept
+    EXPECT_EQ(world.getColumn(ColumnPos(3, 0))->getBlock(0, 200, 0), sandId_);
+    EXPECT_EQ(scheduler.pendingWrites().pendingWrites(), 0u);
+    EXPECT_EQ(scheduler.stats().writesDropped.load(), 3u);
+    EXPECT_EQ(world.getColumn(ColumnPos(4, 0)), nullptr);
+    scheduler.stop();
+}
+
+TEST_F(GenerationTest, SchedulerResumesPartialColumns) {
+    GenerationPipeline pipeline;
+    pipeline.setWorldSeed(42);
+    pipeline.addPass(std::make_unique<TerrainPass>(42));
+    pipeline.addPass(std::make_unique<SurfacePass>());
+    BiomeMap biomeMap(42, BiomeRegistry::global());
+
+    // A column loaded with only terrain done, and one already finished
+    World world;
+    auto& partial = world.getOrCreateColumn(ColumnPos(0, 0));
+    partial.setGenerationStage(ChunkColumn::GENERATION_NOT_STARTED);
+    GenerationContext ctx{partial, partial.position(), world, biomeMap, 42, {}, {}};
+    pipeline.runPass(0, ctx);
+    world.getOrCreateColumn(ColumnPos(1, 0)).setBlock(0, 0, 0, sandId_);
+
+    GenerationScheduler scheduler(pipeline, world, biomeMap, 1);
+    scheduler.start();
+    scheduler.request(ColumnPos(0, 0));
+    scheduler.request(ColumnPos(1, 0));
+    scheduler.waitIdle();
+
+    EXPECT_EQ(scheduler.stats().passesRun.load(), 1u);  // Only the surface pass
+    EXPECT_TRUE(partial.isGenerationComplete());
+    EXPECT_TRUE(scheduler.isReady(ColumnPos(1, 0)));
+    EXPECT_EQ(world.getColumn(ColumnPos(1, 0))->getBlock(0, 1, 0), AIR_BLOCK_TYPE);
+
+    World reference;
+    auto& full = reference.getOrCreateColumn(ColumnPos(0, 0));
+    pipeline.generateColumn(full, reference, biomeMap);
+    EXPECT_EQ(ColumnSerializer::toCBOR(partial, 0, 0), ColumnSerializer::toCBOR(full, 0, 0));
+}
+
 }  // namespace
 }  // namespace finevox::worldgen
@@ -507,3 +507,178 @@ TEST_F(IOManagerTest, RoundTripSaveLoad) {
 // Note: RoundTripWithDataContainer test is pending - requires DataContainer
 // integration with ChunkColumn (data() accessor). DataContainer serialization
 // is tested separately in test_data_container.cpp.
+
+// ============================================================================
+// Compression Policy Tests
+// ============================================================================
+
+TEST_F(IOManagerTest, PerWriteCompressionPolicy) {
+    ChunkColumn col(ColumnPos{1, 1});
+    col.setBlock(0, 0, 0, BlockTypeId::fromName("test:stone"));
+
+    {
+        IOManager io(tempDir);
+        io.start();
+        io.queueSave(ColumnPos{1, 1}, col, CompressionPolicy{CompressionCodec::None});
+        io.queueSave(ColumnPos{2, 1}, col, CompressionPolicy::cold());
+        io.flush();
+        io.stop();
+    }
+
+    RegionFile region(tempDir, RegionPos{0, 0});
+    EXPECT_EQ(region.columnFlags(ColumnPos{1, 1}), std::optional<uint32_t>(0));
+    EXPECT_EQ(chunkCodec(region.columnFlags(ColumnPos{2, 1}).value_or(0)), CompressionCodec::LZ4HC);
+    ASSERT_NE(region.loadColumn(ColumnPos{2, 1}), nullptr);
+}
+
+TEST_F(IOManagerTest, ColdRegionRecompression) {
+    ChunkColumn col(ColumnPos{0, 0});
+    col.setBlock(0, 0, 0, BlockTypeId::fromName("test:stone"));
+
+    {
+        IOManager io(tempDir);
+        io.start();
+        for (int i = 0; i < 4; ++i) {
+            io.queueSave(ColumnPos{i, 0}, col);
+        }
+        io.flush();
+
+        // Not idle long enough yet
+        io.setColdRegionRecompression(CompressionPolicy::cold(), std::chrono::hours(1));
+        EXPECT_EQ(io.recompressColdRegions(), 0u);
+
+        // Immediately cold: rewritten once, then left alone
+        io.setColdRegionRecompression(CompressionPolicy::cold(), std::chrono::milliseconds(0));
+        EXPECT_EQ(io.recompressColdRegions(), 4u);
+        EXPECT_EQ(io.recompressColdRegions(), 0u);
+        io.disableColdRegionRecompression();
+        io.stop();
+    }
+
+    RegionFile region(tempDir, RegionPos{0, 0});
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(chunkCodec(region.columnFlags(ColumnPos{i, 0}).value_or(0)), CompressionCodec::LZ4HC);
+    }
+}
+
+TEST_F(IOManagerTest, ColdRegionRecompressionInBackground) {
+    ChunkColumn col(ColumnPos{0, 0});
+    col.setBlock(0, 0, 0, BlockTypeId::fromName("test:stone"));
+
+    {
+        IOManager io(tempDir);
+        io.setColdRegionRecompression(CompressionPolicy::cold(), std::chrono::milliseconds(20));
+        io.start();
+        io.queueSave(ColumnPos{3, 3}, col);
+        io.flush();
+
+        // Save thread archives the region once it has been idle
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        io.stop();
+    }
+
+    RegionFile region(tempDir, RegionPos{0, 0});
+    EXPECT_EQ(chunkCodec(region.columnFlags(ColumnPos{3, 3}).value_or(0)), CompressionCodec::LZ4HC);
+}
+
+// ============================================================================
+// Region Handle Cache and Read-Ahead Tests
+// ============================================================================
+
+namespace {
+
+std::unique_ptr<ChunkColumn> loadBlocking(IOManager& io, ColumnPos pos) {
+    std::atomic<bool> done{false};
+    std::unique_ptr<ChunkColumn> result;
+    io.requestLoad(pos, [&](ColumnPos, std::unique_ptr<ChunkColumn> col) {
+        result = std::move(col);
+        done = true;
+    });
+    while (!done) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST_F(IOManagerTest, ClosedRegionIndexIsReused) {
+    BlockTypeId stone = BlockTypeId::fromName("test:stone");
+
+    IOManager io(tempDir);
+    io.setMaxOpenRegions(1);
+    io.setReadAheadEnabled(false);
+    io.start();
+
+    for (int r = 0; r < 3; ++r) {
+        ColumnPos pos{r * REGION_SIZE + 5, 5};
+        ChunkColumn col(pos);
+        col.setBlock(0, r, 0, stone);
+        io.queueSave(pos, col);
+    }
+    io.flush();
+    io.stop();  // Let the last save finish before inspecting stats
+    io.start();
+
+    EXPECT_EQ(io.regionFileCount(), 1u);
+    EXPECT_EQ(io.cachedIndexCount(), 2u);
+    EXPECT_EQ(io.stats().indexCacheHits, 0u);
+
+    // Revisit the first region: opened from the cached index
+    auto loaded = loadBlocking(io, ColumnPos{5, 5});
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ(loaded->getBlock(0, 0, 0), stone);
+    EXPECT_EQ(io.stats().indexCacheHits, 1u);
+    EXPECT_EQ(io.stats().regionOpens, 4u);
+
+    io.stop();
+}
+
+TEST_F(IOManagerTest, ReadAheadAcrossRegionBorder) {
+    BlockTypeId stone = BlockTypeId::fromName("test:stone");
+    BlockTypeId dirt = BlockTypeId::fromName("test:dirt");
+
+    IOManager io(tempDir);
+    io.start();
+
+    // (31, 4) is on the east edge of region (0, 0); (32, 4) is across it
+    for (int x : {31, 32}) {
+        ColumnPos pos{x, 4};
+        ChunkColumn col(pos);
+        col.setBlock(0, 0, 0, stone);
+        io.queueSave(pos, col);
+    }
+    io.flush();
+
+    ASSERT_NE(loadBlocking(io, ColumnPos{31, 4}), nullptr);
+    // Read-ahead runs after the callback; wait for it
+    while (io.stats().readAheadColumns < 1) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    auto across = loadBlocking(io, ColumnPos{32, 4});
+    ASSERT_NE(across, nullptr);
+    EXPECT_EQ(across->getBlock(0, 0, 0), stone);
+    EXPECT_EQ(io.stats().readAheadHits, 1u);
+
+    // A save replaces any read-ahead copy. Loading (32, 4) read ahead back
+    // to (31, 4), which reads ahead to (32, 4) again.
+    ASSERT_NE(loadBlocking(io, ColumnPos{31, 4}), nullptr);
+    while (io.stats().readAheadColumns < 3) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ChunkColumn updated(ColumnPos{32, 4});
+    updated.setBlock(0, 0, 0, dirt);
+    std::atomic<bool> saved{false};
+    io.queueSave(ColumnPos{32, 4}, updated, [&](ColumnPos, bool) { saved = true; });
+    while (!saved) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    auto reloaded = loadBlocking(io, ColumnPos{32, 4});
+    ASSERT_NE(reloaded, nullptr);
+    EXPECT_EQ(reloaded->getBlock(0, 0, 0), dirt);
+    EXPECT_EQ(io.stats().readAheadHits, 2u);
+
+    io.stop();
+}
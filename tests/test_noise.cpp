@@ -14,6 +14,7 @@
 
 #include <cmath>
 #include <memory>
+#include <stdexcept>
 #include <unordered_set>
 #include <vector>
 
@@ -633,3 +634,246 @@ TEST(NoiseCompositionTest, PolymorphicInterface) {
         EXPECT_TRUE(std::isfinite(v));
     }
 }
+
+// ============================================================================
+// Batched evaluation (evaluateBatch / evaluateGrid)
+// ============================================================================
+
+namespace {
+
+/// Scattered points including negatives, lattice-aligned values and an
+/// odd count so the partial lane group is exercised
+struct BatchPoints {
+    std::vector<float> xs, ys, zs;
+
+    explicit BatchPoints(size_t count) {
+        uint32_t state = 12345;
+        auto next = [&]() {
+            state = state * 1664525u + 1013904223u;
+            return static_cast<float>(state >> 8) / static_cast<float>(1u << 24);
+        };
+        for (size_t i = 0; i < count; ++i) {
+            bool aligned = i % 7 == 0;
+            xs.push_back(aligned ? static_cast<float>(i) - 50.0f : (next() - 0.5f) * 400.0f);
+            ys.push_back(aligned ? 3.0f : (next() - 0.5f) * 200.0f);
+            zs.push_back(aligned ? -static_cast<float>(i) : (next() - 0.5f) * 400.0f);
+        }
+    }
+};
+
+constexpr float BATCH_TOLERANCE = 1e-5f;
+
+void expectBatchMatches(const Noise2D& noise, size_t count = 601) {
+    BatchPoints p(count);
+    std::vector<float> out(count);
+    noise.evaluateBatch(p.xs, p.zs, out);
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_NEAR(out[i], noise.evaluate(p.xs[i], p.zs[i]), BATCH_TOLERANCE) << "point " << i;
+    }
+}
+
+void expectBatchMatches(const Noise3D& noise, size_t count = 601) {
+    BatchPoints p(count);
+    std::vector<float> out(count);
+    noise.evaluateBatch(p.xs, p.ys, p.zs, out);
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_NEAR(out[i], noise.evaluate(p.xs[i], p.ys[i], p.zs[i]), BATCH_TOLERANCE)
+            << "point " << i;
+    }
+}
+
+}  // namespace
+
+TEST(NoiseBatchTest, BaseNoisesMatchScalar) {
+    expectBatchMatches(PerlinNoise2D(42));
+    expectBatchMatches(PerlinNoise3D(42));
+    expectBatchMatches(OpenSimplex2D(42));
+    expectBatchMatches(OpenSimplex3D(42));
+
+    // Fewer points than one lane group
+    expectBatchMatches(OpenSimplex3D(7), 3);
+    expectBatchMatches(PerlinNoise2D(7), 1);
+}
+
+TEST(NoiseBatchTest, FractalWrappersMatchScalar) {
+    expectBatchMatches(FBMNoise2D(std::make_unique<PerlinNoise2D>(1), 5));
+    expectBatchMatches(FBMNoise3D(std::make_unique<OpenSimplex3D>(2), 4));
+    expectBatchMatches(RidgedNoise2D(std::make_unique<OpenSimplex2D>(3)));
+    expectBatchMatches(RidgedNoise3D(std::make_unique<PerlinNoise3D>(4), 4));
+    expectBatchMatches(BillowNoise2D(std::make_unique<PerlinNoise2D>(5)));
+    expectBatchMatches(BillowNoise3D(std::make_unique<OpenSimplex3D>(6), 3));
+}
+
+TEST(NoiseBatchTest, AdaptersMatchScalar) {
+    expectBatchMatches(*NoiseFactory::warpedTerrain(11));
+    expectBatchMatches(DomainWarp3D(std::make_unique<PerlinNoise3D>(12),
+                                    std::make_unique<OpenSimplex3D>(13),
+                                    std::make_unique<OpenSimplex3D>(14),
+                                    std::make_unique<OpenSimplex3D>(15), 4.0f));
+    expectBatchMatches(*NoiseFactory::simplexFBM3D(16, 3, 0.015f));
+
+    for (CombineOp op : {CombineOp::Add, CombineOp::Multiply, CombineOp::Min,
+                         CombineOp::Max, CombineOp::Lerp}) {
+        expectBatchMatches(CombinedNoise2D(std::make_unique<PerlinNoise2D>(17),
+                                           std::make_unique<OpenSimplex2D>(18), op, 0.3f));
+    }
+    expectBatchMatches(ClampedNoise2D(std::make_unique<OpenSimplex2D>(19), -0.2f, 0.2f));
+    expectBatchMatches(MappedNoise2D(std::make_unique<PerlinNoise2D>(20),
+                                     [](float v) { return v * v; }));
+
+    // No batch override: falls back to evaluate() per point
+    class SineNoise : public Noise2D {
+    public:
+        float evaluate(float x, float z) const override { return std::sin(x * 0.1f) * std::cos(z * 0.1f); }
+    };
+    expectBatchMatches(FBMNoise2D(std::make_unique<SineNoise>(), 3));
+}
+
+TEST(NoiseBatchTest, GridLayout) {
+    OpenSimplex2D noise2(3);
+    NoiseGrid2D grid2;
+    grid2.x0 = -32.0f;
+    grid2.z0 = 48.0f;
+    grid2.stepX = 0.5f;
+    grid2.countZ = 5;
+    std::vector<float> out2(grid2.size());
+    noise2.evaluateGrid(grid2, out2);
+    for (int32_t ix = 0; ix < grid2.countX; ++ix) {
+        for (int32_t iz = 0; iz < grid2.countZ; ++iz) {
+            float expected = noise2.evaluate(-32.0f + static_cast<float>(ix) * 0.5f,
+                                             48.0f + static_cast<float>(iz));
+            EXPECT_NEAR(out2[static_cast<size_t>(ix * grid2.countZ + iz)], expected, BATCH_TOLERANCE);
+        }
+    }
+
+    // Larger than one NOISE_BATCH_CHUNK so chunk boundaries are crossed
+    auto noise3 = NoiseFactory::perlinFBM3D(4);
+    NoiseGrid3D grid3;
+    grid3.x0 = 100.0f;
+    grid3.y0 = -8.0f;
+    grid3.z0 = -7.0f;
+    grid3.stepY = 8.0f;
+    grid3.countX = 5;
+    grid3.countY = 9;
+    grid3.countZ = 7;
+    std::vector<float> out3(grid3.size());
+    noise3->evaluateGrid(grid3, out3);
+    for (int32_t ix = 0; ix < grid3.countX; ++ix) {
+        for (int32_t iz = 0; iz < grid3.countZ; ++iz) {
+            for (int32_t iy = 0; iy < grid3.countY; ++iy) {
+                float expected = noise3->evaluate(100.0f + static_cast<float>(ix),
+                                                  -8.0f + static_cast<float>(iy) * 8.0f,
+                                                  -7.0f + static_cast<float>(iz));
+                size_t index = static_cast<size_t>((ix * grid3.countZ + iz) * grid3.countY + iy);
+                EXPECT_NEAR(out3[index], expected, BATCH_TOLERANCE);
+            }
+        }
+    }
+}
+
+// ============================================================================
+// CoarseDensitySampler
+// ============================================================================
+
+namespace {
+
+/// Affine in every axis, so trilinear interpolation reproduces it
+class LinearNoise3D : public Noise3D {
+public:
+    float evaluate(float x, float y, float z) const override {
+        return 0.01f * x - 0.02f * y + 0.005f * z;
+    }
+};
+
+std::vector<float> sampleColumn(CoarseDensitySampler& sampler, ColumnPos pos,
+                                int32_t minY, int32_t maxY) {
+    std::vector<float> out(256 * static_cast<size_t>(maxY - minY));
+    sampler.sampleColumn(pos, minY, maxY, out);
+    return out;
+}
+
+}  // namespace
+
+TEST(CoarseDensitySamplerTest, ExactAtLatticePoints) {
+    auto noise = NoiseFactory::simplexFBM3D(21, 3, 0.015f);
+    CoarseDensitySampler sampler(*noise);
+    ColumnPos pos{-3, 5};
+    auto out = sampleColumn(sampler, pos, -16, 40);
+
+    for (int32_t lx = 0; lx < 16; lx += 4) {
+        for (int32_t lz = 0; lz < 16; lz += 4) {
+            for (int32_t y = -16; y < 40; y += 8) {
+                float expected = noise->evaluate(static_cast<float>(pos.x * 16 + lx),
+                                                 static_cast<float>(y),
+                                                 static_cast<float>(pos.z * 16 + lz));
+                EXPECT_FLOAT_EQ(out[static_cast<size_t>((lx * 16 + lz) * 56 + (y + 16))], expected);
+            }
+        }
+    }
+}
+
+TEST(CoarseDensitySamplerTest, InterpolatesBetweenLatticePoints) {
+    LinearNoise3D noise;
+    CoarseDensitySampler sampler(noise);
+    ColumnPos pos{2, -1};
+    auto out = sampleColumn(sampler, pos, 3, 29);
+
+    for (int32_t lx = 0; lx < 16; ++lx) {
+        for (int32_t lz = 0; lz < 16; ++lz) {
+            for (int32_t y = 3; y < 29; ++y) {
+                float expected = noise.evaluate(static_cast<float>(pos.x * 16 + lx),
+                                                static_cast<float>(y),
+                                                static_cast<float>(pos.z * 16 + lz));
+                EXPECT_NEAR(out[static_cast<size_t>((lx * 16 + lz) * 26 + (y - 3))], expected, 1e-4f);
+            }
+        }
+    }
+}
+
+TEST(CoarseDensitySamplerTest, NeighborsShareBorderPosts) {
+    auto noise = NoiseFactory::simplexFBM3D(22, 2, 0.02f);
+    CoarseDensitySampler sampler(*noise);
+
+    // 5x5 posts per column, one face (5 posts) shared with the neighbor
+    sampleColumn(sampler, ColumnPos{0, 0}, 0, 64);
+    EXPECT_EQ(sampler.stats().postsComputed.load(), 25u);
+    sampleColumn(sampler, ColumnPos{1, 0}, 0, 64);
+    EXPECT_EQ(sampler.stats().postsComputed.load(), 45u);
+    EXPECT_EQ(sampler.stats().postsReused.load(), 5u);
+
+    // Shared posts give identical values on the shared face
+    auto a = sampleColumn(sampler, ColumnPos{0, 0}, 0, 64);
+    auto b = sampleColumn(sampler, ColumnPos{1, 0}, 0, 64);
+    EXPECT_EQ(sampler.stats().postsComputed.load(), 45u);
+
+    // Matches a fresh sampler: caching never changes results
+    CoarseDensitySampler fresh(*noise);
+    EXPECT_EQ(sampleColumn(fresh, ColumnPos{1, 0}, 0, 64), b);
+    EXPECT_NE(a, b);
+}
+
+TEST(CoarseDensitySamplerTest, ExtendsCachedPosts) {
+    auto noise = NoiseFactory::simplexFBM3D(23, 2, 0.02f);
+    CoarseDensitySampler sampler(*noise);
+    sampleColumn(sampler, ColumnPos{4, 4}, 0, 32);
+    uint64_t samples = sampler.stats().samplesEvaluated.load();
+
+    // Taller request re-evaluates the posts, then both ranges are cached
+    auto tall = sampleColumn(sampler, ColumnPos{4, 4}, 0, 96);
+    EXPECT_GT(sampler.stats().samplesEvaluated.load(), samples);
+    samples = sampler.stats().samplesEvaluated.load();
+    auto shortAgain = sampleColumn(sampler, ColumnPos{4, 4}, 0, 32);
+    EXPECT_EQ(sampler.stats().samplesEvaluated.load(), samples);
+
+    for (size_t column = 0; column < 256; ++column) {
+        for (size_t y = 0; y < 32; ++y) {
+            ASSERT_EQ(shortAgain[column * 32 + y], tall[column * 96 + y]);
+        }
+    }
+}
+
+TEST(CoarseDensitySamplerTest, RejectsBadCellSize) {
+    LinearNoise3D noise;
+    EXPECT_THROW(CoarseDensitySampler(noise, 3, 8), std::invalid_argument);
+    EXPECT_THROW(CoarseDensitySampler(noise, 4, 0), std::invalid_argument);
+}
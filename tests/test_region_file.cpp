@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "finevox/core/region_file.hpp"
 #include "finevox/core/config.hpp"
+#include "finevox/core/serialization.hpp"
 #include <filesystem>
 #include <cstdlib>
 
@@ -577,3 +578,378 @@ TEST_F(RegionFileTest, CompressionReducesFileSize) {
 
     ConfigManager::instance().reset();
 }
+
+// ============================================================================
+// Dictionary Compression Tests
+// ============================================================================
+
+namespace {
+
+// Column with a few distinct block types and light so the CBOR resembles
+// real terrain (palette strings, repeated keys, light arrays)
+ChunkColumn makeTerrainColumn(ColumnPos pos, int height) {
+    BlockTypeId stone = BlockTypeId::fromName("test:stone");
+    BlockTypeId dirt = BlockTypeId::fromName("test:dirt");
+    BlockTypeId grass = BlockTypeId::fromName("test:grass");
+
+    ChunkColumn col(pos);
+    for (int x = 0; x < 16; ++x) {
+        for (int z = 0; z < 16; ++z) {
+            int top = height + (x + z) % 3;
+            for (int y = 0; y < top - 3; ++y) col.setBlock(x, y, z, stone);
+            for (int y = top - 3; y < top; ++y) col.setBlock(x, y, z, dirt);
+            col.setBlock(x, top, z, grass);
+        }
+    }
+    return col;
+}
+
+}  // namespace
+
+TEST(CompressionDictionaryTest, ChunkFlagsDictionaryId) {
+    uint32_t flags = ChunkFlags::COMPRESSED_LZ4 | ChunkFlags::LZ4_DICTIONARY;
+    flags = ChunkFlags::withDictionaryId(flags, 7);
+    EXPECT_EQ(ChunkFlags::dictionaryId(flags), 7);
+    EXPECT_TRUE(flags & ChunkFlags::COMPRESSED_LZ4);
+    EXPECT_TRUE(flags & ChunkFlags::LZ4_DICTIONARY);
+
+    flags = ChunkFlags::withDictionaryId(flags, 200);
+    EXPECT_EQ(ChunkFlags::dictionaryId(flags), 200);
+}
+
+TEST(CompressionDictionaryTest, TrainingIsDeterministicAndBounded) {
+    std::vector<std::vector<uint8_t>> samples;
+    for (int i = 0; i < 8; ++i) {
+        samples.push_back(ColumnSerializer::toCBOR(makeTerrainColumn(ColumnPos{i, 0}, 20 + i), i, 0));
+    }
+
+    auto dict1 = trainCompressionDictionary(samples, 4096);
+    auto dict2 = trainCompressionDictionary(samples, 4096);
+    EXPECT_FALSE(dict1.empty());
+    EXPECT_LE(dict1.size(), 4096u);
+    EXPECT_EQ(dict1, dict2);
+
+    EXPECT_TRUE(trainCompressionDictionary({}).empty());
+}
+
+TEST_F(RegionFileTest, DictionaryTrainedAfterSamples) {
+    ConfigManager::instance().init(tempDir / "config.cbor");
+    ConfigManager::instance().setCompressionDictionaryEnabled(true);
+
+    {
+        RegionFile region(tempDir, RegionPos{0, 0});
+        for (int i = 0; i < static_cast<int>(DICTIONARY_TRAINING_SAMPLES) + 8; ++i) {
+            ColumnPos pos{i % REGION_SIZE, i / REGION_SIZE};
+            EXPECT_TRUE(region.saveColumn(makeTerrainColumn(pos, 20 + i % 5), pos));
+            if (i + 1 < static_cast<int>(DICTIONARY_TRAINING_SAMPLES)) {
+                EXPECT_EQ(region.activeDictionaryId(), 0);
+            }
+        }
+        EXPECT_EQ(region.dictionaryCount(), 1u);
+        EXPECT_EQ(region.activeDictionaryId(), 1);
+    }
+    EXPECT_TRUE(std::filesystem::exists(tempDir / "r.0.0.dict"));
+
+    // Dictionary is reloaded from disk, and both plain and dictionary
+    // compressed columns decode
+    {
+        RegionFile region(tempDir, RegionPos{0, 0});
+        EXPECT_EQ(region.dictionaryCount(), 1u);
+        for (int i = 0; i < static_cast<int>(DICTIONARY_TRAINING_SAMPLES) + 8; ++i) {
+            ColumnPos pos{i % REGION_SIZE, i / REGION_SIZE};
+            auto loaded = region.loadColumn(pos);
+            ASSERT_NE(loaded, nullptr);
+            EXPECT_EQ(loaded->getBlock(0, 0, 0), BlockTypeId::fromName("test:stone"));
+            EXPECT_EQ(loaded->getBlock(1, 20 + i % 5 + 1, 0), BlockTypeId::fromName("test:grass"));
+        }
+    }
+
+    ConfigManager::instance().reset();
+}
+
+TEST_F(RegionFileTest, DictionaryReducesFileSize) {
+    ConfigManager::instance().init(tempDir / "config.cbor");
+
+    std::vector<std::vector<uint8_t>> samples;
+    for (int i = 0; i < 8; ++i) {
+        samples.push_back(ColumnSerializer::toCBOR(makeTerrainColumn(ColumnPos{i, 0}, 20 + i), i, 0));
+    }
+    auto dictionary = trainCompressionDictionary(samples);
+
+    auto writeAll = [&](const std::filesystem::path& dir, bool useDictionary) {
+        ConfigManager::instance().setCompressionDictionaryEnabled(useDictionary);
+        RegionFile region(dir, RegionPos{0, 0});
+        if (useDictionary) {
+            EXPECT_EQ(region.addDictionary(dictionary), std::optional<uint8_t>(1));
+        }
+        for (int i = 0; i < 16; ++i) {
+            ColumnPos pos{i, 1};
+            EXPECT_TRUE(region.saveColumn(makeTerrainColumn(pos, 24 + i % 7), pos));
+        }
+        return region.dataFileSize();
+    };
+
+    uint64_t plainSize = writeAll(tempDir / "plain", false);
+    uint64_t dictSize = writeAll(tempDir / "dict", true);
+    EXPECT_LT(dictSize, plainSize);
+
+    ConfigManager::instance().reset();
+}
+
+TEST_F(RegionFileTest, DictionaryColumnUnreadableWithoutDictionary) {
+    ConfigManager::instance().init(tempDir / "config.cbor");
+    ConfigManager::instance().setCompressionDictionaryEnabled(true);
+
+    std::vector<std::vector<uint8_t>> samples{
+        ColumnSerializer::toCBOR(makeTerrainColumn(ColumnPos{0, 0}, 20), 0, 0),
+        ColumnSerializer::toCBOR(makeTerrainColumn(ColumnPos{1, 0}, 21), 1, 0)};
+    {
+        RegionFile region(tempDir, RegionPos{0, 0});
+        ASSERT_TRUE(region.addDictionary(trainCompressionDictionary(samples)).has_value());
+        EXPECT_TRUE(region.saveColumn(makeTerrainColumn(ColumnPos{1, 1}, 22), ColumnPos{1, 1}));
+    }
+
+    std::filesystem::remove(tempDir / "r.0.0.dict");
+    RegionFile region(tempDir, RegionPos{0, 0});
+    EXPECT_TRUE(region.hasColumn(ColumnPos{1, 1}));
+    EXPECT_EQ(region.loadColumn(ColumnPos{1, 1}), nullptr);
+
+    ConfigManager::instance().reset();
+}
+
+TEST_F(RegionFileTest, DictionaryAppendAfterTruncatedEntry) {
+    ConfigManager::instance().init(tempDir / "config.cbor");
+    ConfigManager::instance().setCompressionDictionaryEnabled(true);
+
+    std::vector<std::vector<uint8_t>> samples{
+        ColumnSerializer::toCBOR(makeTerrainColumn(ColumnPos{0, 0}, 20), 0, 0),
+        ColumnSerializer::toCBOR(makeTerrainColumn(ColumnPos{1, 0}, 21), 1, 0)};
+    auto dictionary = trainCompressionDictionary(samples);
+    auto dictPath = tempDir / "r.0.0.dict";
+    {
+        RegionFile region(tempDir, RegionPos{0, 0});
+        ASSERT_EQ(region.addDictionary(dictionary), std::optional<uint8_t>(1));
+        EXPECT_TRUE(region.saveColumn(makeTerrainColumn(ColumnPos{1, 1}, 22), ColumnPos{1, 1}));
+        ASSERT_EQ(region.addDictionary(dictionary), std::optional<uint8_t>(2));
+    }
+
+    // Interrupted append: the second entry loses its tail
+    std::filesystem::resize_file(dictPath, std::filesystem::file_size(dictPath) - 100);
+
+    {
+        RegionFile region(tempDir, RegionPos{0, 0});
+        EXPECT_EQ(region.dictionaryCount(), 1u);
+        EXPECT_EQ(region.activeDictionaryId(), 1);
+
+        // The damaged id is not reused
+        ASSERT_EQ(region.addDictionary(dictionary), std::optional<uint8_t>(3));
+        EXPECT_TRUE(region.saveColumn(makeTerrainColumn(ColumnPos{2, 1}, 23), ColumnPos{2, 1}));
+    }
+
+    RegionFile region(tempDir, RegionPos{0, 0});
+    EXPECT_EQ(region.dictionaryCount(), 2u);
+    EXPECT_EQ(region.activeDictionaryId(), 3);
+    auto first = region.loadColumn(ColumnPos{1, 1});
+    auto second = region.loadColumn(ColumnPos{2, 1});
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second->getBlock(1, 24, 0), BlockTypeId::fromName("test:grass"));
+
+    ConfigManager::instance().reset();
+}
+
+// ============================================================================
+// Compression Policy Tests
+// ============================================================================
+
+TEST(CompressionPolicyTest, CodecNames) {
+    EXPECT_EQ(compressionCodecName(CompressionCodec::None), "none");
+    EXPECT_EQ(compressionCodecName(CompressionCodec::LZ4), "lz4");
+    EXPECT_EQ(compressionCodecName(CompressionCodec::LZ4HC), "lz4hc");
+    EXPECT_EQ(compressionCodecFromName("lz4hc"), CompressionCodec::LZ4HC);
+    EXPECT_EQ(compressionCodecFromName("zstd"), std::nullopt);
+}
+
+TEST(CompressionPolicyTest, CodecRecordedInFlags) {
+    EXPECT_EQ(chunkCodec(0), CompressionCodec::None);
+    EXPECT_EQ(chunkCodec(ChunkFlags::COMPRESSED_LZ4), CompressionCodec::LZ4);
+    EXPECT_EQ(chunkCodec(ChunkFlags::COMPRESSED_LZ4 | ChunkFlags::COMPRESSED_LZ4HC),
+              CompressionCodec::LZ4HC);
+
+    CompressionPolicy cold = CompressionPolicy::cold();
+    EXPECT_TRUE(cold.matches(ChunkFlags::COMPRESSED_LZ4 | ChunkFlags::COMPRESSED_LZ4HC));
+    EXPECT_FALSE(cold.matches(ChunkFlags::COMPRESSED_LZ4));
+    EXPECT_FALSE(CompressionPolicy{}.matches(0));
+}
+
+TEST_F(RegionFileTest, PolicyCodecsRoundTrip) {
+    ConfigManager::instance().init(tempDir / "config.cbor");
+
+    CompressionPolicy none{CompressionCodec::None};
+    CompressionPolicy fast{CompressionCodec::LZ4};
+    CompressionPolicy hc{CompressionCodec::LZ4HC, CompressionPolicy::HC_LEVEL_MAX};
+
+    RegionFile region(tempDir, RegionPos{0, 0});
+    ColumnPos posNone{0, 0}, posFast{1, 0}, posHc{2, 0};
+    auto data = ColumnSerializer::toCBOR(makeTerrainColumn(posNone, 30), 0, 0);
+    EXPECT_TRUE(region.saveColumnRaw(posNone, data, none));
+    EXPECT_TRUE(region.saveColumnRaw(posFast, data, fast));
+    EXPECT_TRUE(region.saveColumnRaw(posHc, data, hc));
+
+    EXPECT_EQ(region.columnFlags(posNone), std::optional<uint32_t>(0));
+    EXPECT_EQ(region.columnFlags(posFast), std::optional<uint32_t>(ChunkFlags::COMPRESSED_LZ4));
+    EXPECT_EQ(region.columnFlags(posHc),
+              std::optional<uint32_t>(ChunkFlags::COMPRESSED_LZ4 | ChunkFlags::COMPRESSED_LZ4HC));
+    EXPECT_EQ(region.columnFlags(ColumnPos{3, 0}), std::nullopt);
+
+    EXPECT_EQ(region.loadColumnRaw(posNone), data);
+    EXPECT_EQ(region.loadColumnRaw(posFast), data);
+    EXPECT_EQ(region.loadColumnRaw(posHc), data);
+
+    ConfigManager::instance().reset();
+}
+
+TEST_F(RegionFileTest, CodecFromConfig) {
+    ConfigManager::instance().init(tempDir / "config.cbor");
+    ConfigManager::instance().setCompressionCodec("lz4hc");
+    ConfigManager::instance().setCompressionHCLevel(6);
+
+    CompressionPolicy policy = CompressionPolicy::fromConfig();
+    EXPECT_EQ(policy.codec, CompressionCodec::LZ4HC);
+    EXPECT_EQ(policy.hcLevel, 6);
+
+    RegionFile region(tempDir, RegionPos{0, 0});
+    EXPECT_TRUE(region.saveColumn(makeTerrainColumn(ColumnPos{0, 0}, 20), ColumnPos{0, 0}));
+    EXPECT_EQ(chunkCodec(region.columnFlags(ColumnPos{0, 0}).value_or(0)), CompressionCodec::LZ4HC);
+
+    ConfigManager::instance().setCompressionEnabled(false);
+    EXPECT_EQ(CompressionPolicy::fromConfig().codec, CompressionCodec::None);
+
+    ConfigManager::instance().reset();
+}
+
+TEST_F(RegionFileTest, HighCompressionIsSmaller) {
+    ConfigManager::instance().init(tempDir / "config.cbor");
+
+    // Scatter ore through the stone so there is something for HC to find
+    BlockTypeId ore = BlockTypeId::fromName("test:ore");
+    auto makeOreColumn = [&](ColumnPos pos) {
+        ChunkColumn col = makeTerrainColumn(pos, 40);
+        uint32_t h = 0x9E3779B9u * static_cast<uint32_t>(pos.x + 1);
+        for (int n = 0; n < 400; ++n) {
+            h ^= h << 13; h ^= h >> 17; h ^= h << 5;
+            col.setBlock(h % 16, (h >> 4) % 36, (h >> 12) % 16, ore);
+        }
+        return col;
+    };
+
+    auto writeAll = [&](const std::filesystem::path& dir, const CompressionPolicy& policy) {
+        RegionFile region(dir, RegionPos{0, 0});
+        for (int i = 0; i < 16; ++i) {
+            ColumnPos pos{i, 0};
+            auto data = ColumnSerializer::toCBOR(makeOreColumn(pos), pos.x, pos.z);
+            EXPECT_TRUE(region.saveColumnRaw(pos, data, policy));
+        }
+        return region.dataFileSize();
+    };
+
+    uint64_t fastSize = writeAll(tempDir / "fast", CompressionPolicy{CompressionCodec::LZ4});
+    uint64_t hcSize = writeAll(tempDir / "hc", CompressionPolicy::cold());
+    EXPECT_LT(hcSize, fastSize);
+
+    ConfigManager::instance().reset();
+}
+
+TEST_F(RegionFileTest, RecompressToColdPolicy) {
+    ConfigManager::instance().init(tempDir / "config.cbor");
+
+    constexpr int COLUMNS = 16;
+    {
+        RegionFile region(tempDir, RegionPos{0, 0});
+        for (int i = 0; i < COLUMNS; ++i) {
+            ColumnPos pos{i, 0};
+            EXPECT_TRUE(region.saveColumn(makeTerrainColumn(pos, 20 + i % 7), pos));
+        }
+
+        EXPECT_EQ(region.recompress(CompressionPolicy::cold()), static_cast<size_t>(COLUMNS));
+        // Already matching: nothing to do
+        EXPECT_EQ(region.recompress(CompressionPolicy::cold()), 0u);
+    }
+
+    RegionFile region(tempDir, RegionPos{0, 0});
+    for (int i = 0; i < COLUMNS; ++i) {
+        ColumnPos pos{i, 0};
+        EXPECT_EQ(chunkCodec(region.columnFlags(pos).value_or(0)), CompressionCodec::LZ4HC);
+        auto loaded = region.loadColumn(pos);
+        ASSERT_NE(loaded, nullptr);
+        EXPECT_EQ(loaded->getBlock(0, 0, 0), BlockTypeId::fromName("test:stone"));
+    }
+
+    ConfigManager::instance().reset();
+}
+
+TEST_F(RegionFileTest, RecompressSkipsIncompressibleColumns) {
+    ConfigManager::instance().init(tempDir / "config.cbor");
+
+    // Noise LZ4 can't shrink, so the write falls back to storing it raw
+    std::vector<uint8_t> noise(4096);
+    uint32_t state = 12345;
+    for (auto& byte : noise) {
+        state = state * 1664525u + 1013904223u;
+        byte = static_cast<uint8_t>(state >> 24);
+    }
+
+    RegionFile region(tempDir, RegionPos{0, 0});
+    ColumnPos pos{0, 0};
+    EXPECT_TRUE(region.saveColumnRaw(pos, noise, CompressionPolicy::cold()));
+    EXPECT_EQ(chunkCodec(region.columnFlags(pos).value_or(0)), CompressionCodec::None);
+
+    // A cold pass must not keep re-encoding it
+    EXPECT_EQ(region.recompress(CompressionPolicy::cold()), 0u);
+    EXPECT_EQ(region.loadColumnRaw(pos), noise);
+
+    ConfigManager::instance().reset();
+}
+
+// ============================================================================
+// Captured Index Tests
+// ============================================================================
+
+TEST_F(RegionFileTest, ReopenWithCapturedIndex) {
+    BlockTypeId stone = BlockTypeId::fromName("test:stone");
+    RegionIndex index;
+    {
+        RegionFile region(tempDir, RegionPos{0, 0});
+        for (int i = 0; i < 8; ++i) {
+            ChunkColumn col(ColumnPos{i, 0});
+            col.setBlock(0, i, 0, stone);
+            EXPECT_TRUE(region.saveColumn(col, ColumnPos{i, 0}));
+        }
+        // Overwrite one so the index carries a free span
+        ChunkColumn col(ColumnPos{0, 0});
+        col.setBlock(0, 5, 0, stone);
+        EXPECT_TRUE(region.saveColumn(col, ColumnPos{0, 0}));
+        EXPECT_FALSE(region.indexReused());
+        index = region.captureIndex();
+    }
+    EXPECT_EQ(index.entries.size(), 8u);
+
+    {
+        RegionFile region(tempDir, RegionPos{0, 0}, index);
+        EXPECT_TRUE(region.indexReused());
+        EXPECT_EQ(region.getExistingColumns().size(), 8u);
+        auto loaded = region.loadColumn(ColumnPos{0, 0});
+        ASSERT_NE(loaded, nullptr);
+        EXPECT_EQ(loaded->getBlock(0, 5, 0), stone);
+
+        ChunkColumn col(ColumnPos{9, 9});
+        col.setBlock(1, 1, 1, stone);
+        EXPECT_TRUE(region.saveColumn(col, ColumnPos{9, 9}));
+    }
+
+    // Files changed since the capture: the stale index is ignored
+    RegionFile region(tempDir, RegionPos{0, 0}, index);
+    EXPECT_FALSE(region.indexReused());
+    EXPECT_TRUE(region.hasColumn(ColumnPos{9, 9}));
+    EXPECT_EQ(region.getExistingColumns().size(), 9u);
+}
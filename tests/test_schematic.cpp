@@ -3,17 +3,21 @@
  * @brief Unit tests for schematic system
  *
  * Tests: Schematic creation, access, iteration, transforms,
- * CBOR serialization round-trip, file I/O, ClipboardManager.
+ * CBOR serialization round-trip, file I/O, ClipboardManager, placement.
  */
 
 #include "finevox/worldgen/schematic.hpp"
 #include "finevox/worldgen/schematic_io.hpp"
 #include "finevox/worldgen/clipboard_manager.hpp"
+#include "finevox/worldgen/schematic_paste.hpp"
+#include "finevox/core/subchunk.hpp"
+#include "finevox/core/world.hpp"
 
 #include <gtest/gtest.h>
 
 #include <filesystem>
 #include <fstream>
+#include <utility>
 
 using namespace finevox;
 using namespace finevox::worldgen;
@@ -156,6 +160,132 @@ TEST(SchematicTest, Metadata) {
     EXPECT_EQ(s.author(), "Author");
 }
 
+// ============================================================================
+// Palette storage tests
+// ============================================================================
+
+TEST(SchematicPaletteTest, IndexWidthGrowsWithPalette) {
+    Schematic s(8, 8, 8);
+    EXPECT_EQ(s.bitsPerIndex(), 0);
+
+    s.setBlock(0, 0, 0, "stone");
+    EXPECT_EQ(s.bitsPerIndex(), 1);
+    s.setBlock(1, 0, 0, "dirt");
+    EXPECT_EQ(s.bitsPerIndex(), 2);
+
+    for (int32_t i = 0; i < 20; ++i) {
+        s.setBlock(i % 8, 1 + i / 8, 0, "type" + std::to_string(i));
+    }
+    EXPECT_EQ(s.bitsPerIndex(), 8);
+
+    // Earlier cells survive each repack
+    EXPECT_EQ(s.at(0, 0, 0).typeName, "stone");
+    EXPECT_EQ(std::as_const(s).at(1, 0, 0).typeName, "dirt");
+    EXPECT_EQ(std::as_const(s).at(3, 2, 0).typeName, "type11");
+    EXPECT_EQ(s.nonAirBlockCount(), 22u);
+}
+
+TEST(SchematicPaletteTest, RotationIsPartOfPaletteEntry) {
+    Schematic s(4, 1, 1);
+    s.setBlock(0, 0, 0, "stairs", Rotation::byIndex(1));
+    s.setBlock(1, 0, 0, "stairs", Rotation::byIndex(1));
+    s.setBlock(2, 0, 0, "stairs", Rotation::byIndex(2));
+    s.setBlock(3, 0, 0, "stairs");
+
+    EXPECT_EQ(s.palette().size(), 4u);  // Air + three rotations
+    EXPECT_TRUE(s.sideTable().empty());
+    const Schematic& cs = s;
+    EXPECT_EQ(cs.at(1, 0, 0).rotation.index(), 1);
+    EXPECT_EQ(cs.at(2, 0, 0).rotation.index(), 2);
+    EXPECT_TRUE(cs.at(3, 0, 0).rotation.isIdentity());
+    EXPECT_EQ(cs.paletteIndex(0, 0, 0), cs.paletteIndex(1, 0, 0));
+}
+
+TEST(SchematicPaletteTest, SideTableHoldsDisplacementAndData) {
+    Schematic s(2, 2, 2);
+    BlockSnapshot chest("chest");
+    chest.extraData = DataContainer();
+    chest.extraData->set<int64_t>("items", 7);
+    s.set(0, 0, 0, std::move(chest));
+    BlockSnapshot slab("slab");
+    slab.displacement = glm::vec3(0.0f, 0.5f, 0.0f);
+    s.set(1, 0, 0, std::move(slab));
+    s.set(0, 1, 0, BlockSnapshot("stone"));
+
+    EXPECT_EQ(s.sideTable().size(), 2u);
+    const Schematic& cs = s;
+    EXPECT_EQ(cs.paletteIndex(0, 0, 0), Schematic::NO_PALETTE_INDEX);
+    EXPECT_NE(cs.paletteIndex(0, 1, 0), Schematic::NO_PALETTE_INDEX);
+    ASSERT_TRUE(cs.at(0, 0, 0).extraData.has_value());
+    EXPECT_EQ(cs.at(0, 0, 0).extraData->get<int64_t>("items"), 7);
+    EXPECT_FLOAT_EQ(cs.at(1, 0, 0).displacement.y, 0.5f);
+
+    // Overwriting with a plain block drops the side entry
+    s.setBlock(0, 0, 0, "stone");
+    EXPECT_EQ(s.sideTable().size(), 1u);
+    EXPECT_FALSE(cs.at(0, 0, 0).extraData.has_value());
+}
+
+TEST(SchematicPaletteTest, CompactFoldsEditsAndDropsUnusedEntries) {
+    Schematic s(16, 16, 16);
+    for (int32_t x = 0; x < 16; ++x) {
+        for (int32_t y = 0; y < 16; ++y) {
+            s.setBlock(x, y, 0, "type" + std::to_string((x + y) % 5));
+        }
+    }
+    EXPECT_EQ(s.bitsPerIndex(), 4);
+
+    // Edits go to the side table until compact()
+    s.at(0, 0, 1).typeName = "stone";
+    s.at(1, 0, 1).typeName = "stone";
+    s.at(1, 0, 1).rotation = Rotation::byIndex(3);
+    EXPECT_EQ(s.sideTable().size(), 2u);
+
+    // Leave only two of the five types in the first slice
+    for (int32_t x = 0; x < 16; ++x) {
+        for (int32_t y = 0; y < 16; ++y) {
+            s.setBlock(x, y, 0, (x + y) % 2 == 0 ? "type0" : "type1");
+        }
+    }
+
+    s.compact();
+    EXPECT_TRUE(s.sideTable().empty());
+    EXPECT_EQ(s.palette().size(), 5u);  // Air, type0, type1, stone, rotated stone
+    EXPECT_EQ(s.bitsPerIndex(), 4);
+    const Schematic& cs = s;
+    EXPECT_EQ(cs.at(0, 0, 1).typeName, "stone");
+    EXPECT_EQ(cs.at(1, 0, 1).rotation.index(), 3);
+    EXPECT_EQ(cs.at(3, 4, 0).typeName, "type1");
+    EXPECT_EQ(s.nonAirBlockCount(), 258u);
+    EXPECT_EQ(s.uniqueBlockTypes().size(), 3u);
+
+    // Clearing everything but one type narrows to one bit
+    for (int32_t x = 0; x < 16; ++x) {
+        for (int32_t y = 0; y < 16; ++y) {
+            s.setBlock(x, y, 0, "air");
+        }
+    }
+    s.setBlock(1, 0, 1, "stone");
+    s.compact();
+    EXPECT_EQ(s.palette().size(), 2u);
+    EXPECT_EQ(s.bitsPerIndex(), 1);
+}
+
+TEST(SchematicPaletteTest, MemoryFarBelowDenseSnapshots) {
+    Schematic s(64, 64, 64);
+    const char* types[] = {"stone", "dirt", "glass", "planks"};
+    for (int32_t x = 0; x < 64; ++x)
+        for (int32_t z = 0; z < 64; ++z)
+            for (int32_t y = 0; y < 64; ++y)
+                s.setBlock(x, y, z, types[(x + y + z) % 4]);
+
+    // 3 bits needed, rounded to 4: half a byte per cell plus small overhead
+    EXPECT_EQ(s.bitsPerIndex(), 4);
+    size_t volume = static_cast<size_t>(s.volume());
+    EXPECT_LT(s.memoryUsage(), volume / 2 + 4096);
+    EXPECT_LT(s.memoryUsage() * 100, volume * sizeof(BlockSnapshot));
+}
+
 // ============================================================================
 // Transformation tests
 // ============================================================================
@@ -444,3 +574,203 @@ TEST(ClipboardManagerTest, History) {
     EXPECT_EQ(mgr.historyAt(2)->at(0, 0, 0).typeName, "block2");
     EXPECT_EQ(mgr.historyAt(3), nullptr);  // Out of bounds
 }
+
+TEST(ClipboardManagerTest, HistoryMemoryBudget) {
+    auto& mgr = ClipboardManager::instance();
+    mgr.clearAll();
+    mgr.setMaxHistorySize(100);
+
+    auto make = [](int i) {
+        Schematic s(32, 32, 32);
+        for (int32_t x = 0; x < 32; ++x)
+            for (int32_t y = 0; y < 32; ++y)
+                s.at(x, y, 0).typeName = "block" + std::to_string(i);  // Compacted on push
+        return s;
+    };
+
+    mgr.pushHistory(make(0));
+    size_t perEntry = mgr.historyMemoryUsage();
+    EXPECT_TRUE(mgr.historyAt(0)->sideTable().empty());
+    EXPECT_LT(perEntry, 32u * 32 * 32 / 4);
+
+    mgr.setMaxHistoryMemory(perEntry * 5 + perEntry / 2);
+    for (int i = 1; i < 10; ++i) {
+        mgr.pushHistory(make(i));
+    }
+    EXPECT_EQ(mgr.historySize(), 5u);
+    EXPECT_EQ(mgr.historyAt(0)->at(0, 0, 0).typeName, "block9");
+    EXPECT_EQ(mgr.historyAt(4)->at(0, 0, 0).typeName, "block5");
+    EXPECT_LE(mgr.historyMemoryUsage(), perEntry * 5 + perEntry / 2);
+
+    // The newest entry is kept even over budget
+    mgr.setMaxHistoryMemory(1);
+    EXPECT_EQ(mgr.historySize(), 1u);
+
+    mgr.setMaxHistoryMemory(size_t{256} << 20);
+    mgr.setMaxHistorySize(64);
+    mgr.clearAll();
+    EXPECT_EQ(mgr.historyMemoryUsage(), 0u);
+}
+
+// ============================================================================
+// Placement tests
+// ============================================================================
+
+namespace {
+
+/// 37x21x29 structure with runs, holes, rotations and a few data blocks
+Schematic makePasteSchematic() {
+    Schematic s(37, 21, 29);
+    const char* types[] = {"paste:stone", "paste:brick", "paste:glass", "paste:log"};
+    for (int32_t x = 0; x < s.sizeX(); ++x) {
+        for (int32_t z = 0; z < s.sizeZ(); ++z) {
+            for (int32_t y = 0; y < s.sizeY(); ++y) {
+                int32_t h = (x * 7 + z * 3 + y) % 11;
+                if (h < 3) continue;  // Air
+                auto& snap = s.at(x, y, z);
+                snap.typeName = types[(x / 5 + y / 3 + z) % 4];
+                snap.rotation = Rotation::byIndex(static_cast<uint8_t>((x + z) % 24));
+                if (h == 10 && y % 4 == 0) {
+                    snap.extraData = DataContainer();
+                    snap.extraData->set<int64_t>("slot", x * 1000 + y * 100 + z);
+                }
+            }
+        }
+    }
+    return s;
+}
+
+/// Place block by block through World::setBlock (no air, no metadata)
+void placePerBlock(World& world, const Schematic& s, BlockPos origin) {
+    s.forEachBlock([&](glm::ivec3 pos, const BlockSnapshot& snap) {
+        world.setBlock(origin.x + pos.x, origin.y + pos.y, origin.z + pos.z,
+                       BlockTypeId::fromName(snap.typeName));
+    });
+}
+
+void fillBox(World& world, BlockPos lo, BlockPos hi, BlockTypeId type) {
+    for (int32_t x = lo.x; x <= hi.x; ++x)
+        for (int32_t y = lo.y; y <= hi.y; ++y)
+            for (int32_t z = lo.z; z <= hi.z; ++z)
+                world.setBlock(x, y, z, type);
+}
+
+/// Block types and rotations in the box around the paste must match
+void expectSameRegion(const World& a, const World& b, BlockPos lo, BlockPos hi) {
+    for (int32_t x = lo.x; x <= hi.x; ++x) {
+        for (int32_t y = lo.y; y <= hi.y; ++y) {
+            for (int32_t z = lo.z; z <= hi.z; ++z) {
+                ASSERT_EQ(a.getBlock(x, y, z), b.getBlock(x, y, z))
+                    << "at " << x << "," << y << "," << z;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST(SchematicPasteTest, MatchesPerBlockPlacementForAnyThreadCount) {
+    Schematic s = makePasteSchematic();
+    BlockPos origin(-21, -5, 7);  // Not subchunk aligned, crosses zero
+    BlockPos lo(origin.x - 2, origin.y - 2, origin.z - 2);
+    BlockPos hi(origin.x + s.sizeX() + 1, origin.y + s.sizeY() + 1, origin.z + s.sizeZ() + 1);
+
+    BlockTypeId dirt = BlockTypeId::fromName("paste:dirt");
+    World reference;
+    fillBox(reference, BlockPos(lo.x, lo.y, lo.z), BlockPos(hi.x, origin.y + 3, hi.z), dirt);
+    placePerBlock(reference, s, origin);
+
+    for (size_t threads : {1u, 3u, 8u}) {
+        World world;
+        fillBox(world, BlockPos(lo.x, lo.y, lo.z), BlockPos(hi.x, origin.y + 3, hi.z), dirt);
+        PlaceOptions options;
+        options.threads = threads;
+        PlaceResult result = placeSchematic(world, s, origin, options);
+
+        EXPECT_EQ(result.blocksPlaced, s.nonAirBlockCount());
+        // 37 x 21 x 29 from (-21, -5, 7) spans 3 x 2 x 3 subchunks
+        EXPECT_EQ(result.subChunksTouched, 18u);
+        EXPECT_EQ(result.columnsTouched, 9u);
+        expectSameRegion(world, reference, lo, hi);
+    }
+
+    // Same result once edits are folded into the palette
+    Schematic packed = makePasteSchematic();
+    packed.compact();
+    World world;
+    fillBox(world, BlockPos(lo.x, lo.y, lo.z), BlockPos(hi.x, origin.y + 3, hi.z), dirt);
+    PlaceOptions options;
+    options.threads = 4;
+    placeSchematic(world, packed, origin, options);
+    expectSameRegion(world, reference, lo, hi);
+}
+
+TEST(SchematicPasteTest, WritesRotationAndBlockData) {
+    Schematic s = makePasteSchematic();
+    BlockPos origin(5, 40, -30);
+
+    World world;
+    PlaceOptions options;
+    options.threads = 4;
+    placeSchematic(world, s, origin, options);
+
+    size_t dataBlocks = 0;
+    s.forEachBlock([&](glm::ivec3 pos, const BlockSnapshot& snap) {
+        BlockPos worldPos(origin.x + pos.x, origin.y + pos.y, origin.z + pos.z);
+        const SubChunk* subChunk = world.getSubChunk(ChunkPos::fromBlock(worldPos));
+        ASSERT_NE(subChunk, nullptr);
+        int32_t lx = worldPos.x & 15, ly = worldPos.y & 15, lz = worldPos.z & 15;
+        EXPECT_EQ(subChunk->getRotationIndex(lx, ly, lz), snap.rotation.index());
+        const DataContainer* data = subChunk->blockData(lx, ly, lz);
+        if (snap.extraData) {
+            ASSERT_NE(data, nullptr);
+            EXPECT_EQ(data->get<int64_t>("slot"), snap.extraData->get<int64_t>("slot"));
+            ++dataBlocks;
+        } else {
+            EXPECT_EQ(data, nullptr);
+        }
+    });
+    EXPECT_GT(dataBlocks, 0u);
+}
+
+TEST(SchematicPasteTest, AirAndReplaceOptions) {
+    Schematic s(4, 4, 4);
+    for (int32_t x = 0; x < 4; ++x)
+        for (int32_t z = 0; z < 4; ++z)
+            s.at(x, 0, z).typeName = "paste:floor";
+
+    BlockTypeId dirt = BlockTypeId::fromName("paste:dirt");
+    BlockTypeId floor = BlockTypeId::fromName("paste:floor");
+
+    // Default: air cells leave the world alone, non-air replaces
+    World keep;
+    fillBox(keep, BlockPos(0, 0, 0), BlockPos(3, 3, 3), dirt);
+    placeSchematic(keep, s, BlockPos(0, 0, 0));
+    EXPECT_EQ(keep.getBlock(1, 0, 1), floor);
+    EXPECT_EQ(keep.getBlock(1, 2, 1), dirt);
+
+    // pasteAir clears the rest of the box
+    World clear;
+    fillBox(clear, BlockPos(0, 0, 0), BlockPos(3, 3, 3), dirt);
+    PlaceOptions withAir;
+    withAir.pasteAir = true;
+    PlaceResult result = placeSchematic(clear, s, BlockPos(0, 0, 0), withAir);
+    EXPECT_EQ(result.blocksPlaced, 64u);
+    EXPECT_EQ(clear.getBlock(1, 0, 1), floor);
+    EXPECT_TRUE(clear.getBlock(1, 2, 1).isAir());
+
+    // Air-only writes into missing subchunks create nothing
+    World empty;
+    PlaceResult none = placeSchematic(empty, Schematic(3, 3, 3), BlockPos(0, 0, 0), withAir);
+    EXPECT_EQ(none.subChunksTouched, 0u);
+    EXPECT_EQ(empty.getSubChunk(ChunkPos(0, 0, 0)), nullptr);
+
+    // replaceNonAir = false only fills air
+    World fill;
+    fill.setBlock(2, 0, 2, dirt);
+    PlaceOptions keepExisting;
+    keepExisting.replaceNonAir = false;
+    placeSchematic(fill, s, BlockPos(0, 0, 0), keepExisting);
+    EXPECT_EQ(fill.getBlock(2, 0, 2), dirt);
+    EXPECT_EQ(fill.getBlock(1, 0, 1), floor);
+}
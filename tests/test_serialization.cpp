@@ -278,6 +278,30 @@ TEST(ChunkColumnSerialization, RoundTripPreservesData) {
     }
 }
 
+TEST(ChunkColumnSerialization, GenerationStageRoundTrip) {
+    ChunkColumn column(ColumnPos{0, 0});
+    column.setBlock(0, 0, 0, BlockTypeId::fromName("test:stone"));
+
+    // Finished columns carry no stage key
+    auto complete = ColumnSerializer::toCBOR(column, 0, 0);
+    auto restored = ColumnSerializer::fromCBOR(complete);
+    ASSERT_NE(restored, nullptr);
+    EXPECT_TRUE(restored->isGenerationComplete());
+
+    column.setGenerationStage(3000);
+    auto partial = ColumnSerializer::toCBOR(column, 0, 0);
+    EXPECT_GT(partial.size(), complete.size());
+    restored = ColumnSerializer::fromCBOR(partial);
+    ASSERT_NE(restored, nullptr);
+    EXPECT_EQ(restored->generationStage(), 3000);
+    EXPECT_FALSE(restored->isGenerationComplete());
+
+    column.setGenerationStage(ChunkColumn::GENERATION_NOT_STARTED);
+    restored = ColumnSerializer::fromCBOR(ColumnSerializer::toCBOR(column, 0, 0));
+    ASSERT_NE(restored, nullptr);
+    EXPECT_EQ(restored->generationStage(), ChunkColumn::GENERATION_NOT_STARTED);
+}
+
 TEST(ChunkColumnSerialization, EmptySubChunksNotSerialized) {
     ChunkColumn column(ColumnPos{0, 0});
     BlockTypeId stone = BlockTypeId::fromName("test:stone");
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "finevox/core/string_interner.hpp"
+#include <atomic>
 #include <thread>
 #include <vector>
 #include <unordered_set>
@@ -100,6 +101,40 @@ TEST(StringInternerTest, EmptyStringIsAir) {
     EXPECT_EQ(foundAir.value(), AIR_INTERNED_ID);
 }
 
+TEST(StringInternerTest, HotPathScopeCountsLookups) {
+    auto& interner = StringInterner::global();
+    (void)interner.intern("hotpath:stone");
+
+    uint64_t before = interner.hotPathLookups();
+    (void)interner.intern("hotpath:stone");
+    EXPECT_EQ(interner.hotPathLookups(), before);  // Outside any scope
+
+    {
+        StringInterner::HotPathScope outer;
+        (void)interner.intern("hotpath:stone");
+        {
+            StringInterner::HotPathScope inner;
+            (void)interner.find("hotpath:stone");
+        }
+        (void)BlockTypeId::fromName("hotpath:dirt");
+        (void)interner.lookup(AIR_INTERNED_ID);  // ID to name is not counted
+    }
+    EXPECT_EQ(interner.hotPathLookups(), before + 3);
+
+    (void)interner.intern("hotpath:stone");
+    EXPECT_EQ(interner.hotPathLookups(), before + 3);
+}
+
+TEST(StringInternerTest, HotPathScopeIsPerThread) {
+    auto& interner = StringInterner::global();
+    StringInterner::HotPathScope scope;
+    uint64_t before = interner.hotPathLookups();
+
+    std::thread other([&] { (void)interner.intern("hotpath:other_thread"); });
+    other.join();
+    EXPECT_EQ(interner.hotPathLookups(), before);
+}
+
 TEST(StringInternerTest, ThreadSafety) {
     auto& interner = StringInterner::global();
 
@@ -128,6 +163,43 @@ TEST(StringInternerTest, ThreadSafety) {
     }
 }
 
+TEST(StringInternerTest, LookupsDuringInterning) {
+    auto& interner = StringInterner::global();
+    InternedId first = interner.intern("concurrent_test:name_0");
+    std::string_view firstView = interner.lookup(first);
+
+    // Readers never lock; they must see either nothing or the full string
+    std::atomic<bool> done{false};
+    std::atomic<int> mismatches{0};
+    std::thread reader([&] {
+        while (!done.load()) {
+            auto count = static_cast<InternedId>(interner.size());
+            for (InternedId id = 0; id < count; ++id) {
+                std::string_view name = interner.lookup(id);
+                auto found = interner.find(name);
+                if (name.empty() || !found || *found != id) {
+                    ++mismatches;
+                }
+            }
+        }
+    });
+    std::vector<InternedId> ids;
+    for (int i = 1; i < 5000; ++i) {
+        ids.push_back(interner.intern("concurrent_test:name_" + std::to_string(i)));
+    }
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(mismatches.load(), 0);
+    for (int i = 1; i < 5000; ++i) {
+        EXPECT_EQ(interner.lookup(ids[i - 1]), "concurrent_test:name_" + std::to_string(i));
+    }
+
+    // Views stay valid as storage grows
+    EXPECT_EQ(firstView.data(), interner.lookup(first).data());
+    EXPECT_EQ(firstView, "concurrent_test:name_0");
+}
+
 // ============================================================================
 // BlockTypeId tests
 // ============================================================================
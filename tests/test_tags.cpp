@@ -5,6 +5,8 @@
 #include "finevox/core/item_match.hpp"
 #include "finevox/core/string_interner.hpp"
 
+#include <algorithm>
+
 using namespace finevox;
 
 // ============================================================================
@@ -269,6 +271,42 @@ TEST_F(TagRegistryTest, CompositionMergesDirectAndIncluded) {
     EXPECT_TRUE(memberSet.contains(childItem));
 }
 
+TEST_F(TagRegistryTest, CompiledQueriesMatchResolvedSets) {
+    auto metals = TagId::fromName("c:metals");
+    auto ingots = TagId::fromName("c:ingots");
+    auto fuel = TagId::fromName("finevox:fuel");
+
+    std::vector<InternedId> items;
+    for (int i = 0; i < 300; ++i) {
+        items.push_back(StringInterner::global().intern("compiled_item_" + std::to_string(i)));
+    }
+    for (int i = 0; i < 300; ++i) {
+        tags_.addMember(i % 2 == 0 ? ingots : fuel, items[i]);
+    }
+    tags_.addMember(fuel, items[0]);
+    tags_.addInclude(metals, ingots);
+    EXPECT_TRUE(tags_.rebuild());
+
+    for (TagId tag : {metals, ingots, fuel}) {
+        auto members = tags_.getMembersOf(tag);
+        std::unordered_set<InternedId> memberSet(members.begin(), members.end());
+        for (auto item : items) {
+            EXPECT_EQ(tags_.hasTag(item, tag), memberSet.contains(item));
+        }
+    }
+
+    // Reverse index lists every tag once, in id order
+    auto tagsOfFirst = tags_.getTagsFor(items[0]);
+    std::vector<TagId> expected{metals, ingots, fuel};
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(tagsOfFirst, expected);
+    EXPECT_EQ(tags_.getTagsFor(items[1]), std::vector<TagId>{fuel});
+
+    tags_.clear();
+    EXPECT_FALSE(tags_.hasTag(items[0], ingots));
+    EXPECT_TRUE(tags_.getTagsFor(items[0]).empty());
+}
+
 TEST_F(TagRegistryTest, UnknownTagQuery) {
     EXPECT_TRUE(tags_.rebuild());
     auto bogusTag = TagId::fromName("nonexistent");
@@ -0,0 +1,205 @@
+/**
+ * @file pregen.cpp
+ * @brief finevox_pregen - headless world pre-generation
+ *
+ * Generates a rectangular area with the standard passes and writes it
+ * straight into region files, so a server can start with a warm world.
+ *
+ * Command line:
+ * - --out DIR: Region directory to write (required)
+ * - --seed N: World seed (default 42)
+ * - --radius N: Square of columns around --center (default 32)
+ * - --center X,Z: Center column for --radius (default 0,0)
+ * - --min X,Z / --max X,Z: Explicit inclusive column rectangle
+ * - --threads N: Worker threads (default: hardware concurrency)
+ * - --resources DIR: Biome/feature definitions (default: shipped resources/)
+ * - --codec none|lz4|lz4hc, --hc-level N: Compression for written columns
+ * - --force: Regenerate columns that already exist
+ */
+
+#include <finevox/core/region_file.hpp>
+#include <finevox/worldgen/biome.hpp>
+#include <finevox/worldgen/biome_loader.hpp>
+#include <finevox/worldgen/biome_map.hpp>
+#include <finevox/worldgen/feature_loader.hpp>
+#include <finevox/worldgen/feature_registry.hpp>
+#include <finevox/worldgen/generation_passes.hpp>
+#include <finevox/worldgen/pregenerator.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+
+using namespace finevox;
+using namespace finevox::worldgen;
+
+namespace {
+
+void printUsage() {
+    std::cout <<
+        "Usage: finevox_pregen --out DIR [options]\n"
+        "  --seed N                World seed (default 42)\n"
+        "  --radius N              Square of columns around --center (default 32)\n"
+        "  --center X,Z            Center column (default 0,0)\n"
+        "  --min X,Z --max X,Z     Explicit inclusive column rectangle\n"
+        "  --threads N             Worker threads (default: hardware concurrency)\n"
+        "  --resources DIR         Biome/feature definitions\n"
+        "  --codec none|lz4|lz4hc  Compression codec (default lz4)\n"
+        "  --hc-level N            LZ4-HC level 3-12 (default 9)\n"
+        "  --force                 Regenerate columns that already exist\n";
+}
+
+bool parseColumn(const std::string& text, ColumnPos& out) {
+    int x = 0;
+    int z = 0;
+    if (std::sscanf(text.c_str(), "%d,%d", &x, &z) != 2) {
+        return false;
+    }
+    out = ColumnPos{x, z};
+    return true;
+}
+
+void registerPlacements() {
+    // Same placement rules as render_demo --worldgen
+    auto& features = FeatureRegistry::global();
+    if (features.getFeature("demo:oak_tree")) {
+        FeaturePlacement placement;
+        placement.featureName = "demo:oak_tree";
+        placement.density = 0.02f;
+        placement.requiresSurface = true;
+        features.addPlacement(placement);
+    }
+    if (features.getFeature("demo:iron_ore")) {
+        FeaturePlacement placement;
+        placement.featureName = "demo:iron_ore";
+        placement.density = 0.03f;
+        placement.minHeight = 0;
+        placement.maxHeight = 48;
+        features.addPlacement(placement);
+    }
+    if (features.getFeature("demo:coal_ore")) {
+        FeaturePlacement placement;
+        placement.featureName = "demo:coal_ore";
+        placement.density = 0.04f;
+        placement.minHeight = 0;
+        placement.maxHeight = 64;
+        features.addPlacement(placement);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::map<std::string, std::string> args;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            printUsage();
+            return 0;
+        }
+        if (arg.rfind("--", 0) != 0) {
+            std::cerr << "Unexpected argument: " << arg << "\n";
+            return 1;
+        }
+        bool hasValue = i + 1 < argc && std::string(argv[i + 1]).rfind("--", 0) != 0;
+        args.insert_or_assign(arg.substr(2), std::string(hasValue ? argv[++i] : "1"));
+    }
+    auto get = [&](const std::string& key, const std::string& defaultVal) {
+        auto it = args.find(key);
+        return it != args.end() ? it->second : defaultVal;
+    };
+
+    if (!args.contains("out")) {
+        printUsage();
+        return 1;
+    }
+
+    try {
+        uint64_t seed = std::stoull(get("seed", "42"));
+
+        PregenArea area;
+        if (args.contains("min") || args.contains("max")) {
+            if (!parseColumn(get("min", ""), area.min) || !parseColumn(get("max", ""), area.max)) {
+                std::cerr << "--min and --max take X,Z column coordinates\n";
+                return 1;
+            }
+        } else {
+            ColumnPos center{0, 0};
+            if (args.contains("center") && !parseColumn(get("center", ""), center)) {
+                std::cerr << "--center takes X,Z column coordinates\n";
+                return 1;
+            }
+            area = PregenArea::square(center, std::stoi(get("radius", "32")));
+        }
+
+        PregenOptions options;
+        unsigned hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+        options.threads = std::stoul(get("threads", std::to_string(hardwareThreads)));
+        options.skipExisting = !args.contains("force");
+
+        CompressionPolicy policy;
+        auto codec = compressionCodecFromName(get("codec", "lz4"));
+        if (!codec) {
+            std::cerr << "Unknown codec: " << get("codec", "") << "\n";
+            return 1;
+        }
+        policy.codec = *codec;
+        policy.hcLevel = std::stoi(get("hc-level", std::to_string(CompressionPolicy::HC_LEVEL_DEFAULT)));
+        options.compression = policy;
+
+        std::string resourceDir = get("resources", FINEVOX_RESOURCE_DIR);
+        BiomeLoader::loadDirectory(resourceDir + "/biomes", "demo");
+        FeatureLoader::loadDirectory(resourceDir + "/features", "demo");
+        registerPlacements();
+        if (BiomeRegistry::global().size() == 0) {
+            std::cerr << "No biomes found in " << resourceDir << "/biomes\n";
+            return 1;
+        }
+
+        GenerationPipeline pipeline;
+        pipeline.setWorldSeed(seed);
+        pipeline.addPass(std::make_unique<TerrainPass>(seed));
+        pipeline.addPass(std::make_unique<SurfacePass>());
+        pipeline.addPass(std::make_unique<CavePass>(seed));
+        pipeline.addPass(std::make_unique<OrePass>());
+        pipeline.addPass(std::make_unique<StructurePass>());
+        pipeline.addPass(std::make_unique<DecorationPass>());
+        BiomeMap biomeMap(seed, BiomeRegistry::global());
+
+        std::filesystem::path outDir = get("out", "");
+        std::cout << "Generating " << area.columnCount() << " columns ("
+                  << area.min.x << "," << area.min.z << " to "
+                  << area.max.x << "," << area.max.z << ") with "
+                  << options.threads << " thread(s) into " << outDir << "\n";
+
+        WorldPregenerator pregen(pipeline, biomeMap, outDir);
+        PregenResult result = pregen.run(area, options, [](const PregenProgress& p) {
+            double rate = p.seconds > 0.0 ? static_cast<double>(p.columnsGenerated) / p.seconds : 0.0;
+            std::printf("  region %zu/%zu  %llu columns  %.0f columns/sec\n",
+                        p.regionsDone, p.regionsTotal,
+                        static_cast<unsigned long long>(p.columnsGenerated), rate);
+            std::fflush(stdout);
+        });
+
+        std::printf("Done: %llu generated, %llu skipped, %zu regions in %.2f s (%.0f columns/sec)\n",
+                    static_cast<unsigned long long>(result.columnsGenerated),
+                    static_cast<unsigned long long>(result.columnsSkipped),
+                    result.regionsWritten, result.seconds, result.columnsPerSecond());
+        if (result.featureWritesDropped > 0) {
+            std::printf("%llu feature blocks outside the area dropped\n",
+                        static_cast<unsigned long long>(result.featureWritesDropped));
+        }
+        if (result.writeFailures > 0) {
+            std::fprintf(stderr, "%llu column writes failed\n",
+                         static_cast<unsigned long long>(result.writeFailures));
+            return 1;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}